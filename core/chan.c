@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_chan
+ * @{
+ *
+ * @file
+ * @brief       Bulk channel implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "chan.h"
+#include "irq.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+void chan_init(chan_t *chan, void *buf, size_t slot_size, unsigned slots)
+{
+    assert(bitarithm_bits_set(slots) == 1);
+    assert((slots <= 0x8000) && (slot_size <= UINT16_MAX));
+
+    *chan = (chan_t){
+        .buf = buf,
+        .slot_size = slot_size,
+        .mask = slots - 1,
+        .threshold = 1,
+    };
+}
+
+static inline void *_slot(const chan_t *chan, uint16_t idx)
+{
+    return chan->buf + (size_t)(idx & chan->mask) * chan->slot_size;
+}
+
+/* number of slots from idx to the end of the ring, at most n and *numof */
+static inline unsigned _contiguous(const chan_t *chan, uint16_t idx,
+                                   unsigned n, unsigned numof)
+{
+    unsigned to_end = chan->mask + 1 - (idx & chan->mask);
+
+    if (n > to_end) {
+        n = to_end;
+    }
+    return (n < numof) ? n : numof;
+}
+
+void *chan_write_reserve(chan_t *chan, unsigned *numof)
+{
+    unsigned state = irq_disable();
+    uint16_t head = chan->head;
+    unsigned n = _contiguous(chan, head, chan_free(chan), *numof);
+
+    irq_restore(state);
+    *numof = n;
+    return n ? _slot(chan, head) : NULL;
+}
+
+void chan_write_commit(chan_t *chan, unsigned numof)
+{
+    unsigned state = irq_disable();
+    unsigned avail = chan_avail(chan);
+
+    assert(numof <= chan_free(chan));
+    chan->head += numof;
+
+    chan_cb_t cb = chan->cb;
+    void *arg = chan->arg;
+    bool notify = (avail < chan->threshold)
+                  && (avail + numof >= chan->threshold);
+    irq_restore(state);
+
+    DEBUG("chan_write_commit(%p): %u + %u\n", (void *)chan, avail, numof);
+    if (notify && cb) {
+        cb(chan, arg);
+    }
+}
+
+int chan_put(chan_t *chan, const void *data)
+{
+    unsigned numof = 1;
+    void *slot = chan_write_reserve(chan, &numof);
+
+    if (!slot) {
+        return -ENOSPC;
+    }
+    memcpy(slot, data, chan->slot_size);
+    chan_write_commit(chan, 1);
+    return 0;
+}
+
+void *chan_read_reserve(chan_t *chan, unsigned *numof)
+{
+    unsigned state = irq_disable();
+    uint16_t tail = chan->tail;
+    unsigned n = _contiguous(chan, tail, chan_avail(chan), *numof);
+
+    irq_restore(state);
+    *numof = n;
+    return n ? _slot(chan, tail) : NULL;
+}
+
+void chan_read_commit(chan_t *chan, unsigned numof)
+{
+    unsigned state = irq_disable();
+
+    assert(numof <= chan_avail(chan));
+    chan->tail += numof;
+    irq_restore(state);
+}
+
+int chan_get(chan_t *chan, void *data)
+{
+    unsigned numof = 1;
+    void *slot = chan_read_reserve(chan, &numof);
+
+    if (!slot) {
+        return -EAGAIN;
+    }
+    memcpy(data, slot, chan->slot_size);
+    chan_read_commit(chan, 1);
+    return 0;
+}
+
+void chan_set_notify(chan_t *chan, chan_cb_t cb, void *arg,
+                     unsigned threshold)
+{
+    assert((threshold > 0) && (threshold <= (unsigned)chan->mask + 1));
+    unsigned state = irq_disable();
+
+    chan->cb = cb;
+    chan->arg = arg;
+    chan->threshold = threshold;
+    irq_restore(state);
+}
+
+void chan_flush(chan_t *chan)
+{
+    unsigned state = irq_disable();
+    chan_cb_t cb = chan->cb;
+    void *arg = chan->arg;
+    bool notify = chan_avail(chan) > 0;
+
+    irq_restore(state);
+    if (notify && cb) {
+        cb(chan, arg);
+    }
+}
+
+#ifdef MODULE_CORE_THREAD_FLAGS
+static void _thread_flags_cb(chan_t *chan, void *arg)
+{
+    thread_flags_set(arg, chan->flags);
+}
+
+void chan_attach_thread(chan_t *chan, thread_flags_t flags,
+                        unsigned threshold)
+{
+    chan->flags = flags;
+    chan_set_notify(chan, _thread_flags_cb, thread_get_active(), threshold);
+}
+
+void *chan_read_wait(chan_t *chan, unsigned *numof)
+{
+    assert((chan->cb == _thread_flags_cb)
+           && (chan->arg == thread_get_active()));
+
+    if (chan_avail(chan) < chan->threshold) {
+        /* woken up by the threshold, a flush or a notification that was
+         * pending already: take what is there */
+        do {
+            thread_flags_wait_any(chan->flags);
+        } while (chan_avail(chan) == 0);
+    }
+    return chan_read_reserve(chan, numof);
+}
+#endif
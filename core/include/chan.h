@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_chan Bulk channels
+ * @ingroup     core
+ * @brief       Zero-copy channels of fixed-size slots between two contexts
+ *
+ * A channel is a ring of fixed-size slots owned by one producer and one
+ * consumer. Unlike @ref core_msg, a slot can hold any structure, and neither
+ * side copies it: the producer reserves slots in place, fills them and
+ * commits them, the consumer reserves the filled slots, processes them in
+ * place and commits them back as free.
+ *
+ * The producer may run in thread or interrupt context. The consumer is
+ * notified once the number of filled slots reaches a threshold, so a batch
+ * of slots costs a single wake-up. Notification is done by a callback, by
+ * @ref core_thread_flags (see @ref chan_attach_thread) or by an event
+ * (see @ref event/channel.h).
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * static sample_t samples[16];
+ * static chan_t chan = CHAN_INIT(samples);
+ *
+ * // producer
+ * unsigned numof = 1;
+ * sample_t *s = chan_write_reserve(&chan, &numof);
+ * if (s) {
+ *     s->value = adc_sample(line, res);
+ *     chan_write_commit(&chan, 1);
+ * }
+ *
+ * // consumer, after chan_attach_thread(&chan, FLAG_SAMPLES, 8)
+ * unsigned numof = 16;
+ * sample_t *s = chan_read_wait(&chan, &numof);
+ * process(s, numof);
+ * chan_read_commit(&chan, numof);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Bulk channel API
+ */
+
+#ifndef CHAN_H
+#define CHAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Forward declaration of the channel type
+ */
+typedef struct chan chan_t;
+
+/**
+ * @brief   Consumer notification callback
+ *
+ * May be called from interrupt context.
+ *
+ * @param[in]   chan    channel that reached its threshold
+ * @param[in]   arg     argument given to @ref chan_set_notify
+ */
+typedef void (*chan_cb_t)(chan_t *chan, void *arg);
+
+/**
+ * @brief   Channel structure. Must never be modified by the user.
+ */
+struct chan {
+    uint8_t *buf;           /**< slot memory */
+    uint16_t slot_size;     /**< size of a slot in bytes */
+    uint16_t mask;          /**< number of slots - 1 */
+    uint16_t head;          /**< slots committed by the producer (wrapping) */
+    uint16_t tail;          /**< slots committed by the consumer (wrapping) */
+    uint16_t threshold;     /**< filled slots that trigger a notification */
+    uint16_t flags;         /**< thread flags to set, see
+                                 @ref chan_attach_thread */
+    chan_cb_t cb;           /**< consumer notification, or NULL */
+    void *arg;              /**< argument of @ref chan_t::cb */
+};
+
+/**
+ * @brief   Static initializer for a channel over the array @p slots
+ *
+ * The slot type and number of slots are taken from the array, which must
+ * hold a power of two elements.
+ */
+#define CHAN_INIT(slots) { \
+        .buf = (uint8_t *)(slots), \
+        .slot_size = sizeof((slots)[0]), \
+        .mask = ARRAY_SIZE(slots) - 1, \
+        .threshold = 1, \
+}
+
+/**
+ * @brief   Initialize a channel
+ *
+ * @param[out]  chan        channel to initialize
+ * @param[in]   buf         memory for @p slots slots of @p slot_size bytes
+ * @param[in]   slot_size   size of a slot in bytes
+ * @param[in]   slots       number of slots, must be a power of two
+ */
+void chan_init(chan_t *chan, void *buf, size_t slot_size, unsigned slots);
+
+/**
+ * @brief   Number of filled slots, i.e. committed by the producer and not yet
+ *          committed by the consumer
+ */
+static inline unsigned chan_avail(const chan_t *chan)
+{
+    return (uint16_t)(chan->head - chan->tail);
+}
+
+/**
+ * @brief   Number of free slots
+ */
+static inline unsigned chan_free(const chan_t *chan)
+{
+    return chan->mask + 1 - chan_avail(chan);
+}
+
+/**
+ * @brief   Reserve free slots for writing
+ *
+ * Only the producer may call this function. The slots are contiguous in
+ * memory, so fewer than requested may be returned when the ring wraps.
+ *
+ * @param[in]       chan    channel to write to
+ * @param[in,out]   numof   maximum number of slots wanted, number of slots
+ *                          reserved
+ *
+ * @return  first reserved slot
+ * @retval  NULL    if the channel is full
+ */
+void *chan_write_reserve(chan_t *chan, unsigned *numof);
+
+/**
+ * @brief   Pass written slots to the consumer
+ *
+ * Notifies the consumer if the number of filled slots reaches the threshold.
+ *
+ * @param[in]   chan    channel written to
+ * @param[in]   numof   number of slots, at most the number reserved
+ */
+void chan_write_commit(chan_t *chan, unsigned numof);
+
+/**
+ * @brief   Copy @p data into the next free slot and commit it
+ *
+ * @retval  0           on success
+ * @retval  -ENOSPC     if the channel is full
+ */
+int chan_put(chan_t *chan, const void *data);
+
+/**
+ * @brief   Reserve filled slots for reading
+ *
+ * Only the consumer may call this function. The slots are contiguous in
+ * memory, so fewer than available may be returned when the ring wraps.
+ *
+ * @param[in]       chan    channel to read from
+ * @param[in,out]   numof   maximum number of slots wanted, number of slots
+ *                          reserved
+ *
+ * @return  first reserved slot
+ * @retval  NULL    if the channel is empty
+ */
+void *chan_read_reserve(chan_t *chan, unsigned *numof);
+
+/**
+ * @brief   Pass read slots back to the producer
+ *
+ * @param[in]   chan    channel read from
+ * @param[in]   numof   number of slots, at most the number reserved
+ */
+void chan_read_commit(chan_t *chan, unsigned numof);
+
+/**
+ * @brief   Copy the next filled slot to @p data and commit it
+ *
+ * @retval  0           on success
+ * @retval  -EAGAIN     if the channel is empty
+ */
+int chan_get(chan_t *chan, void *data);
+
+/**
+ * @brief   Set the consumer notification
+ *
+ * @p cb is called whenever a commit of the producer makes the number of
+ * filled slots reach @p threshold.
+ *
+ * @param[in]   chan        channel
+ * @param[in]   cb          callback, NULL to disable notifications
+ * @param[in]   arg         argument of @p cb
+ * @param[in]   threshold   number of filled slots to notify at, at least 1
+ */
+void chan_set_notify(chan_t *chan, chan_cb_t cb, void *arg,
+                     unsigned threshold);
+
+/**
+ * @brief   Notify the consumer of filled slots below the threshold
+ *
+ * Used by the producer at the end of a burst.
+ */
+void chan_flush(chan_t *chan);
+
+#if defined(MODULE_CORE_THREAD_FLAGS) || defined(DOXYGEN)
+/**
+ * @brief   Make the calling thread the consumer of @p chan, notified by
+ *          @p flags
+ *
+ * @param[in]   chan        channel
+ * @param[in]   flags       thread flags to set on notification
+ * @param[in]   threshold   number of filled slots to notify at, at least 1
+ */
+void chan_attach_thread(chan_t *chan, thread_flags_t flags,
+                        unsigned threshold);
+
+/**
+ * @brief   Wait for filled slots and reserve them for reading
+ *
+ * Blocks until the threshold is reached or the producer flushes the
+ * channel. Returns at least one slot.
+ *
+ * @pre     The calling thread is attached with @ref chan_attach_thread
+ *
+ * @param[in]       chan    channel to read from
+ * @param[in,out]   numof   maximum number of slots wanted, number of slots
+ *                          reserved
+ *
+ * @return  first reserved slot
+ */
+void *chan_read_wait(chan_t *chan, unsigned *numof);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHAN_H */
+/** @} */
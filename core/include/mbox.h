@@ -11,6 +11,16 @@
  * @ingroup     core
  * @brief       Mailbox implementation
  *
+ * Putting a message into a mailbox that has room and getting a queued
+ * message do not disable interrupts, as long as no thread waits on the
+ * mailbox. Interrupts are only disabled to block or to wake a thread. On
+ * platforms without atomic compare-and-swap instructions, the atomic
+ * accesses themselves briefly disable interrupts.
+ *
+ * Under contention, a non-blocking put may fail while the message that
+ * occupied the slot is still being copied out, and a non-blocking get may
+ * fail while the oldest message is still being copied in.
+ *
  * @{
  *
  * @file
@@ -32,7 +42,7 @@ extern "C" {
 
 /** Static initializer for mbox objects */
 #define MBOX_INIT(queue, queue_size) { \
-        { 0 }, { 0 }, CIB_INIT(queue_size), queue \
+        { 0 }, { 0 }, CIB_INIT(queue_size), queue, 0 \
 }
 
 /**
@@ -43,6 +53,7 @@ typedef struct {
     list_node_t writers;    /**< list of threads waiting to send        */
     cib_t cib;              /**< cib for msg array                      */
     msg_t *msg_array;       /**< ptr to array of msg queue              */
+    uint8_t slots_ready;    /**< msg_array was prepared for use         */
 } mbox_t;
 
 enum {
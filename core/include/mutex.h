@@ -16,7 +16,10 @@
  *              employed. If your application is subject to priority inversion
  *              and cannot tolerate the additional delay this can cause, use
  *              module `core_mutex_priority_inheritance` to employ
- *              priority inheritance as mitigation.
+ *              priority inheritance as mitigation. The inherited priority is
+ *              passed on along chains of owners that are themselves blocked
+ *              on a mutex, and dropped again on unlock or when the waiting
+ *              thread is cancelled (see @ref mutex_cancel).
  *
  * Mutex Implementation Basics
  * ===========================
@@ -141,12 +144,6 @@ typedef struct {
      * this will have the value of `NULL`.
      */
     kernel_pid_t owner;
-    /**
-     * @brief   Original priority of the owner
-     * @note    Only available if module core_mutex_priority_inheritance
-     *          is used.
-     */
-    uint8_t owner_original_priority;
 #endif
 } mutex_t;
 
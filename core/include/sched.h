@@ -88,6 +88,10 @@
 #include "native_sched.h"
 #include "clist.h"
 
+#ifdef MODULE_CORE_SMP
+#include "smp.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -233,7 +237,8 @@ NORETURN void cpu_switch_context_exit(void);
 
 /**
  * Flag indicating whether a context switch is necessary after handling an
- * interrupt. Supposed to be set in an ISR.
+ * interrupt. Supposed to be set in an ISR. With @ref core_smp, it refers to
+ * core 0, which handles all interrupts.
  */
 extern volatile unsigned int sched_context_switch_request;
 
@@ -247,10 +252,20 @@ extern volatile thread_t *sched_threads[KERNEL_PID_LAST + 1];
  */
 extern volatile int sched_num_threads;
 
+#if defined(MODULE_CORE_SMP) && !defined(DOXYGEN)
+/**
+ * List of runqueues per priority level of each core
+ */
+extern clist_node_t sched_core_runqueues[SMP_CORE_NUMOF][SCHED_PRIO_LEVELS];
+
+/* runqueues of the calling core, valid while interrupts are disabled */
+#define sched_runqueues (sched_core_runqueues[smp_core_id()])
+#else
 /**
  * List of runqueues per priority level
  */
 extern clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];
+#endif
 
 /**
  * @brief  Removes thread from scheduler and set status to #STATUS_STOPPED
@@ -313,6 +328,10 @@ void sched_register_cb(sched_callback_t callback);
  *  Next time that priority is scheduled the now first thread will get activated.
  *  Calling this will not start the scheduler.
  *
+ *  With @ref sched_edf, the first thread of the run queue at
+ *  @ref CONFIG_SCHED_EDF_PRIO is re-inserted according to its deadline
+ *  instead, as that run queue is kept sorted by deadline.
+ *
  * @warning This API is not intended for out of tree users.
  *          Breaking API changes will be done without notice and
  *          without deprecation. Consider yourself warned!
@@ -320,10 +339,14 @@ void sched_register_cb(sched_callback_t callback);
  * @param   prio      The priority of the runqueue to advance
  *
  */
+#if defined(MODULE_SCHED_EDF) && !defined(DOXYGEN)
+void sched_runq_advance(uint8_t prio);
+#else
 static inline void sched_runq_advance(uint8_t prio)
 {
     clist_lpoprpush(&sched_runqueues[prio]);
 }
+#endif
 
 #if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK)) || defined(DOXYGEN)
 /**
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_smp Symmetric multiprocessing
+ * @ingroup     core
+ * @brief       Scheduling threads on several cores
+ *
+ * With the module `core_smp`, each of the @ref SMP_CORE_NUMOF cores has its
+ * own run queues and its own active thread. A thread runs on one core at a
+ * time, restricted to the cores given at creation with
+ * @ref THREAD_CREATE_AFFINITY.
+ *
+ * - A thread that becomes runnable is queued on the allowed core with the
+ *   least important work, preferring the core it ran on last. That core is
+ *   notified if the thread preempts its active thread.
+ * - A core that is about to run a thread pulls a more important one that is
+ *   waiting on the run queue of another core, if it is allowed to run it.
+ * - The scheduler state and all other kernel structures are protected by a
+ *   single kernel spinlock, which a core holds while its interrupts are
+ *   disabled. Thus all critical sections built on irq_disable() stay valid
+ *   on several cores, at the cost of serializing them.
+ * - Interrupts are only handled by core 0, @ref sched_context_switch_request
+ *   refers to it. The other cores switch threads when the running thread
+ *   blocks or yields, or when they are notified and enter the kernel.
+ *
+ * The module is incompatible with the scheduler extensions that assume a
+ * single run queue (`sched_edf`, `sched_round_robin`,
+ * `sched_runq_callback`).
+ *
+ * An architecture supporting SMP provides the feature `arch_smp`, defines
+ * @ref SMP_CORE_NUMOF and implements the `smp_arch_*` functions, and its
+ * irq_disable() and irq_enable() take and release the kernel lock using
+ * smp_kernel_lock() and smp_kernel_unlock().
+ *
+ * @{
+ *
+ * @file
+ * @brief       SMP API
+ */
+
+#ifndef SMP_H
+#define SMP_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include "cpu_conf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of cores the kernel schedules threads on, at most 8
+ */
+#ifndef SMP_CORE_NUMOF
+#define SMP_CORE_NUMOF      (1)
+#endif
+
+/**
+ * @brief   Affinity mask of all cores
+ */
+#define SMP_CORE_MASK       ((1U << SMP_CORE_NUMOF) - 1)
+
+/**
+ * @brief   Cores the main thread may run on, 0 for all cores
+ *
+ * Applications that rely on the main thread not running in parallel to a
+ * thread pinned to a core pin it to the same core.
+ */
+#ifndef CONFIG_SMP_MAIN_AFFINITY
+#define CONFIG_SMP_MAIN_AFFINITY    (0)
+#endif
+
+/**
+ * @brief   Spinlock
+ */
+typedef struct {
+    atomic_flag flag;       /**< set while the lock is held */
+} spinlock_t;
+
+/**
+ * @brief   Static initializer for an unlocked spinlock
+ */
+#define SPINLOCK_INIT       { ATOMIC_FLAG_INIT }
+
+/**
+ * @brief   Get the index of the calling core
+ *
+ * @return  index of the core, below @ref SMP_CORE_NUMOF
+ */
+unsigned smp_core_id(void);
+
+/**
+ * @brief   Start core @p core
+ *
+ * The core enters the scheduler with its interrupts disabled, i.e. it first
+ * waits for the kernel lock.
+ *
+ * @param[in]   core    index of the core, not 0
+ */
+void smp_arch_core_start(unsigned core);
+
+/**
+ * @brief   Make core @p core run its scheduler
+ *
+ * Called with the kernel lock held, when a thread more important than the
+ * active thread of @p core was queued on it.
+ *
+ * @param[in]   core    index of the core to notify
+ */
+void smp_arch_core_notify(unsigned core);
+
+/**
+ * @brief   Called while spinning on a lock held by another core
+ */
+void smp_arch_spin_wait(void);
+
+/**
+ * @brief   Start all other cores
+ *
+ * Called by kernel_init() with interrupts disabled, after the idle threads
+ * of all cores have been created.
+ */
+void smp_cores_start(void);
+
+/**
+ * @brief   Take the kernel lock
+ *
+ * Called by the architecture when interrupts of the calling core get
+ * disabled.
+ */
+void smp_kernel_lock(void);
+
+/**
+ * @brief   Release the kernel lock
+ *
+ * Called by the architecture when interrupts of the calling core get
+ * enabled.
+ */
+void smp_kernel_unlock(void);
+
+/**
+ * @brief   Try to take a spinlock without waiting
+ *
+ * @param[in,out]   lock    lock to take
+ *
+ * @retval  true    the lock was taken
+ * @retval  false   the lock is held
+ */
+static inline bool spinlock_trylock(spinlock_t *lock)
+{
+    return !atomic_flag_test_and_set_explicit(&lock->flag,
+                                              memory_order_acquire);
+}
+
+/**
+ * @brief   Take a spinlock, waiting until it is released
+ *
+ * @param[in,out]   lock    lock to take
+ */
+static inline void spinlock_lock(spinlock_t *lock)
+{
+    while (!spinlock_trylock(lock)) {
+        smp_arch_spin_wait();
+    }
+}
+
+/**
+ * @brief   Release a spinlock
+ *
+ * @param[in,out]   lock    lock to release
+ */
+static inline void spinlock_unlock(spinlock_t *lock)
+{
+    atomic_flag_clear_explicit(&lock->flag, memory_order_release);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SMP_H */
+/** @} */
@@ -179,6 +179,24 @@ struct _thread {
 
     clist_node_t rq_entry;          /**< run queue entry                */
 
+#if defined(MODULE_SCHED_EDF) || defined(DOXYGEN)
+    uint32_t deadline;              /**< absolute deadline of the current
+                                         job, see @ref sched_edf, only
+                                         valid after joining the class    */
+#endif
+
+#if defined(MODULE_CORE_SMP) || defined(DOXYGEN)
+    uint8_t core;                   /**< core the thread is queued on or
+                                         ran on last, see @ref core_smp   */
+    uint8_t affinity;               /**< mask of the cores the thread may
+                                         run on                         */
+#endif
+
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    void *mutex_blocked;            /**< mutex the thread is waiting for */
+    uint8_t mutex_base_priority;    /**< priority before inheriting one,
+                                         UINT8_MAX if not inheriting    */
+#endif
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
     || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
     void *wait_data;                /**< used by msg, mbox and thread
@@ -239,6 +257,14 @@ struct _thread {
  *        debugging and profiling purposes)
  */
 #define THREAD_CREATE_STACKTEST         (8)
+
+/**
+ * @brief Restrict the new thread to the cores in the bit mask @p mask
+ *
+ *        Bit n allows core n. Without this flag, or with an empty mask, the
+ *        thread may run on all cores. Ignored without @ref core_smp.
+ */
+#define THREAD_CREATE_AFFINITY(mask)    (((mask) & 0xff) << 8)
 /** @} */
 
 /**
@@ -386,9 +412,24 @@ int thread_wakeup(kernel_pid_t pid);
  */
 static inline kernel_pid_t thread_getpid(void)
 {
+#ifdef MODULE_CORE_SMP
+    extern volatile kernel_pid_t sched_active_pids[SMP_CORE_NUMOF];
+    unsigned core;
+    kernel_pid_t pid;
+
+    /* threads are only preempted, and thus migrated, on core 0: if the core
+     * did not change, the pid was read on it */
+    do {
+        core = smp_core_id();
+        pid = sched_active_pids[core];
+    } while (core != smp_core_id());
+
+    return pid;
+#else
     extern volatile kernel_pid_t sched_active_pid;
 
     return sched_active_pid;
+#endif
 }
 
 /**
@@ -400,9 +441,23 @@ static inline kernel_pid_t thread_getpid(void)
  */
 static inline thread_t *thread_get_active(void)
 {
+#ifdef MODULE_CORE_SMP
+    extern volatile thread_t *sched_active_threads[SMP_CORE_NUMOF];
+    unsigned core;
+    thread_t *active;
+
+    /* see thread_getpid() */
+    do {
+        core = smp_core_id();
+        active = (thread_t *)sched_active_threads[core];
+    } while (core != smp_core_id());
+
+    return active;
+#else
     extern volatile thread_t *sched_active_thread;
 
     return (thread_t *)sched_active_thread;
+#endif
 }
 
 /**
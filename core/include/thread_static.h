@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_thread_static Statically declared threads
+ * @ingroup     core_thread
+ * @brief       Threads laid out at link time and created in one pass at boot
+ *
+ * A module declares its thread with @ref THREAD_STATIC or
+ * @ref THREAD_STATIC_MSG instead of calling thread_create() from its
+ * auto-initialization. The thread control block, the stack and the message
+ * queue are separate static objects, and a read-only descriptor is added to
+ * a cross-file array (see @ref xfa.h). kernel_init() creates all declared
+ * threads in one pass, with interrupts disabled once, right after the idle
+ * and the main thread.
+ *
+ * The threads run once the scheduler starts, i.e. before auto-initialization
+ * of the other modules. A thread that depends on it is declared with
+ * @ref THREAD_CREATE_SLEEPING and woken up by the module:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * THREAD_STATIC_MSG(foo, THREAD_STACKSIZE_DEFAULT, THREAD_PRIORITY_MAIN - 1,
+ *                   THREAD_CREATE_SLEEPING, _foo_thread, NULL, 8);
+ *
+ * void auto_init_foo(void)
+ * {
+ *     foo_dev_init();
+ *     thread_wakeup(THREAD_STATIC_PID(foo));
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Without the module `core_thread_static`, declared threads are never
+ * created.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Static thread declaration API
+ */
+
+#ifndef THREAD_STATIC_H
+#define THREAD_STATIC_H
+
+#include <stdalign.h>
+
+#include "assert.h"
+#include "thread.h"
+#include "xfa.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Descriptor of a statically declared thread
+ */
+typedef struct {
+    thread_t *thread;               /**< thread control block */
+    char *stack;                    /**< word aligned stack */
+    int stack_size;                 /**< size of @ref stack in bytes */
+    uint8_t priority;               /**< priority of the thread */
+    int flags;                      /**< `THREAD_CREATE_*` flags, the thread
+                                         never runs before kernel_init()
+                                         returns */
+    thread_task_func_t function;    /**< function the thread runs */
+    void *arg;                      /**< argument of @ref function */
+    const char *name;               /**< name of the thread */
+#if defined(MODULE_CORE_MSG) || defined(DOXYGEN)
+    msg_t *msg_array;               /**< message queue or NULL */
+    unsigned msg_queue_size;        /**< size of @ref msg_array, a power of
+                                         two */
+#endif
+} thread_static_t;
+
+/**
+ * @brief   Descriptor initializer
+ * @internal
+ */
+#ifdef MODULE_CORE_MSG
+#define _THREAD_STATIC_DESC(name_, priority_, flags_, function_, arg_,   \
+                            queue_, queue_size_)                         \
+    {                                                                    \
+        .thread = &_thread_static_tcb_ ## name_,                         \
+        .stack = _thread_static_stack_ ## name_,                         \
+        .stack_size = sizeof(_thread_static_stack_ ## name_),            \
+        .priority = (priority_),                                         \
+        .flags = (flags_),                                               \
+        .function = (function_),                                         \
+        .arg = (arg_),                                                   \
+        .name = #name_,                                                  \
+        .msg_array = (queue_),                                           \
+        .msg_queue_size = (queue_size_),                                 \
+    }
+#else
+#define _THREAD_STATIC_DESC(name_, priority_, flags_, function_, arg_,   \
+                            queue_, queue_size_)                         \
+    {                                                                    \
+        .thread = &_thread_static_tcb_ ## name_,                         \
+        .stack = _thread_static_stack_ ## name_,                         \
+        .stack_size = sizeof(_thread_static_stack_ ## name_),            \
+        .priority = (priority_),                                         \
+        .flags = (flags_),                                               \
+        .function = (function_),                                         \
+        .arg = (arg_),                                                   \
+        .name = #name_,                                                  \
+    }
+#endif
+
+/**
+ * @brief   Thread control block and stack of a declared thread
+ * @internal
+ */
+#define _THREAD_STATIC_MEMORY(name_, stacksize_)                         \
+    static thread_t _thread_static_tcb_ ## name_;                        \
+    static alignas(void *) char _thread_static_stack_ ## name_[stacksize_]
+
+/**
+ * @brief   Add a descriptor to the threads created at boot
+ * @internal
+ *
+ * The array holds pointers, as the compiler may align larger structures
+ * beyond their size.
+ */
+#define _THREAD_STATIC_ADD(name_)                                        \
+    XFA_CONST(thread_static_xfa, 0)                                      \
+    const thread_static_t *const _thread_static_ptr_ ## name_ =          \
+        &_thread_static_ ## name_
+
+/**
+ * @brief   Declare a thread that is created at boot
+ *
+ * @param[in]   name_       identifier of the thread, also its name
+ * @param[in]   stacksize_  size of the stack in bytes, the thread control
+ *                          block is not part of it
+ * @param[in]   priority_   priority of the thread
+ * @param[in]   flags_      `THREAD_CREATE_*` flags
+ * @param[in]   function_   function the thread runs
+ * @param[in]   arg_        argument of @p function_, a constant expression
+ */
+#define THREAD_STATIC(name_, stacksize_, priority_, flags_, function_, arg_) \
+    _THREAD_STATIC_MEMORY(name_, stacksize_);                                \
+    static const thread_static_t _thread_static_ ## name_ =                  \
+        _THREAD_STATIC_DESC(name_, priority_, flags_, function_, arg_,       \
+                            NULL, 0);                                        \
+    _THREAD_STATIC_ADD(name_)
+
+/**
+ * @brief   Declare a thread that is created at boot with a message queue
+ *
+ * The thread does not need to call msg_init_queue().
+ *
+ * @param[in]   name_       identifier of the thread, also its name
+ * @param[in]   stacksize_  size of the stack in bytes, the thread control
+ *                          block is not part of it
+ * @param[in]   priority_   priority of the thread
+ * @param[in]   flags_      `THREAD_CREATE_*` flags
+ * @param[in]   function_   function the thread runs
+ * @param[in]   arg_        argument of @p function_, a constant expression
+ * @param[in]   queue_size_ number of messages in the queue, a power of two
+ */
+#define THREAD_STATIC_MSG(name_, stacksize_, priority_, flags_, function_,   \
+                          arg_, queue_size_)                                 \
+    _THREAD_STATIC_MEMORY(name_, stacksize_);                                \
+    static_assert((queue_size_) && !((queue_size_) & ((queue_size_) - 1)),   \
+                  "message queue size must be a power of two");              \
+    static msg_t _thread_static_queue_ ## name_[queue_size_];                \
+    static const thread_static_t _thread_static_ ## name_ =                  \
+        _THREAD_STATIC_DESC(name_, priority_, flags_, function_, arg_,       \
+                            _thread_static_queue_ ## name_, queue_size_);    \
+    _THREAD_STATIC_ADD(name_)
+
+/**
+ * @brief   PID of a thread declared in the same file, once it was created
+ */
+#define THREAD_STATIC_PID(name_)    (_thread_static_tcb_ ## name_.pid)
+
+/**
+ * @brief   Create threads from their descriptors in one pass
+ *
+ * Interrupts are disabled once for all threads, including the preparation
+ * of their stacks. None of the threads runs before this function returns.
+ *
+ * @param[in]   threads     descriptors of the threads
+ * @param[in]   numof       number of descriptors in @p threads
+ *
+ * @return  0 on success
+ * @return  -EOVERFLOW if there are too many threads, the threads before the
+ *          first one that did not fit were created
+ */
+int thread_static_create(const thread_static_t *threads, unsigned numof);
+
+/**
+ * @brief   Create all threads declared with @ref THREAD_STATIC and
+ *          @ref THREAD_STATIC_MSG, called by kernel_init()
+ *
+ * @return  see @ref thread_static_create
+ */
+int thread_static_create_all(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREAD_STATIC_H */
+/** @} */
@@ -11,6 +11,10 @@
  * @ingroup     core_sync
  * @brief       Recursive Mutex for thread synchronization
  *
+ * A recursive mutex is built on a @ref mutex_t, so priority inheritance
+ * (module `core_mutex_priority_inheritance`) applies to it as well. Relocking
+ * by the owner never blocks and does not affect the priorities.
+ *
  * @{
  *
  * @file
@@ -29,6 +29,7 @@
 #include "log.h"
 #include "periph/pm.h"
 #include "thread.h"
+#include "thread_static.h"
 #include "stdio_base.h"
 
 #if IS_USED(MODULE_VFS)
@@ -47,6 +48,12 @@ extern int main(void);
 
 static char main_stack[THREAD_STACKSIZE_MAIN];
 static char idle_stack[THREAD_STACKSIZE_IDLE];
+#if IS_USED(MODULE_CORE_SMP)
+static char smp_idle_stacks[SMP_CORE_NUMOF - 1][THREAD_STACKSIZE_IDLE];
+#define MAIN_AFFINITY   THREAD_CREATE_AFFINITY(CONFIG_SMP_MAIN_AFFINITY)
+#else
+#define MAIN_AFFINITY   0
+#endif
 
 static void *main_trampoline(void *arg)
 {
@@ -95,21 +102,42 @@ void kernel_init(void)
     if (IS_USED(MODULE_CORE_IDLE_THREAD)) {
         thread_create(idle_stack, sizeof(idle_stack),
                       THREAD_PRIORITY_IDLE,
-                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST
+                      | THREAD_CREATE_AFFINITY(1),
                       idle_thread, NULL, "idle");
     }
 
+#if IS_USED(MODULE_CORE_SMP)
+    /* every other core runs its own idle thread */
+    for (unsigned core = 1; core < SMP_CORE_NUMOF; core++) {
+        thread_create(smp_idle_stacks[core - 1], sizeof(smp_idle_stacks[0]),
+                      THREAD_PRIORITY_IDLE,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST
+                      | THREAD_CREATE_AFFINITY(1U << core),
+                      idle_thread, NULL, "idle");
+    }
+#endif
+
     if (IS_USED(MODULE_CORE_THREAD)) {
         thread_create(main_stack, sizeof(main_stack),
                       THREAD_PRIORITY_MAIN,
-                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                      THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST
+                      | MAIN_AFFINITY,
                       main_trampoline, NULL, "main");
+
+        if (IS_USED(MODULE_CORE_THREAD_STATIC)) {
+            thread_static_create_all();
+        }
     }
     else {
         irq_enable();
         main_trampoline(NULL);
     }
 
+#if IS_USED(MODULE_CORE_SMP)
+    smp_cores_start();
+#endif
+
     cpu_switch_context_exit();
 }
 
@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <string.h>
 
 #include "mbox.h"
@@ -28,6 +29,130 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* The queue is accessed without disabling interrupts as long as no thread
+ * has to be woken. Producers and consumers claim a position with a
+ * compare-and-swap on cib.write_count or cib.read_count. The sender_pid of
+ * a queued message tells whether its slot holds a message: a producer only
+ * claims a slot whose message of the previous round was fully copied out,
+ * a consumer only claims a slot whose message was fully copied in.
+ * MBOX_INIT() can't clear the sender_pid of the queued messages, so the
+ * first put or get on a mailbox does.
+ *
+ * A thread only waits with interrupts disabled and after checking the
+ * queue. Whoever puts or gets a message without disabling interrupts checks
+ * the waiting threads afterwards, so no wake-up is lost. */
+
+#define SLOT_FREE   KERNEL_PID_UNDEF
+
+enum {
+    SLOTS_UNSET = 0,
+    SLOTS_CLEARING,
+    SLOTS_READY,
+};
+
+static inline void _fence(void)
+{
+    if (IS_USED(MODULE_CORE_SMP)) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+    else {
+        /* all concurrency is preemption on this core */
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    }
+}
+
+/* a queued message never has SLOT_FREE as sender, even before the first
+ * thread was scheduled */
+static inline kernel_pid_t _sender_pid(void)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    return (pid == KERNEL_PID_UNDEF) ? KERNEL_PID_ISR : pid;
+}
+
+static inline bool _waiting(list_node_t *wait_list)
+{
+    _fence();
+    return __atomic_load_n(&wait_list->next, __ATOMIC_RELAXED) != NULL;
+}
+
+static void _prepare_slots(mbox_t *mbox)
+{
+    if (__atomic_load_n(&mbox->slots_ready, __ATOMIC_ACQUIRE) == SLOTS_READY) {
+        return;
+    }
+
+    unsigned irqstate = irq_disable();
+    uint8_t state = SLOTS_UNSET;
+
+    if (__atomic_compare_exchange_n(&mbox->slots_ready, &state, SLOTS_CLEARING,
+                                    false, __ATOMIC_ACQUIRE,
+                                    __ATOMIC_ACQUIRE)) {
+        for (unsigned i = 0; i < mbox_size(mbox); i++) {
+            mbox->msg_array[i].sender_pid = SLOT_FREE;
+        }
+        __atomic_store_n(&mbox->slots_ready, SLOTS_READY, __ATOMIC_RELEASE);
+    }
+    else {
+        /* only with core_smp: another core is clearing them with interrupts
+         * disabled */
+        while (__atomic_load_n(&mbox->slots_ready, __ATOMIC_ACQUIRE) !=
+               SLOTS_READY) {}
+    }
+    irq_restore(irqstate);
+}
+
+static bool _try_put(mbox_t *mbox, const msg_t *msg)
+{
+    cib_t *cib = &mbox->cib;
+    unsigned int pos = __atomic_load_n(&cib->write_count, __ATOMIC_RELAXED);
+    msg_t *slot;
+
+    do {
+        if (pos - __atomic_load_n(&cib->read_count, __ATOMIC_ACQUIRE) > cib->mask) {
+            return false;
+        }
+        slot = &mbox->msg_array[pos & cib->mask];
+        if (__atomic_load_n(&slot->sender_pid, __ATOMIC_ACQUIRE) != SLOT_FREE) {
+            /* the previous message is still being copied out */
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&cib->write_count, &pos, pos + 1,
+                                          false, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_RELAXED));
+
+    slot->type = msg->type;
+    slot->content = msg->content;
+    __atomic_store_n(&slot->sender_pid, msg->sender_pid, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+static bool _try_get(mbox_t *mbox, msg_t *msg)
+{
+    cib_t *cib = &mbox->cib;
+    unsigned int pos = __atomic_load_n(&cib->read_count, __ATOMIC_RELAXED);
+    msg_t *slot;
+
+    do {
+        if (__atomic_load_n(&cib->write_count, __ATOMIC_ACQUIRE) == pos) {
+            return false;
+        }
+        slot = &mbox->msg_array[pos & cib->mask];
+        if (__atomic_load_n(&slot->sender_pid, __ATOMIC_ACQUIRE) == SLOT_FREE) {
+            /* claimed, but not copied in yet */
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(&cib->read_count, &pos, pos + 1,
+                                          false, __ATOMIC_ACQ_REL,
+                                          __ATOMIC_RELAXED));
+
+    *msg = *slot;
+    __atomic_store_n(&slot->sender_pid, SLOT_FREE, __ATOMIC_RELEASE);
+
+    return true;
+}
+
 static void _wake_waiter(thread_t *thread, unsigned irqstate)
 {
     sched_set_status(thread, STATUS_PENDING);
@@ -41,7 +166,11 @@ static void _wake_waiter(thread_t *thread, unsigned irqstate)
     sched_switch(process_priority);
 }
 
-static void _wait(list_node_t *wait_list, unsigned irqstate)
+/* Block on @p wait_list, unless @p retry succeeds once the thread is on the
+ * list. Only needed with core_smp: on a single core nothing can put or get
+ * while interrupts are disabled. */
+static bool _wait(mbox_t *mbox, list_node_t *wait_list, msg_t *msg,
+                  bool (*retry)(mbox_t *, msg_t *), unsigned irqstate)
 {
     DEBUG("mbox: Thread %" PRIkernel_pid " _wait(): going blocked.\n",
           thread_getpid());
@@ -50,78 +179,154 @@ static void _wait(list_node_t *wait_list, unsigned irqstate)
 
     sched_set_status(me, STATUS_MBOX_BLOCKED);
     thread_add_to_list(wait_list, me);
+
+    if (IS_USED(MODULE_CORE_SMP)) {
+        _fence();
+        if (retry(mbox, msg)) {
+            list_remove(wait_list, (list_node_t *)&me->rq_entry);
+            sched_set_status(me, STATUS_RUNNING);
+            irq_restore(irqstate);
+            return true;
+        }
+    }
+
     irq_restore(irqstate);
     thread_yield();
 
     DEBUG("mbox: Thread %" PRIkernel_pid " _wait(): woke up.\n",
           thread_getpid());
+    return false;
 }
 
-int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
+static bool _retry_put(mbox_t *mbox, msg_t *msg)
 {
+    return _try_put(mbox, msg);
+}
+
+/* Hand the oldest queued message over to a waiting reader. Called after
+ * putting a message without disabling interrupts, as a reader may have
+ * started waiting while it was being copied in. */
+static void _hand_over(mbox_t *mbox)
+{
+    if (!_waiting(&mbox->readers)) {
+        return;
+    }
+
     unsigned irqstate = irq_disable();
 
-    list_node_t *next = list_remove_head(&mbox->readers);
+    if (mbox->readers.next) {
+        msg_t msg;
+        if (_try_get(mbox, &msg)) {
+            list_node_t *next = list_remove_head(&mbox->readers);
+            thread_t *thread =
+                container_of((clist_node_t *)next, thread_t, rq_entry);
+            *(msg_t *)thread->wait_data = msg;
+            _wake_waiter(thread, irqstate);
+            return;
+        }
+    }
+    irq_restore(irqstate);
+}
+
+/* Wake a writer waiting for room. Called after getting a message without
+ * disabling interrupts. */
+static void _wake_writer(mbox_t *mbox)
+{
+    if (!_waiting(&mbox->writers)) {
+        return;
+    }
+
+    unsigned irqstate = irq_disable();
+    list_node_t *next = list_remove_head(&mbox->writers);
 
     if (next) {
-        DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _tryput(): "
-              "there's a waiter.\n", thread_getpid(), (unsigned)mbox);
-        thread_t *thread =
-            container_of((clist_node_t *)next, thread_t, rq_entry);
-        *(msg_t *)thread->wait_data = *msg;
+        thread_t *thread = container_of((clist_node_t *)next, thread_t,
+                                        rq_entry);
         _wake_waiter(thread, irqstate);
-        return 1;
     }
     else {
-        while (cib_full(&mbox->cib)) {
-            if (blocking) {
-                _wait(&mbox->writers, irqstate);
-                irqstate = irq_disable();
-            }
-            else {
-                irq_restore(irqstate);
-                return 0;
-            }
-        }
-
-        DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _tryput(): "
-              "queued message.\n", thread_getpid(), (unsigned)mbox);
-        msg->sender_pid = thread_getpid();
-        /* copy msg into queue */
-        mbox->msg_array[cib_put_unsafe(&mbox->cib)] = *msg;
         irq_restore(irqstate);
-        return 1;
     }
 }
 
-int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
+int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
 {
+    _prepare_slots(mbox);
+    msg->sender_pid = _sender_pid();
+
+    /* fast path: no reader to hand the message to */
+    if (!_waiting(&mbox->readers)) {
+        if (_try_put(mbox, msg)) {
+            DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _tryput(): "
+                  "queued message.\n", thread_getpid(), (unsigned)mbox);
+            _hand_over(mbox);
+            return 1;
+        }
+        if (!blocking && !_waiting(&mbox->readers)) {
+            return 0;
+        }
+    }
+
     unsigned irqstate = irq_disable();
 
-    if (cib_avail(&mbox->cib)) {
-        DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _tryget(): "
-              "got queued message.\n", thread_getpid(), (unsigned)mbox);
-        /* copy msg from queue */
-        *msg = mbox->msg_array[cib_get_unsafe(&mbox->cib)];
-        list_node_t *next = list_remove_head(&mbox->writers);
+    while (1) {
+        list_node_t *next = list_remove_head(&mbox->readers);
+
         if (next) {
-            thread_t *thread = container_of((clist_node_t *)next, thread_t,
-                                            rq_entry);
+            DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _tryput(): "
+                  "there's a waiter.\n", thread_getpid(), (unsigned)mbox);
+            thread_t *thread =
+                container_of((clist_node_t *)next, thread_t, rq_entry);
+            *(msg_t *)thread->wait_data = *msg;
             _wake_waiter(thread, irqstate);
+            return 1;
         }
-        else {
+
+        if (_try_put(mbox, msg)) {
+            DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _tryput(): "
+                  "queued message.\n", thread_getpid(), (unsigned)mbox);
+            irq_restore(irqstate);
+            return 1;
+        }
+
+        if (!blocking) {
             irq_restore(irqstate);
+            return 0;
+        }
+        if (_wait(mbox, &mbox->writers, msg, _retry_put, irqstate)) {
+            return 1;
         }
+        irqstate = irq_disable();
+    }
+}
+
+int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
+{
+    _prepare_slots(mbox);
+    /* fast path: a message is queued */
+    if (_try_get(mbox, msg)) {
+        DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08x: _tryget(): "
+              "got queued message.\n", thread_getpid(), (unsigned)mbox);
+        _wake_writer(mbox);
         return 1;
     }
     else if (blocking) {
+        unsigned irqstate = irq_disable();
+
+        if (_try_get(mbox, msg)) {
+            irq_restore(irqstate);
+            _wake_writer(mbox);
+            return 1;
+        }
+
         thread_get_active()->wait_data = msg;
-        _wait(&mbox->readers, irqstate);
-        /* sender has copied message */
+        if (_wait(mbox, &mbox->readers, msg, _try_get, irqstate)) {
+            _wake_writer(mbox);
+        }
+        /* otherwise, the sender has copied the message */
         return 1;
     }
     else {
-        irq_restore(irqstate);
         return 0;
     }
 }
@@ -33,11 +33,22 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#ifdef MODULE_TRACE_HOOKS
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 static int _msg_receive(msg_t *m, int block);
+
+#ifdef MODULE_TRACE_HOOKS
+static inline void _trace_msg(trace_event_type_t type, kernel_pid_t pid,
+                              const msg_t *m)
+{
+    trace_hook(type, ((uint32_t)(uint16_t)pid << 16) | m->type);
+}
+#endif
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
@@ -102,6 +113,10 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+#ifdef MODULE_TRACE_HOOKS
+    _trace_msg(TRACE_EVENT_MSG_SEND, target_pid, m);
+#endif
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -206,6 +221,10 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+#ifdef MODULE_TRACE_HOOKS
+    _trace_msg(TRACE_EVENT_MSG_SEND, target_pid, m);
+#endif
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -339,12 +358,28 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
+#ifdef MODULE_TRACE_HOOKS
+    int res = _msg_receive(m, 0);
+
+    if (res == 1) {
+        _trace_msg(TRACE_EVENT_MSG_RECV, m->sender_pid, m);
+    }
+    return res;
+#else
     return _msg_receive(m, 0);
+#endif
 }
 
 int msg_receive(msg_t *m)
 {
+#ifdef MODULE_TRACE_HOOKS
+    int res = _msg_receive(m, 1);
+
+    _trace_msg(TRACE_EVENT_MSG_RECV, m->sender_pid, m);
+    return res;
+#else
     return _msg_receive(m, 1);
+#endif
 }
 
 static int _msg_receive(msg_t *m, int block)
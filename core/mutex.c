@@ -29,12 +29,100 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#ifdef MODULE_TRACE_HOOKS
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 #if MAXTHREADS > 1
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+/**
+ * @brief   Priority of @p thread without any inherited priority
+ */
+static inline uint8_t _pi_base(thread_t *thread)
+{
+    return (thread->mutex_base_priority != UINT8_MAX)
+           ? thread->mutex_base_priority : thread->priority;
+}
+
+/**
+ * @brief   Priority @p thread has to run at: @p base or the priority of the
+ *          most important thread waiting for a mutex it owns
+ */
+static uint8_t _pi_priority(thread_t *thread, uint8_t base)
+{
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *waiter = thread_get(pid);
+        mutex_t *mutex;
+
+        if (waiter && (waiter->status == STATUS_MUTEX_BLOCKED)
+            && ((mutex = waiter->mutex_blocked) != NULL)
+            && (mutex->owner == thread->pid) && (waiter->priority < base)) {
+            base = waiter->priority;
+        }
+    }
+    return base;
+}
+
+/**
+ * @brief   Update the inherited priority of @p thread and follow the chain of
+ *          owners if @p thread is itself blocked on a mutex
+ * @pre     IRQs are disabled
+ */
+static void _pi_update(thread_t *thread)
+{
+    /* a deadlock would make the chain a cycle, so bound the walk */
+    for (unsigned i = 0; (thread != NULL) && (i < MAXTHREADS); i++) {
+        uint8_t base = _pi_base(thread);
+        uint8_t priority = _pi_priority(thread, base);
+
+        if (priority == thread->priority) {
+            return;
+        }
+        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
+              ": %u --> %u\n", thread_getpid(), thread->pid,
+              (unsigned)thread->priority, (unsigned)priority);
+        thread->mutex_base_priority = (priority == base) ? UINT8_MAX : base;
+        sched_change_priority(thread, priority);
+
+        mutex_t *mutex = thread->mutex_blocked;
+        if (mutex == NULL) {
+            return;
+        }
+        /* keep the wait queue sorted and pass the change on to the owner */
+        list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry);
+        thread_add_to_list(&mutex->queue, thread);
+        thread = thread_get(mutex->owner);
+    }
+}
+
+/**
+ * @brief   Record @p thread as owner of @p mutex
+ */
+static inline void _pi_acquire(mutex_t *mutex, thread_t *thread)
+{
+    mutex->owner = thread->pid;
+}
+
+/**
+ * @brief   Drop the ownership of @p mutex and restore the priority of the
+ *          previous owner
+ * @pre     IRQs are disabled
+ */
+static void _pi_release(mutex_t *mutex)
+{
+    thread_t *owner = thread_get(mutex->owner);
+
+    mutex->owner = KERNEL_PID_UNDEF;
+    if (owner && (owner->mutex_base_priority != UINT8_MAX)) {
+        _pi_update(owner);
+    }
+}
+#endif
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -67,14 +155,13 @@ static inline __attribute__((always_inline)) void _block(mutex_t *mutex,
     }
 
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    me->mutex_blocked = mutex;
     thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority > me->priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio of %" PRIkernel_pid
-              ": %u --> %u\n",
-              thread_getpid(), mutex->owner,
-              (unsigned)owner->priority, (unsigned)me->priority);
-        sched_change_priority(owner, me->priority);
-    }
+    _pi_update(owner);
+#endif
+
+#ifdef MODULE_TRACE_HOOKS
+    trace_hook(TRACE_EVENT_MUTEX_BLOCK, (uintptr_t)mutex);
 #endif
 
     irq_restore(irq_state);
@@ -93,9 +180,7 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-        thread_t *me = thread_get_active();
-        mutex->owner = me->pid;
-        mutex->owner_original_priority = me->priority;
+        _pi_acquire(mutex, thread_get_active());
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
@@ -109,6 +194,9 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
         _block(mutex, irq_state);
     }
 
+#ifdef MODULE_TRACE_HOOKS
+    trace_hook(TRACE_EVENT_MUTEX_LOCK, (uintptr_t)mutex);
+#endif
     return true;
 }
 
@@ -132,13 +220,14 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-        thread_t *me = thread_get_active();
-        mutex->owner = me->pid;
-        mutex->owner_original_priority = me->priority;
+        _pi_acquire(mutex, thread_get_active());
 #endif
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
+#ifdef MODULE_TRACE_HOOKS
+        trace_hook(TRACE_EVENT_MUTEX_LOCK, (uintptr_t)mutex);
+#endif
         return 0;
     }
     else {
@@ -146,8 +235,12 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
         if (mc->cancelled) {
             DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() "
                   "cancelled.\n", thread_getpid());
+            return -ECANCELED;
         }
-        return (mc->cancelled) ? -ECANCELED : 0;
+#ifdef MODULE_TRACE_HOOKS
+        trace_hook(TRACE_EVENT_MUTEX_LOCK, (uintptr_t)mutex);
+#endif
+        return 0;
     }
 }
 
@@ -164,8 +257,15 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+#ifdef MODULE_TRACE_HOOKS
+    trace_hook(TRACE_EVENT_MUTEX_UNLOCK, (uintptr_t)mutex);
+#endif
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        _pi_release(mutex);
+#endif
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
         return;
@@ -186,13 +286,10 @@ void mutex_unlock(mutex_t *mutex)
     uint16_t process_priority = process->priority;
 
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
-    thread_t *owner = thread_get(mutex->owner);
-    if ((owner) && (owner->priority != mutex->owner_original_priority)) {
-        DEBUG("PID[%" PRIkernel_pid "] prio %u --> %u\n",
-              owner->pid,
-              (unsigned)owner->priority, (unsigned)owner->priority);
-        sched_change_priority(owner, mutex->owner_original_priority);
-    }
+    /* hand the mutex over to the woken thread */
+    process->mutex_blocked = NULL;
+    _pi_release(mutex);
+    _pi_acquire(mutex, process);
 #endif
 
     irq_restore(irqstate);
@@ -206,8 +303,14 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+#ifdef MODULE_TRACE_HOOKS
+        trace_hook(TRACE_EVENT_MUTEX_UNLOCK, (uintptr_t)mutex);
+#endif
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            _pi_release(mutex);
+#endif
         }
         else {
             list_node_t *next = list_remove_head(&mutex->queue);
@@ -219,6 +322,11 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+            process->mutex_blocked = NULL;
+            _pi_release(mutex);
+            _pi_acquire(mutex, process);
+#endif
         }
     }
 
@@ -252,6 +360,12 @@ void mutex_cancel(mutex_cancel_t *mc)
         if (mutex->queue.next == NULL) {
             mutex->queue.next = MUTEX_LOCKED;
         }
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+        /* the owner no longer inherits the priority of the thread */
+        thread->mutex_blocked = NULL;
+        thread_t *owner = thread_get(mutex->owner);
+        _pi_update(owner);
+#endif
         sched_set_status(thread, STATUS_PENDING);
         irq_restore(irq_state);
         sched_switch(thread->priority);
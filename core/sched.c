@@ -36,6 +36,18 @@
 #include "mpu.h"
 #endif
 
+#ifdef MODULE_TRACE_HOOKS
+#include "trace.h"
+#endif
+
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+#include "schedstatistics.h"
+#endif
+
+#ifdef MODULE_SCHED_EDF
+#include "sched_edf.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -56,7 +68,9 @@
  * @brief   Symbols also used by OpenOCD, keep in sync with src/rtos/riot.c
  * @{
  */
+#ifndef MODULE_CORE_SMP
 volatile kernel_pid_t sched_active_pid = KERNEL_PID_UNDEF;
+#endif
 volatile thread_t *sched_threads[KERNEL_PID_LAST + 1];
 volatile int sched_num_threads = 0;
 
@@ -73,11 +87,81 @@ const uint8_t _tcb_name_offset = offsetof(thread_t, name);
 #endif
 /** @} */
 
-volatile thread_t *sched_active_thread;
 volatile unsigned int sched_context_switch_request;
 
+#ifdef MODULE_CORE_SMP
+/* KERNEL_PID_UNDEF is 0, no initializer needed */
+volatile kernel_pid_t sched_active_pids[SMP_CORE_NUMOF];
+volatile thread_t *sched_active_threads[SMP_CORE_NUMOF];
+clist_node_t sched_core_runqueues[SMP_CORE_NUMOF][SCHED_PRIO_LEVELS];
+#define SCHED_CORE_NUMOF    SMP_CORE_NUMOF
+#else
+volatile thread_t *sched_active_thread;
 clist_node_t sched_runqueues[SCHED_PRIO_LEVELS];
-static uint32_t runqueue_bitcache = 0;
+#define SCHED_CORE_NUMOF    1
+#endif
+
+static uint32_t runqueue_bitcache[SCHED_CORE_NUMOF];
+
+/* Without core_smp, these accessors always refer to the single core 0 */
+static inline unsigned _this_core(void)
+{
+#ifdef MODULE_CORE_SMP
+    return smp_core_id();
+#else
+    return 0;
+#endif
+}
+
+static inline unsigned _thread_core(const thread_t *thread)
+{
+#ifdef MODULE_CORE_SMP
+    return thread->core;
+#else
+    (void)thread;
+    return 0;
+#endif
+}
+
+static inline clist_node_t *_runqueues(unsigned core)
+{
+#ifdef MODULE_CORE_SMP
+    return sched_core_runqueues[core];
+#else
+    (void)core;
+    return sched_runqueues;
+#endif
+}
+
+static inline thread_t *_active_thread(unsigned core)
+{
+#ifdef MODULE_CORE_SMP
+    return (thread_t *)sched_active_threads[core];
+#else
+    (void)core;
+    return (thread_t *)sched_active_thread;
+#endif
+}
+
+static inline void _set_active_thread(unsigned core, thread_t *thread)
+{
+#ifdef MODULE_CORE_SMP
+    sched_active_threads[core] = thread;
+#else
+    (void)core;
+    sched_active_thread = thread;
+#endif
+}
+
+static inline void _set_active_pid(unsigned core, kernel_pid_t pid)
+{
+#ifdef MODULE_CORE_SMP
+    sched_active_pids[core] = pid;
+#else
+    (void)core;
+    sched_active_pid = pid;
+#endif
+}
 
 #ifdef MODULE_SCHED_CB
 static void (*sched_cb)(kernel_pid_t active_thread,
@@ -91,33 +175,235 @@ static void (*sched_cb)(kernel_pid_t active_thread,
  * and readout away, switching between the two orders depending on the CLZ
  * instruction availability
  */
-static inline void _set_runqueue_bit(uint8_t priority)
+static inline void _set_runqueue_bit(unsigned core, uint8_t priority)
 {
 #if defined(BITARITHM_HAS_CLZ)
-    runqueue_bitcache |= BIT31 >> priority;
+    runqueue_bitcache[core] |= BIT31 >> priority;
 #else
-    runqueue_bitcache |= 1UL << priority;
+    runqueue_bitcache[core] |= 1UL << priority;
 #endif
 }
 
-static inline void _clear_runqueue_bit(uint8_t priority)
+static inline void _clear_runqueue_bit(unsigned core, uint8_t priority)
 {
 #if defined(BITARITHM_HAS_CLZ)
-    runqueue_bitcache &= ~(BIT31 >> priority);
+    runqueue_bitcache[core] &= ~(BIT31 >> priority);
 #else
-    runqueue_bitcache &= ~(1UL << priority);
+    runqueue_bitcache[core] &= ~(1UL << priority);
 #endif
 }
 
-static inline unsigned _get_prio_queue_from_runqueue(void)
+static inline unsigned _get_prio_queue_from_runqueue(unsigned core)
 {
 #if defined(BITARITHM_HAS_CLZ)
-    return 31 - bitarithm_msb(runqueue_bitcache);
+    return 31 - bitarithm_msb(runqueue_bitcache[core]);
+#else
+    return bitarithm_lsb(runqueue_bitcache[core]);
+#endif
+}
+
+#ifdef MODULE_CORE_SMP
+/* true if the thread is the active thread of its core, i.e. it is running or
+ * it blocked and did not switch out yet */
+static inline bool _smp_is_active(const thread_t *thread)
+{
+    return sched_active_threads[thread->core] == thread;
+}
+
+/* priority of the most important thread queued on a core */
+static inline unsigned _smp_core_prio(unsigned core)
+{
+    return runqueue_bitcache[core] ? _get_prio_queue_from_runqueue(core)
+                                   : SCHED_PRIO_LEVELS;
+}
+
+/* Pick the allowed core with the least important work for a thread that
+ * becomes runnable, preferring the core it ran on last */
+static unsigned _smp_place(thread_t *thread)
+{
+    if (_smp_is_active(thread)) {
+        /* its context is not saved yet, it must resume on its core */
+        return thread->core;
+    }
+
+    unsigned best = thread->core;
+    int best_prio = (thread->affinity & (1U << best))
+                    ? (int)_smp_core_prio(best) : -1;
+
+    for (unsigned core = 0; core < SMP_CORE_NUMOF; core++) {
+        if ((thread->affinity & (1U << core))
+            && ((int)_smp_core_prio(core) > best_prio)) {
+            best = core;
+            best_prio = _smp_core_prio(core);
+        }
+    }
+
+    thread->core = best;
+    return best;
+}
+
+/* Most important thread queued on core @p other below priority @p limit that
+ * core @p core may take over */
+static thread_t *_smp_find(unsigned other, unsigned core, unsigned limit)
+{
+    for (unsigned prio = 0; prio < limit; prio++) {
+        clist_node_t *last = sched_core_runqueues[other][prio].next;
+        if (!last) {
+            continue;
+        }
+        clist_node_t *node = last;
+        do {
+            node = node->next;
+            thread_t *thread = container_of(node, thread_t, rq_entry);
+            if ((thread->affinity & (1U << core)) && !_smp_is_active(thread)) {
+                return thread;
+            }
+        } while (node != last);
+    }
+    return NULL;
+}
+
+/* Migrate the most important thread waiting on another core to this core if
+ * it is more important than @p nextrq, the best choice of this core. Returns
+ * the run queue to pick the next thread from. */
+static unsigned _smp_pull(unsigned core, unsigned nextrq)
+{
+    thread_t *best = NULL;
+
+    for (unsigned other = 0; other < SMP_CORE_NUMOF; other++) {
+        if (other == core) {
+            continue;
+        }
+        thread_t *thread = _smp_find(other, core,
+                                     best ? best->priority : nextrq);
+        if (thread) {
+            best = thread;
+        }
+    }
+
+    if (!best) {
+        return nextrq;
+    }
+
+    DEBUG("sched_run: core %u pulls thread %" PRIkernel_pid " from core %u\n",
+          core, best->pid, (unsigned)best->core);
+
+    clist_node_t *rq = &sched_core_runqueues[best->core][best->priority];
+    clist_remove(rq, &best->rq_entry);
+    if (!rq->next) {
+        _clear_runqueue_bit(best->core, best->priority);
+    }
+    best->core = core;
+    clist_rpush(&sched_core_runqueues[core][best->priority], &best->rq_entry);
+    _set_runqueue_bit(core, best->priority);
+
+    return best->priority;
+}
+
+/* Notify an allowed core running less important work than a thread that was
+ * just preempted, so that it pulls the thread */
+static void _smp_offer(thread_t *thread, unsigned core)
+{
+    for (unsigned other = 0; other < SMP_CORE_NUMOF; other++) {
+        thread_t *active = _active_thread(other);
+        if ((other != core) && (thread->affinity & (1U << other))
+            && (!active || (active->priority > thread->priority))) {
+            smp_arch_core_notify(other);
+            return;
+        }
+    }
+}
+#endif
+
+#ifdef MODULE_SCHED_EDF
+/* A thread at the EDF level that did not join the EDF class was lifted there
+ * by priority inheritance. It holds a mutex an EDF thread waits for, so it is
+ * sorted before all deadlines. */
+static inline bool _edf_boosted(const thread_t *thread)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    return thread->mutex_base_priority != UINT8_MAX;
 #else
-    return bitarithm_lsb(runqueue_bitcache);
+    (void)thread;
+    return false;
 #endif
 }
 
+static inline bool _edf_before(const thread_t *a, const thread_t *b)
+{
+    if (_edf_boosted(a) || _edf_boosted(b)) {
+        return !_edf_boosted(b);
+    }
+    return (int32_t)(a->deadline - b->deadline) < 0;
+}
+
+static inline thread_t *_edf_thread(clist_node_t *node)
+{
+    return container_of(node, thread_t, rq_entry);
+}
+
+/* The run queue of the EDF level is kept sorted by deadline, except for its
+ * head: the core expects the running thread to stay at the head of its run
+ * queue, so a thread with an earlier deadline is queued right behind it.
+ * _edf_select() restores the order when the scheduler runs. */
+static void _edf_push(thread_t *thread)
+{
+    clist_node_t *rq = &sched_runqueues[CONFIG_SCHED_EDF_PRIO];
+    clist_node_t *last = rq->next;
+
+    if (last != NULL) {
+        clist_node_t *prev = last;
+        clist_node_t *node = last->next;
+        thread_t *active = thread_get_active();
+        bool skip = (active != NULL) && (node == &active->rq_entry);
+
+        do {
+            if (!skip && _edf_before(thread, _edf_thread(node))) {
+                thread->rq_entry.next = node;
+                prev->next = &thread->rq_entry;
+                return;
+            }
+            skip = false;
+            prev = node;
+            node = node->next;
+        } while (prev != last);
+    }
+    clist_rpush(rq, &thread->rq_entry);
+}
+
+/* true if the thread at the head of the EDF run queue is to be preempted */
+static bool _edf_preempt(void)
+{
+    clist_node_t *head = sched_runqueues[CONFIG_SCHED_EDF_PRIO].next->next;
+
+    return (head->next != head)
+           && _edf_before(_edf_thread(head->next), _edf_thread(head));
+}
+
+static void _edf_select(void)
+{
+    if (_edf_preempt()) {
+        _edf_push(_edf_thread(clist_lpop(&sched_runqueues[CONFIG_SCHED_EDF_PRIO])));
+    }
+}
+
+void sched_runq_advance(uint8_t prio)
+{
+    clist_node_t *rq = &sched_runqueues[prio];
+
+    if (prio != CONFIG_SCHED_EDF_PRIO) {
+        clist_lpoprpush(rq);
+        return;
+    }
+    /* rotating would break the order by deadline: re-insert the first
+     * thread, which then runs again if its deadline is still the earliest */
+    clist_node_t *head = clist_lpop(rq);
+    if (head != NULL) {
+        _edf_push(_edf_thread(head));
+    }
+}
+#endif
+
 static void _unschedule(thread_t *active_thread)
 {
     if (active_thread->status == STATUS_RUNNING) {
@@ -146,10 +432,11 @@ static void _unschedule(thread_t *active_thread)
 
 thread_t *__attribute__((used)) sched_run(void)
 {
-    thread_t *active_thread = thread_get_active();
+    unsigned core = _this_core();
+    thread_t *active_thread = _active_thread(core);
     thread_t *previous_thread = active_thread;
 
-    if (!IS_USED(MODULE_CORE_IDLE_THREAD) && !runqueue_bitcache) {
+    if (!IS_USED(MODULE_CORE_IDLE_THREAD) && !runqueue_bitcache[core]) {
         if (active_thread) {
             _unschedule(active_thread);
             active_thread = NULL;
@@ -157,13 +444,24 @@ thread_t *__attribute__((used)) sched_run(void)
 
         do {
             sched_arch_idle();
-        } while (!runqueue_bitcache);
+        } while (!runqueue_bitcache[core]);
     }
 
-    sched_context_switch_request = 0;
+    /* only core 0 handles interrupts, see core_smp */
+    if (core == 0) {
+        sched_context_switch_request = 0;
+    }
 
-    unsigned nextrq = _get_prio_queue_from_runqueue();
-    thread_t *next_thread = container_of(sched_runqueues[nextrq].next->next,
+    unsigned nextrq = _get_prio_queue_from_runqueue(core);
+#ifdef MODULE_CORE_SMP
+    nextrq = _smp_pull(core, nextrq);
+#endif
+#ifdef MODULE_SCHED_EDF
+    if (nextrq == CONFIG_SCHED_EDF_PRIO) {
+        _edf_select();
+    }
+#endif
+    thread_t *next_thread = container_of(_runqueues(core)[nextrq].next->next,
                                          thread_t, rq_entry);
 
 #if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK))
@@ -196,10 +494,21 @@ thread_t *__attribute__((used)) sched_run(void)
     else {
         if (active_thread) {
             _unschedule(active_thread);
+#ifdef MODULE_CORE_SMP
+            if (active_thread->status == STATUS_PENDING) {
+                _smp_offer(active_thread, core);
+            }
+#endif
         }
 
-        sched_active_pid = next_thread->pid;
-        sched_active_thread = next_thread;
+        _set_active_pid(core, next_thread->pid);
+        _set_active_thread(core, next_thread);
+
+#ifdef MODULE_TRACE_HOOKS
+        trace_hook(TRACE_EVENT_SCHED_SWITCH,
+                   (previous_thread) ? (uint32_t)previous_thread->pid
+                                     : (uint32_t)KERNEL_PID_UNDEF);
+#endif
 
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
@@ -229,10 +538,33 @@ thread_t *__attribute__((used)) sched_run(void)
  */
 static inline __attribute__((always_inline)) void _runqueue_push(thread_t *thread, uint8_t priority)
 {
+#ifdef MODULE_CORE_SMP
+    unsigned core = _smp_place(thread);
+#else
+    unsigned core = 0;
+#endif
+
     DEBUG("sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu8 ".\n",
           thread->pid, priority);
-    clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));
-    _set_runqueue_bit(priority);
+#ifdef MODULE_SCHED_EDF
+    if (priority == CONFIG_SCHED_EDF_PRIO) {
+        _edf_push(thread);
+    }
+    else {
+        clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));
+    }
+#else
+    clist_rpush(&_runqueues(core)[priority], &(thread->rq_entry));
+#endif
+    _set_runqueue_bit(core, priority);
+
+#ifdef MODULE_CORE_SMP
+    /* a thread preempting on this core is handled by sched_switch() */
+    thread_t *active = _active_thread(core);
+    if ((core != smp_core_id()) && (!active || (active->priority > priority))) {
+        smp_arch_core_notify(core);
+    }
+#endif
 
     /* some thread entered a runqueue
      * if it is the active runqueue
@@ -252,10 +584,18 @@ static inline __attribute__((always_inline)) void _runqueue_pop(thread_t *thread
 {
     DEBUG("sched_set_status: removing thread %" PRIkernel_pid " from runqueue %" PRIu8 ".\n",
           thread->pid, thread->priority);
-    clist_lpop(&sched_runqueues[thread->priority]);
+    unsigned core = _thread_core(thread);
+    clist_node_t *rq = &_runqueues(core)[thread->priority];
 
-    if (!sched_runqueues[thread->priority].next) {
-        _clear_runqueue_bit(thread->priority);
+#ifdef MODULE_CORE_SMP
+    /* the thread is not necessarily the active thread of its core */
+    clist_remove(rq, &thread->rq_entry);
+#else
+    clist_lpop(rq);
+#endif
+
+    if (!rq->next) {
+        _clear_runqueue_bit(core, thread->priority);
 #if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK))
         sched_runq_callback(thread->priority);
 #endif
@@ -267,6 +607,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             _runqueue_push(process, process->priority);
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+            sched_statistics_wakeup(process->pid);
+#endif
         }
     }
     else {
@@ -289,6 +632,20 @@ void sched_switch(uint16_t other_prio)
           active_thread->pid, current_prio, on_runqueue,
           other_prio);
 
+#ifdef MODULE_CORE_SMP
+    /* the other thread may have been queued on another core, which was
+     * notified: only this core's run queues matter here */
+    other_prio = _smp_core_prio(smp_core_id());
+#endif
+
+#ifdef MODULE_SCHED_EDF
+    /* within the EDF level, the earliest deadline preempts */
+    if (on_runqueue && (current_prio == CONFIG_SCHED_EDF_PRIO)
+        && (other_prio == CONFIG_SCHED_EDF_PRIO) && _edf_preempt()) {
+        on_runqueue = 0;
+    }
+#endif
+
     if (!on_runqueue || (current_prio > other_prio)) {
         if (irq_is_in()) {
             DEBUG("sched_switch: setting sched_context_switch_request.\n");
@@ -315,13 +672,20 @@ NORETURN void sched_task_exit(void)
     print_stack_usage_metric(me->name, me->stack_start, me->stack_size);
 #endif
 
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE)
+    /* the cached blocks would otherwise stay allocated until a new thread
+     * with the same PID reuses them */
+    void malloc_thread_cache_flush(void);
+    malloc_thread_cache_flush();
+#endif
+
     (void)irq_disable();
     sched_threads[thread_getpid()] = NULL;
     sched_num_threads--;
 
     sched_set_status(thread_get_active(), STATUS_STOPPED);
 
-    sched_active_thread = NULL;
+    _set_active_thread(_this_core(), NULL);
     cpu_switch_context_exit();
 }
 
@@ -348,6 +712,13 @@ void sched_change_priority(thread_t *thread, uint8_t priority)
     }
     thread->priority = priority;
 
+#ifdef MODULE_CORE_SMP
+    /* a thread running on another core is rescheduled there */
+    if (_smp_is_active(thread) && (thread->core != smp_core_id())) {
+        smp_arch_core_notify(thread->core);
+    }
+#endif
+
     irq_restore(irq_state);
 
     thread_t *active = thread_get_active();
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_smp
+ * @{
+ *
+ * @file
+ * @brief       Kernel lock and start of the secondary cores
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "smp.h"
+
+#if defined(MODULE_SCHED_EDF) || defined(MODULE_SCHED_RUNQ_CALLBACK)
+#error "core_smp does not support scheduler extensions that assume a single run queue"
+#endif
+
+static_assert(SMP_CORE_NUMOF <= 8, "thread_t::affinity holds at most 8 cores");
+
+static spinlock_t _kernel_lock = SPINLOCK_INIT;
+
+void smp_kernel_lock(void)
+{
+    spinlock_lock(&_kernel_lock);
+}
+
+void smp_kernel_unlock(void)
+{
+    spinlock_unlock(&_kernel_lock);
+}
+
+void smp_cores_start(void)
+{
+    /* the boot core holds the kernel lock while its interrupts are disabled,
+     * unless they were never enabled so far */
+    (void)spinlock_trylock(&_kernel_lock);
+
+    for (unsigned core = 1; core < SMP_CORE_NUMOF; core++) {
+        smp_arch_core_start(core);
+    }
+}
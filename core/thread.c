@@ -31,6 +31,13 @@
 
 #include "bitarithm.h"
 #include "sched.h"
+#if IS_USED(MODULE_CORE_THREAD_STATIC)
+#include "thread_static.h"
+#include "xfa.h"
+#endif
+#ifdef MODULE_SCHED_EDF
+#include "sched_edf.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -188,42 +195,13 @@ uintptr_t thread_measure_stack_free(const char *stack)
     return space_free;
 }
 
-kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
-                           int flags, thread_task_func_t function, void *arg,
-                           const char *name)
+/* Prepares the stack of @p thread, returns the usable stack size */
+static int _thread_stack_prepare(thread_t *thread, char *stack, int stacksize,
+                                 int flags)
 {
-    if (priority >= SCHED_PRIO_LEVELS) {
-        return -EINVAL;
-    }
-
-#ifdef DEVELHELP
-    int total_stacksize = stacksize;
-#endif
-#ifndef CONFIG_THREAD_NAMES
-    (void)name;
-#endif
-
-    /* align the stack on a 16/32bit boundary */
-    uintptr_t misalignment = (uintptr_t)stack % alignof(void *);
-    if (misalignment) {
-        misalignment = alignof(void *) - misalignment;
-        stack += misalignment;
-        stacksize -= misalignment;
-    }
-
-    /* make room for the thread control block */
-    stacksize -= sizeof(thread_t);
-
-    /* round down the stacksize to a multiple of thread_t alignments (usually 16/32bit) */
-    stacksize -= stacksize % alignof(thread_t);
-
-    if (stacksize < 0) {
-        DEBUG("thread_create: stacksize is too small!\n");
-    }
-    /* allocate our thread control block at the top of our stackspace. Cast to
-     * (uintptr_t) intermediately to silence -Wcast-align. (We manually made
-     * sure alignment is correct above.) */
-    thread_t *thread = (thread_t *)(uintptr_t)(stack + stacksize);
+    (void)thread;
+    (void)stack;
+    (void)flags;
 
 #ifdef PICOLIBC_TLS
     stacksize -= _tls_size();
@@ -236,7 +214,7 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     || defined(MODULE_TEST_UTILS_PRINT_STACK_USAGE)
     if (flags & THREAD_CREATE_STACKTEST) {
         /* assign each int of the stack the value of it's address. Alignment
-         * has been handled above, so silence -Wcast-align */
+         * has been handled by the caller, so silence -Wcast-align */
         uintptr_t *stackmax = (uintptr_t *)(uintptr_t)(stack + stacksize);
         uintptr_t *stackp = (uintptr_t *)(uintptr_t)stack;
 
@@ -246,28 +224,40 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
         }
     }
     else {
-        /* create stack guard. Alignment has been handled above, so silence
-         * -Wcast-align */
+        /* create stack guard. Alignment has been handled by the caller, so
+         * silence -Wcast-align */
         *(uintptr_t *)(uintptr_t)stack = (uintptr_t)stack;
     }
 #endif
 
-    unsigned state = irq_disable();
+    return stacksize;
+}
 
-    kernel_pid_t pid = KERNEL_PID_UNDEF;
-    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; ++i) {
+/* Returns the first free PID not below @p first, interrupts are disabled */
+static kernel_pid_t _thread_pid_alloc(kernel_pid_t first)
+{
+    for (kernel_pid_t i = first; i <= KERNEL_PID_LAST; ++i) {
         if (sched_threads[i] == NULL) {
-            pid = i;
-            break;
+            return i;
         }
     }
-    if (pid == KERNEL_PID_UNDEF) {
-        DEBUG("thread_create(): too many threads!\n");
 
-        irq_restore(state);
+    DEBUG("thread_create(): too many threads!\n");
+    return KERNEL_PID_UNDEF;
+}
 
-        return -EOVERFLOW;
-    }
+/* Registers @p thread as @p pid and initializes it, interrupts are disabled */
+static void _thread_init(thread_t *thread, kernel_pid_t pid,
+                         char *stack, int stacksize, int total_stacksize,
+                         uint8_t priority, int flags,
+                         thread_task_func_t function, void *arg,
+                         const char *name)
+{
+    (void)total_stacksize;
+    (void)flags;
+#ifndef CONFIG_THREAD_NAMES
+    (void)name;
+#endif
 
     sched_threads[pid] = thread;
 
@@ -291,6 +281,23 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     thread->rq_entry.next = NULL;
 
+#ifdef MODULE_SCHED_EDF
+    thread->deadline = 0;
+#endif
+
+#ifdef MODULE_CORE_SMP
+    thread->affinity = (flags >> 8) & SMP_CORE_MASK;
+    if (!thread->affinity) {
+        thread->affinity = SMP_CORE_MASK;
+    }
+    thread->core = bitarithm_lsb(thread->affinity);
+#endif
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->mutex_blocked = NULL;
+    thread->mutex_base_priority = UINT8_MAX;
+#endif
+
 #ifdef MODULE_CORE_MSG
     thread->wait_data = NULL;
     thread->msg_waiters.next = NULL;
@@ -302,6 +309,57 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
 
     DEBUG("Created thread %s. PID: %" PRIkernel_pid ". Priority: %u.\n", name,
           thread->pid, priority);
+}
+
+kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
+                           int flags, thread_task_func_t function, void *arg,
+                           const char *name)
+{
+    if (priority >= SCHED_PRIO_LEVELS) {
+        return -EINVAL;
+    }
+#ifdef MODULE_SCHED_EDF
+    /* only threads that joined the EDF class run at its priority */
+    assert(priority != CONFIG_SCHED_EDF_PRIO);
+#endif
+
+    int total_stacksize = stacksize;
+
+    /* align the stack on a 16/32bit boundary */
+    uintptr_t misalignment = (uintptr_t)stack % alignof(void *);
+    if (misalignment) {
+        misalignment = alignof(void *) - misalignment;
+        stack += misalignment;
+        stacksize -= misalignment;
+    }
+
+    /* make room for the thread control block */
+    stacksize -= sizeof(thread_t);
+
+    /* round down the stacksize to a multiple of thread_t alignments (usually 16/32bit) */
+    stacksize -= stacksize % alignof(thread_t);
+
+    if (stacksize < 0) {
+        DEBUG("thread_create: stacksize is too small!\n");
+    }
+    /* allocate our thread control block at the top of our stackspace. Cast to
+     * (uintptr_t) intermediately to silence -Wcast-align. (We manually made
+     * sure alignment is correct above.) */
+    thread_t *thread = (thread_t *)(uintptr_t)(stack + stacksize);
+
+    stacksize = _thread_stack_prepare(thread, stack, stacksize, flags);
+
+    unsigned state = irq_disable();
+
+    kernel_pid_t pid = _thread_pid_alloc(KERNEL_PID_FIRST);
+    if (pid == KERNEL_PID_UNDEF) {
+        irq_restore(state);
+
+        return -EOVERFLOW;
+    }
+
+    _thread_init(thread, pid, stack, stacksize, total_stacksize, priority,
+                 flags, function, arg, name);
 
     if (flags & THREAD_CREATE_SLEEPING) {
         sched_set_status(thread, STATUS_SLEEPING);
@@ -321,6 +379,78 @@ kernel_pid_t thread_create(char *stack, int stacksize, uint8_t priority,
     return pid;
 }
 
+#if IS_USED(MODULE_CORE_THREAD_STATIC)
+XFA_INIT_CONST(const thread_static_t *, thread_static_xfa);
+
+/* Creates the thread described by @p t with the first free PID not below
+ * @p pid, interrupts are disabled. PIDs are taken in order, so the search for
+ * a free one goes on where it stopped for the previous thread. */
+static kernel_pid_t _thread_static_init(const thread_static_t *t,
+                                        kernel_pid_t pid)
+{
+    thread_t *thread = t->thread;
+
+    assert(t->priority < SCHED_PRIO_LEVELS);
+#ifdef MODULE_SCHED_EDF
+    assert(t->priority != CONFIG_SCHED_EDF_PRIO);
+#endif
+    assert(((uintptr_t)t->stack % alignof(void *)) == 0);
+
+    pid = _thread_pid_alloc(pid);
+    if (pid == KERNEL_PID_UNDEF) {
+        return KERNEL_PID_UNDEF;
+    }
+
+    int stacksize = _thread_stack_prepare(thread, t->stack, t->stack_size,
+                                          t->flags);
+    _thread_init(thread, pid, t->stack, stacksize, t->stack_size,
+                 t->priority, t->flags, t->function, t->arg, t->name);
+
+#ifdef MODULE_CORE_MSG
+    if (t->msg_array) {
+        thread->msg_array = t->msg_array;
+        cib_init(&thread->msg_queue, t->msg_queue_size);
+    }
+#endif
+
+    sched_set_status(thread, (t->flags & THREAD_CREATE_SLEEPING)
+                             ? STATUS_SLEEPING : STATUS_PENDING);
+
+    return pid;
+}
+
+int thread_static_create(const thread_static_t *threads, unsigned numof)
+{
+    unsigned state = irq_disable();
+    kernel_pid_t pid = KERNEL_PID_FIRST;
+
+    for (unsigned i = 0; (i < numof) && (pid != KERNEL_PID_UNDEF); i++) {
+        pid = _thread_static_init(&threads[i], pid);
+    }
+
+    irq_restore(state);
+
+    return (pid == KERNEL_PID_UNDEF) ? -EOVERFLOW : 0;
+}
+
+int thread_static_create_all(void)
+{
+    unsigned state = irq_disable();
+    kernel_pid_t pid = KERNEL_PID_FIRST;
+    unsigned numof = XFA_LEN(const thread_static_t *, thread_static_xfa);
+
+    for (unsigned i = 0; (i < numof) && (pid != KERNEL_PID_UNDEF); i++) {
+        /* XFA_INIT_CONST() makes the descriptors volatile, they are constant */
+        pid = _thread_static_init(
+            (const thread_static_t *)thread_static_xfa[i], pid);
+    }
+
+    irq_restore(state);
+
+    return (pid == KERNEL_PID_UNDEF) ? -EOVERFLOW : 0;
+}
+#endif
+
 static const char *state_names[STATUS_NUMOF] = {
     [STATUS_STOPPED] = "stopped",
     [STATUS_ZOMBIE] = "zombie",
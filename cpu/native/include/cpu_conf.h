@@ -49,6 +49,13 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief   Number of cores emulated with host threads for core_smp, at most 8
+ */
+#ifndef SMP_CORE_NUMOF
+#define SMP_CORE_NUMOF                      (2)
+#endif
+
 /**
  * @brief   Native internal Ethernet protocol number
  */
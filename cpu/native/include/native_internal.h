@@ -31,6 +31,7 @@
 #define NATIVE_INTERNAL_H
 
 #include <signal.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <poll.h>
 /* enable signal handler register access on different platforms
@@ -178,6 +179,41 @@ ssize_t _native_read(int fd, void *buf, size_t count);
 ssize_t _native_write(int fd, const void *buf, size_t count);
 ssize_t _native_writev(int fildes, const struct iovec *iov, int iovcnt);
 
+#ifdef MODULE_CORE_SMP
+/*
+ * With core_smp, the cores other than 0 are host threads that never receive
+ * signals. These functions implement irq.h, thread_yield_higher(),
+ * cpu_switch_context_exit() and pm_set_lowest() for them.
+ */
+unsigned native_smp_irq_disable(void);
+unsigned native_smp_irq_enable(void);
+bool native_smp_irq_is_enabled(void);
+void native_smp_yield_higher(void);
+__attribute__((noreturn)) void native_smp_switch_context_exit(void);
+void native_smp_sleep(void);
+
+unsigned smp_core_id(void);
+void smp_kernel_lock(void);
+void smp_kernel_unlock(void);
+#endif
+
+/*
+ * core 0 holds the kernel lock of core_smp while its interrupts are disabled
+ */
+static inline void _native_kernel_lock(void)
+{
+#ifdef MODULE_CORE_SMP
+    smp_kernel_lock();
+#endif
+}
+
+static inline void _native_kernel_unlock(void)
+{
+#ifdef MODULE_CORE_SMP
+    smp_kernel_unlock();
+#endif
+}
+
 /**
  * @endcond
  */
@@ -152,6 +152,12 @@ unsigned irq_disable(void)
 {
     unsigned int prev_state;
 
+#ifdef MODULE_CORE_SMP
+    if (smp_core_id() != 0) {
+        return native_smp_irq_disable();
+    }
+#endif
+
     _native_syscall_enter();
     DEBUG("irq_disable()\n");
 
@@ -165,6 +171,9 @@ unsigned irq_disable(void)
 
     prev_state = native_interrupts_enabled;
     native_interrupts_enabled = 0;
+    if (prev_state) {
+        _native_kernel_lock();
+    }
 
     DEBUG("irq_disable(): return\n");
     _native_syscall_leave();
@@ -179,6 +188,12 @@ unsigned irq_enable(void)
 {
     unsigned int prev_state;
 
+#ifdef MODULE_CORE_SMP
+    if (smp_core_id() != 0) {
+        return native_smp_irq_enable();
+    }
+#endif
+
     if (_native_in_isr == 1) {
 #ifdef DEVELHELP
         real_write(STDERR_FILENO, "irq_enable + _native_in_isr\n", 27);
@@ -195,6 +210,9 @@ unsigned irq_enable(void)
      */
 
     prev_state = native_interrupts_enabled;
+    if (!prev_state) {
+        _native_kernel_unlock();
+    }
     native_interrupts_enabled = 1;
 
     if (sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
@@ -229,11 +247,22 @@ void irq_restore(unsigned state)
 
 bool irq_is_enabled(void)
 {
+#ifdef MODULE_CORE_SMP
+    if (smp_core_id() != 0) {
+        return native_smp_irq_is_enabled();
+    }
+#endif
     return native_interrupts_enabled;
 }
 
 bool irq_is_in(void)
 {
+#ifdef MODULE_CORE_SMP
+    /* only core 0 handles interrupts */
+    if (smp_core_id() != 0) {
+        return false;
+    }
+#endif
     DEBUG("irq_is_in: %i\n", _native_in_isr);
     return _native_in_isr;
 }
@@ -290,6 +319,7 @@ void isr_set_sigmask(ucontext_t *ctx)
 {
     ctx->uc_sigmask = _native_sig_set_dint;
     native_interrupts_enabled = 0;
+    _native_kernel_lock();
 }
 
 /**
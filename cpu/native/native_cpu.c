@@ -111,6 +111,16 @@ static inline void *align_stack(uintptr_t start, int *stacksize)
     return (void *)start;
 }
 
+#ifdef MODULE_CORE_SMP
+/* end_context and its stack are shared, but threads may exit on several
+ * cores at once: exit on the stack of the thread instead */
+static void _native_thread_start(thread_task_func_t task_func, void *arg)
+{
+    task_func(arg);
+    sched_task_exit();
+}
+#endif
+
 char *thread_stack_init(thread_task_func_t task_func, void *arg, void *stack_start, int stacksize)
 {
     ucontext_t *p;
@@ -141,7 +151,11 @@ char *thread_stack_init(thread_task_func_t task_func, void *arg, void *stack_sta
         err(EXIT_FAILURE, "thread_stack_init: sigemptyset");
     }
 
+#ifdef MODULE_CORE_SMP
+    makecontext(p, (void (*)(void)) _native_thread_start, 2, task_func, arg);
+#else
     makecontext(p, (void (*)(void)) task_func, 1, arg);
+#endif
 
     return (char *) p;
 }
@@ -160,6 +174,7 @@ void isr_cpu_switch_context_exit(void)
      * stacks are manually word aligned in thread_static_init() */
     ctx = (ucontext_t *)(uintptr_t)(thread_get_active()->sp);
 
+    _native_kernel_unlock();
     native_interrupts_enabled = 1;
     _native_mod_ctx_leave_sigh(ctx);
 
@@ -171,6 +186,12 @@ void isr_cpu_switch_context_exit(void)
 
 void cpu_switch_context_exit(void)
 {
+#ifdef MODULE_CORE_SMP
+    if (smp_core_id() != 0) {
+        native_smp_switch_context_exit();
+    }
+#endif
+
 #ifdef NATIVE_AUTO_EXIT
     if (sched_num_threads <= 1) {
         DEBUG("cpu_switch_context_exit: last task has ended. exiting.\n");
@@ -212,6 +233,7 @@ void isr_thread_yield(void)
     DEBUG("isr_thread_yield: switching to(%" PRIkernel_pid ")\n\n",
           thread_getpid());
 
+    _native_kernel_unlock();
     native_interrupts_enabled = 1;
     _native_mod_ctx_leave_sigh(ctx);
 
@@ -222,6 +244,13 @@ void isr_thread_yield(void)
 
 void thread_yield_higher(void)
 {
+#ifdef MODULE_CORE_SMP
+    if (smp_core_id() != 0) {
+        native_smp_yield_higher();
+        return;
+    }
+#endif
+
     sched_context_switch_request = 1;
 
     if (_native_in_isr == 0 && native_interrupts_enabled) {
@@ -38,6 +38,12 @@
 
 static void _native_sleep(void)
 {
+#ifdef MODULE_CORE_SMP
+    if (smp_core_id() != 0) {
+        native_smp_sleep();
+        return;
+    }
+#endif
     _native_in_syscall++; /* no switching here */
     real_pause();
     _native_in_syscall--;
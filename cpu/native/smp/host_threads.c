@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native
+ * @{
+ *
+ * @file
+ * @brief       Host threads emulating the cores of core_smp
+ *
+ * @}
+ */
+
+#include <err.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "host_threads.h"
+
+typedef struct {
+    pthread_t thread;
+    sem_t wake;
+    host_thread_entry_t entry;
+} host_thread_t;
+
+static pthread_t _main_thread;
+static host_thread_t *_threads;
+
+static void *_start(void *arg)
+{
+    unsigned index = (uintptr_t)arg;
+
+    _threads[index].entry(index);
+    errx(EXIT_FAILURE, "host_thread: entry of %u returned", index);
+}
+
+void host_threads_init(unsigned numof)
+{
+    _main_thread = pthread_self();
+    _threads = calloc(numof, sizeof(*_threads));
+    if (!_threads) {
+        err(EXIT_FAILURE, "host_threads_init: calloc");
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        if (sem_init(&_threads[i].wake, 0, 0) == -1) {
+            err(EXIT_FAILURE, "host_threads_init: sem_init");
+        }
+    }
+}
+
+void host_thread_start(unsigned index, host_thread_entry_t entry)
+{
+    sigset_t all, old;
+
+    /* signals are interrupts, which only the main thread handles: the new
+     * thread inherits this mask */
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &old);
+
+    _threads[index].entry = entry;
+    int res = pthread_create(&_threads[index].thread, NULL, _start,
+                             (void *)(uintptr_t)index);
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    if (res != 0) {
+        errno = res;
+        err(EXIT_FAILURE, "host_thread_start: pthread_create");
+    }
+}
+
+void host_thread_wait(unsigned index)
+{
+    while ((sem_wait(&_threads[index].wake) == -1) && (errno == EINTR)) {}
+}
+
+void host_thread_wake(unsigned index)
+{
+    sem_post(&_threads[index].wake);
+}
+
+void host_thread_signal_main(int sig)
+{
+    pthread_kill(_main_thread, sig);
+}
+
+void host_thread_relax(void)
+{
+    sched_yield();
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native
+ * @{
+ *
+ * @file
+ * @brief       Host threads emulating the cores of core_smp
+ *
+ * Only uses host types, as host_threads.c is built without the RIOT include
+ * paths.
+ */
+
+#ifndef HOST_THREADS_H
+#define HOST_THREADS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Entry function of a host thread
+ *
+ * @param[in]   index   index of the host thread
+ */
+typedef void (*host_thread_entry_t)(unsigned index);
+
+/**
+ * @brief   Prepare @p numof host threads, called by the main thread
+ */
+void host_threads_init(unsigned numof);
+
+/**
+ * @brief   Start host thread @p index, with all signals blocked
+ */
+void host_thread_start(unsigned index, host_thread_entry_t entry);
+
+/**
+ * @brief   Block the calling host thread @p index until it is woken
+ *
+ * A wake-up that happens before the wait is not lost.
+ */
+void host_thread_wait(unsigned index);
+
+/**
+ * @brief   Wake host thread @p index
+ */
+void host_thread_wake(unsigned index);
+
+/**
+ * @brief   Send signal @p sig to the main thread
+ */
+void host_thread_signal_main(int sig);
+
+/**
+ * @brief   Give the host CPU to another host thread
+ */
+void host_thread_relax(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_THREADS_H */
+/** @} */
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpu_native
+ * @{
+ *
+ * @file
+ * @brief       core_smp on native, emulating cores with host threads
+ *
+ * Core 0 is the main thread of the process, it handles all signals and
+ * keeps using the context switching of native_cpu.c and irq_cpu.c. Every
+ * other core is a host thread with all signals blocked:
+ *
+ * - Its interrupt state is a thread local flag, disabling interrupts takes
+ *   the kernel lock.
+ * - It runs the scheduler on a context of its own, to which the running
+ *   thread switches when it yields. A thread context may be saved on one
+ *   core and resumed on another one, so the signal mask of a context is set
+ *   before resuming it.
+ * - Notifying it posts a semaphore its idle thread waits on, and makes it
+ *   reschedule the next time it enables interrupts. Notifying core 0 sends it
+ *   a signal, i.e. an interrupt.
+ *
+ * Thread local storage is only accessed by functions of this file, which
+ * are not inlined into code that may migrate to another core.
+ *
+ * @}
+ */
+
+#include <err.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <ucontext.h>
+
+#include "cpu_conf.h"
+#include "irq.h"
+#include "native_internal.h"
+#include "sched.h"
+#include "smp.h"
+#include "thread.h"
+
+#include "host_threads.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Signal sent to core 0 when it is notified
+ */
+#define NATIVE_SMP_SIGNAL   SIGUSR2
+
+typedef struct {
+    ucontext_t sched_ctx;           /* context running the scheduler */
+    char sched_stack[ISR_STACKSIZE];
+    atomic_bool resched;            /* reschedule when enabling interrupts */
+    bool started;
+} native_core_t;
+
+static native_core_t _cores[SMP_CORE_NUMOF];
+
+static __thread unsigned _core_id;
+static __thread bool _irq_enabled;
+
+unsigned smp_core_id(void)
+{
+    return _core_id;
+}
+
+unsigned native_smp_irq_disable(void)
+{
+    unsigned state = _irq_enabled;
+
+    if (state) {
+        smp_kernel_lock();
+        _irq_enabled = false;
+    }
+    return state;
+}
+
+unsigned native_smp_irq_enable(void)
+{
+    unsigned state = _irq_enabled;
+
+    if (!state) {
+        _irq_enabled = true;
+        smp_kernel_unlock();
+    }
+    if (atomic_load(&_cores[_core_id].resched)) {
+        native_smp_yield_higher();
+    }
+    return state;
+}
+
+bool native_smp_irq_is_enabled(void)
+{
+    return _irq_enabled;
+}
+
+/* runs on the scheduler context of a core, with the kernel lock held */
+static void _core_schedule(void)
+{
+    sched_run();
+
+    /* Use intermediate cast to uintptr_t to silence -Wcast-align.
+     * stacks are manually word aligned in thread_stack_init() */
+    ucontext_t *ctx = (ucontext_t *)(uintptr_t)thread_get_active()->sp;
+
+    /* the context may have been saved on core 0 */
+    sigfillset(&ctx->uc_sigmask);
+
+    _irq_enabled = true;
+    smp_kernel_unlock();
+
+    if (setcontext(ctx) == -1) {
+        err(EXIT_FAILURE, "_core_schedule: setcontext");
+    }
+    errx(EXIT_FAILURE, "_core_schedule: this should have never been reached");
+}
+
+static ucontext_t *_sched_ctx(void)
+{
+    native_core_t *core = &_cores[_core_id];
+
+    core->sched_ctx.uc_stack.ss_sp = core->sched_stack;
+    core->sched_ctx.uc_stack.ss_size = sizeof(core->sched_stack);
+    core->sched_ctx.uc_stack.ss_flags = 0;
+    makecontext(&core->sched_ctx, _core_schedule, 0);
+
+    return &core->sched_ctx;
+}
+
+void native_smp_yield_higher(void)
+{
+    if (!_irq_enabled) {
+        /* switch once interrupts get enabled */
+        atomic_store(&_cores[_core_id].resched, true);
+        return;
+    }
+
+    native_smp_irq_disable();
+    atomic_store(&_cores[_core_id].resched, false);
+
+    /* Use intermediate cast to uintptr_t to silence -Wcast-align.
+     * stacks are manually word aligned in thread_stack_init() */
+    ucontext_t *ctx = (ucontext_t *)(uintptr_t)thread_get_active()->sp;
+    if (swapcontext(ctx, _sched_ctx()) == -1) {
+        err(EXIT_FAILURE, "native_smp_yield_higher: swapcontext");
+    }
+
+    /* resumed on any core, with the signal mask of the core that saved the
+     * context */
+    irq_enable();
+}
+
+void native_smp_switch_context_exit(void)
+{
+    /* interrupts are disabled, the kernel lock is held */
+    if (setcontext(_sched_ctx()) == -1) {
+        err(EXIT_FAILURE, "native_smp_switch_context_exit: setcontext");
+    }
+    errx(EXIT_FAILURE, "native_smp_switch_context_exit: this should have never been reached");
+}
+
+void native_smp_sleep(void)
+{
+    host_thread_wait(_core_id);
+
+    if (atomic_load(&_cores[_core_id].resched)) {
+        native_smp_yield_higher();
+    }
+}
+
+static void _core_entry(unsigned index)
+{
+    _core_id = index;
+
+    DEBUG("native_smp: core %u started\n", index);
+
+    /* enter the scheduler with interrupts disabled */
+    smp_kernel_lock();
+    _irq_enabled = false;
+    native_smp_switch_context_exit();
+}
+
+static void _notified(void)
+{
+    /* sched_context_switch_request is set, the switch happens on return */
+}
+
+void smp_arch_core_start(unsigned core)
+{
+    if (core == 1) {
+        host_threads_init(SMP_CORE_NUMOF);
+        register_interrupt(NATIVE_SMP_SIGNAL, _notified);
+    }
+
+    if (getcontext(&_cores[core].sched_ctx) == -1) {
+        err(EXIT_FAILURE, "smp_arch_core_start: getcontext");
+    }
+    sigfillset(&_cores[core].sched_ctx.uc_sigmask);
+
+    _cores[core].started = true;
+    host_thread_start(core, _core_entry);
+}
+
+void smp_arch_core_notify(unsigned core)
+{
+    if (core == 0) {
+        sched_context_switch_request = 1;
+        if (_core_id != 0) {
+            host_thread_signal_main(NATIVE_SMP_SIGNAL);
+        }
+        return;
+    }
+
+    if (_cores[core].started) {
+        atomic_store(&_cores[core].resched, true);
+        host_thread_wake(core);
+    }
+}
+
+void smp_arch_spin_wait(void)
+{
+    /* the holder may be a host thread waiting for a host CPU */
+    host_thread_relax();
+}
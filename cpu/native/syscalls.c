@@ -110,6 +110,12 @@ int (*real_clock_gettime)(clockid_t clk_id, struct timespec *tp);
 
 void _native_syscall_enter(void)
 {
+#ifdef MODULE_CORE_SMP
+    /* only core 0 can be interrupted */
+    if (smp_core_id() != 0) {
+        return;
+    }
+#endif
     _native_in_syscall++;
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -119,6 +125,11 @@ void _native_syscall_enter(void)
 
 void _native_syscall_leave(void)
 {
+#ifdef MODULE_CORE_SMP
+    if (smp_core_id() != 0) {
+        return;
+    }
+#endif
     if (IS_ACTIVE(ENABLE_DEBUG)) {
         real_write(STDERR_FILENO, "< _native_in_syscall\n", 21);
     }
@@ -140,6 +151,7 @@ void _native_syscall_leave(void)
         native_isr_context.uc_stack.ss_size = SIGSTKSZ;
         native_isr_context.uc_stack.ss_flags = 0;
         native_interrupts_enabled = 0;
+        _native_kernel_lock();
         makecontext(&native_isr_context, native_irq_handler, 0);
         if (swapcontext(_native_cur_ctx, &native_isr_context) == -1) {
             err(EXIT_FAILURE, "_native_syscall_leave: swapcontext");
@@ -0,0 +1,293 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to compute the worst case stack depth of thread entry functions from
+the `-fstack-usage` and `-fcallgraph-info=su` output of GCC, and to compare it
+against the size of the thread stacks in the ELF file.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+INDIRECT_CALL = "__indirect_call"
+
+NODE_RE = re.compile(r'^node: \{ title: "([^"]*)" label: "([^"]*)"(.*)\}$')
+EDGE_RE = re.compile(r'^edge: \{ sourcename: "([^"]*)" targetname: "([^"]*)"')
+BYTES_RE = re.compile(r"(\d+) bytes \(([^)]*)\)")
+SU_RE = re.compile(r"^(.*):\d+:\d+:(\S+)\t(\d+)\t(\S+)$")
+
+
+class Function:
+    def __init__(self, title, name, frame, qualifiers):
+        self.title = title
+        self.name = name
+        self.frame = frame
+        self.dynamic = "bounded" not in qualifiers and "dynamic" in qualifiers
+        self.callees = set()
+
+
+class Result:
+    """Worst case depth below a function and why it may be a lower bound"""
+
+    def __init__(self, depth=0, path=None):
+        self.depth = depth
+        self.path = path or []
+        self.recursive = False
+        self.indirect = False
+        self.dynamic = False
+        self.unknown = set()
+
+    def merge_flags(self, other):
+        self.recursive |= other.recursive
+        self.indirect |= other.indirect
+        self.dynamic |= other.dynamic
+        self.unknown |= other.unknown
+
+    @property
+    def exact(self):
+        return not (self.recursive or self.indirect or self.dynamic or
+                    self.unknown)
+
+
+class CallGraph:
+    def __init__(self, assume):
+        # static functions are titled <file>:<name>, others just <name>
+        self.functions = {}
+        self.assume = assume
+
+    def _add(self, func):
+        old = self.functions.get(func.title)
+        if old is None:
+            self.functions[func.title] = func
+        else:
+            # e.g. weak and strong definition: assume the worse one
+            old.frame = max(old.frame, func.frame)
+            old.dynamic |= func.dynamic
+            old.callees |= func.callees
+
+    def parse_ci(self, path):
+        with open(path) as f:
+            lines = f.read().splitlines()
+        funcs = {}
+        for line in lines:
+            match = NODE_RE.match(line)
+            if match:
+                title, label, rest = match.groups()
+                if "shape : ellipse" in rest:
+                    continue
+                label = label.split("\\n")
+                usage = BYTES_RE.search(label[-1])
+                frame, qualifiers = (0, "") if not usage else \
+                    (int(usage.group(1)), usage.group(2))
+                funcs[title] = Function(title, label[0], frame, qualifiers)
+                continue
+            match = EDGE_RE.match(line)
+            if match and match.group(1) in funcs:
+                funcs[match.group(1)].callees.add(match.group(2))
+        for func in funcs.values():
+            self._add(func)
+
+    def parse_su(self, path):
+        with open(path) as f:
+            for line in f:
+                match = SU_RE.match(line.rstrip("\n"))
+                if not match:
+                    continue
+                _, name, frame, qualifiers = match.groups()
+                self._add(Function(name, name, int(frame), qualifiers))
+
+    def lookup(self, name):
+        """Find the titles of the functions called name, static or not"""
+        if name in self.functions:
+            return [name]
+        return [t for t in self.functions if t.rsplit(":", 1)[-1] == name]
+
+    def depth(self, title, memo=None, active=None):
+        memo = {} if memo is None else memo
+        active = set() if active is None else active
+        if title in memo:
+            return memo[title]
+        func = self.functions[title]
+        active.add(title)
+        worst = Result()
+        flags = Result()
+        for callee in sorted(func.callees):
+            if callee == INDIRECT_CALL:
+                flags.indirect = True
+                continue
+            if callee in active:
+                flags.recursive = True
+                continue
+            if callee in self.functions:
+                res = self.depth(callee, memo, active)
+                flags.merge_flags(res)
+            elif callee in self.assume:
+                res = Result(self.assume[callee], [callee])
+            else:
+                flags.unknown.add(callee)
+                continue
+            if res.depth > worst.depth:
+                worst = res
+        active.discard(title)
+        result = Result(func.frame + worst.depth, [func.name] + worst.path)
+        result.merge_flags(flags)
+        result.dynamic |= func.dynamic
+        # results below a function on a recursive cycle depend on the entry
+        # into the cycle, so don't reuse them
+        if not result.recursive:
+            memo[title] = result
+        return result
+
+
+def collect(bindir, graph):
+    ci_files = []
+    su_files = []
+    for root, _, files in os.walk(bindir):
+        for name in files:
+            if name.endswith(".ci"):
+                ci_files.append(os.path.join(root, name))
+            elif name.endswith(".su"):
+                su_files.append(os.path.join(root, name))
+    if ci_files:
+        for path in sorted(ci_files):
+            graph.parse_ci(path)
+    elif su_files:
+        print("warning: no call graph found, only reporting the frame of "
+              "each entry function", file=sys.stderr)
+        for path in sorted(su_files):
+            graph.parse_su(path)
+    else:
+        sys.exit("error: no -fstack-usage output found in {}, "
+                 "build with STACK_USAGE=1".format(bindir))
+
+
+def symbol_sizes(nm, elffile):
+    sizes = {}
+    out = subprocess.run([nm, "-S", "--defined-only", elffile], check=True,
+                         stdout=subprocess.PIPE, universal_newlines=True)
+    for line in out.stdout.splitlines():
+        fields = line.split()
+        if len(fields) == 4:
+            sizes.setdefault(fields[3], []).append(int(fields[1], 16))
+    return sizes
+
+
+def align_up(value, align):
+    return (value + align - 1) // align * align
+
+
+def define_name(entry):
+    return "STACK_USAGE_" + re.sub(r"\W", "_", entry).strip("_").upper()
+
+
+def write_header(path, rows):
+    with open(path, "w") as f:
+        f.write("/* generated by dist/tools/stack_usage/stack_usage.py, "
+                "do not edit */\n\n")
+        guard = re.sub(r"\W", "_", os.path.basename(path)).upper()
+        f.write("#ifndef {0}\n#define {0}\n\n".format(guard))
+        for row in rows:
+            f.write("/* {}{} */\n".format(" -> ".join(row["result"].path),
+                                          "" if row["result"].exact else
+                                          " (lower bound)"))
+            f.write("#define {} ({})\n".format(define_name(row["entry"]),
+                                                row["required"]))
+        f.write("\n#endif /* {} */\n".format(guard))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elffile", help="linked application")
+    parser.add_argument("bindir", help="directory with the .ci/.su files")
+    parser.add_argument("-t", "--thread", action="append", default=[],
+                        metavar="ENTRY[:STACK]",
+                        help="thread entry function and stack symbol")
+    parser.add_argument("-e", "--extra", type=int, default=0,
+                        help="bytes used per thread besides the call chain")
+    parser.add_argument("-a", "--assume", action="append", default=[],
+                        metavar="FUNCTION=BYTES",
+                        help="worst case depth of a function without "
+                             "stack usage information, e.g. from libc")
+    parser.add_argument("--align", type=int, default=8,
+                        help="alignment of right-sized stacks")
+    parser.add_argument("--header", help="write right-sized stack sizes")
+    parser.add_argument("--nm", default="nm", help="nm of the toolchain")
+    parser.add_argument("-v", "--verbose", action="store_true",
+                        help="print the worst case call chains")
+    parser.add_argument("--check", action="store_true",
+                        help="fail if a stack is smaller than required")
+    args = parser.parse_args()
+
+    assume = {}
+    for item in args.assume:
+        name, _, size = item.partition("=")
+        assume[name] = int(size, 0)
+
+    graph = CallGraph(assume)
+    collect(args.bindir, graph)
+    sizes = symbol_sizes(args.nm, args.elffile) if os.path.exists(
+        args.elffile) else {}
+
+    rows = []
+    for thread in args.thread:
+        entry, _, stack = thread.partition(":")
+        titles = graph.lookup(entry)
+        if not titles:
+            print("warning: {}: entry function not found".format(entry),
+                  file=sys.stderr)
+            continue
+        if len(titles) > 1:
+            print("warning: {}: ambiguous, using the deepest of {}".format(
+                  entry, ", ".join(titles)), file=sys.stderr)
+        result = max((graph.depth(t) for t in titles), key=lambda r: r.depth)
+        required = align_up(result.depth + args.extra, args.align)
+        size = None
+        if stack:
+            size = max(sizes.get(stack, [0])) or None
+        rows.append(dict(entry=entry, stack=stack, size=size,
+                         result=result, required=required))
+
+    fmt = "{:<24} {:<16} {:>7} {:>7} {:>7}  {}"
+    print(fmt.format("thread", "stack", "size", "usage", "margin", "notes"))
+    failed = False
+    for row in rows:
+        result = row["result"]
+        notes = []
+        if result.recursive:
+            notes.append("recursion")
+        if result.indirect:
+            notes.append("indirect calls")
+        if result.dynamic:
+            notes.append("unbounded alloca/VLA")
+        if result.unknown:
+            notes.append("unknown: " + ", ".join(sorted(result.unknown)))
+        size = row["size"]
+        margin = size - row["required"] if size is not None else None
+        failed |= margin is not None and margin < 0
+        print(fmt.format(row["entry"], row["stack"] or "-",
+                         "-" if size is None else size,
+                         "{}{}".format(row["required"],
+                                       "" if result.exact else "+"),
+                         "-" if margin is None else margin,
+                         "; ".join(notes)))
+        if args.verbose:
+            print("    " + " -> ".join(result.path))
+
+    if args.header:
+        write_header(args.header, rows)
+
+    if args.check and failed:
+        sys.exit("error: thread stack smaller than its worst case depth")
+
+
+if __name__ == "__main__":
+    main()
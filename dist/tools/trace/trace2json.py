@@ -0,0 +1,196 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Script to convert a binary trace buffer export (see `trace_export()` of the
+`trace` module) into the Chrome trace event format, e.g. for
+https://ui.perfetto.dev or `chrome://tracing`.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"RTRC"
+VERSION = 1
+FLAG_BIG_ENDIAN = 0x0001
+HDR_FMT = "4sBBHI"
+RECORD_FMT = "IIIBBh"
+EVENT_FLAG_ISR = 0x01
+ISR_TID = -1
+KERNEL_PID_UNDEF = 0
+
+EVENT_TYPES = [
+    "user",
+    "sched_switch",
+    "msg_send",
+    "msg_recv",
+    "mutex_lock",
+    "mutex_block",
+    "mutex_unlock",
+    "ztimer_fire",
+    "netif_rx",
+    "netif_tx",
+]
+
+
+class TraceFormatError(Exception):
+    pass
+
+
+def decode(data):
+    """
+    Parse a binary trace export into a list of record dicts in recording
+    order. Records that were overwritten during the export are skipped.
+    """
+    hdr_size = struct.calcsize("<" + HDR_FMT)
+    if len(data) < hdr_size:
+        raise TraceFormatError("truncated header")
+    # the header is in the byte order of the node, the big endian flag is
+    # only ever set by big endian nodes
+    endianness = ">"
+    magic, version, record_size, flags, numof = struct.unpack(
+        endianness + HDR_FMT, data[:hdr_size])
+    if not (flags & FLAG_BIG_ENDIAN):
+        endianness = "<"
+        magic, version, record_size, flags, numof = struct.unpack(
+            endianness + HDR_FMT, data[:hdr_size])
+    if magic != MAGIC:
+        raise TraceFormatError("bad magic {!r}".format(magic))
+    if version != VERSION:
+        raise TraceFormatError("unsupported version {}".format(version))
+    fmt = endianness + RECORD_FMT
+    if record_size < struct.calcsize(fmt):
+        raise TraceFormatError("record size {} too small".format(record_size))
+    body = data[hdr_size:]
+    if len(body) < numof * record_size:
+        raise TraceFormatError("truncated export: {} of {} records".format(
+            len(body) // record_size, numof))
+    records = []
+    time_last = None
+    time = 0
+    for i in range(numof):
+        offset = i * record_size
+        seq, time32, arg, etype, eflags, pid = struct.unpack_from(
+            fmt, body, offset)
+        if seq == 0:
+            continue
+        if time_last is None:
+            time = time32
+        else:
+            # unwrap the 32-bit timestamps, allowing for small steps back in
+            # time caused by preemption between reading the clock and
+            # reserving the record
+            delta = (time32 - time_last) & 0xffffffff
+            if delta & 0x80000000:
+                delta -= 1 << 32
+            time += delta
+        time_last = time32
+        records.append({
+            "seq": seq - 1,
+            "time": time,
+            "type": EVENT_TYPES[etype] if etype < len(EVENT_TYPES)
+            else "type_{}".format(etype),
+            "isr": bool(eflags & EVENT_FLAG_ISR),
+            "pid": pid,
+            "arg": arg,
+        })
+    return records
+
+
+def _args(record):
+    arg = record["arg"]
+    etype = record["type"]
+    if etype in ("msg_send", "msg_recv"):
+        peer = arg >> 16
+        if peer & 0x8000:
+            peer -= 1 << 16
+        key = "target" if etype == "msg_send" else "sender"
+        return {key: peer, "msg_type": "0x{:04x}".format(arg & 0xffff)}
+    if etype.startswith("mutex_"):
+        return {"mutex": "0x{:08x}".format(arg)}
+    if etype == "ztimer_fire":
+        return {"callback": "0x{:08x}".format(arg)}
+    if etype in ("netif_rx", "netif_tx"):
+        return {"len": arg}
+    return {"value": "0x{:08x}".format(arg)}
+
+
+def to_chrome(records, thread_names=None):
+    """
+    Convert decoded records into a Chrome trace event format object.
+
+    Context switches become "running" slices on the track of the respective
+    thread, all other events become instant events. Events recorded in
+    interrupt context are put on a separate "ISR" track.
+    """
+    names = dict(thread_names or {})
+    events = []
+    tids = set()
+    running = None
+    for record in records:
+        ts = record["time"]
+        if record["type"] == "sched_switch":
+            if running is not None:
+                events.append({"name": "running", "ph": "E", "ts": ts,
+                               "pid": 0, "tid": running})
+            running = record["pid"]
+            tids.add(running)
+            events.append({"name": "running", "ph": "B", "ts": ts,
+                           "pid": 0, "tid": running})
+            continue
+        tid = ISR_TID if record["isr"] else record["pid"]
+        tids.add(tid)
+        events.append({"name": record["type"], "ph": "i", "s": "t", "ts": ts,
+                       "pid": 0, "tid": tid, "args": _args(record)})
+    if running is not None and records:
+        events.append({"name": "running", "ph": "E",
+                       "ts": records[-1]["time"], "pid": 0, "tid": running})
+    names.setdefault(ISR_TID, "ISR")
+    names.setdefault(KERNEL_PID_UNDEF, "none")
+    meta = [{"name": "process_name", "ph": "M", "pid": 0,
+             "args": {"name": "RIOT"}}]
+    for tid in sorted(tids):
+        meta.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": tid,
+                     "args": {"name": names.get(tid,
+                                                "thread {}".format(tid))}})
+    return {"traceEvents": meta + events, "displayTimeUnit": "ms"}
+
+
+def _thread_name(value):
+    pid, sep, name = value.partition("=")
+    if not sep:
+        raise argparse.ArgumentTypeError("expected PID=NAME")
+    return int(pid), name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("infile", nargs="?", type=argparse.FileType("rb"),
+                        default=sys.stdin.buffer,
+                        help="Binary trace export (default: stdin)")
+    parser.add_argument("-o", "--outfile", type=argparse.FileType("w"),
+                        default=sys.stdout,
+                        help="Output JSON file (default: stdout)")
+    parser.add_argument("-n", "--thread-name", type=_thread_name,
+                        action="append", default=[], metavar="PID=NAME",
+                        help="Name the track of thread PID")
+    args = parser.parse_args()
+
+    try:
+        records = decode(args.infile.read())
+    except TraceFormatError as exc:
+        parser.exit(1, "{}: {}\n".format(parser.prog, exc))
+    json.dump(to_chrome(records, dict(args.thread_name)), args.outfile,
+              indent=1)
+    args.outfile.write("\n")
+
+
+if __name__ == "__main__":
+    main()
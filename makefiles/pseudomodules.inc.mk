@@ -107,6 +107,13 @@ PSEUDOMODULES += gnrc_ipv6_auto_subnets_auto_init
 PSEUDOMODULES += gnrc_ipv6_auto_subnets_simple
 PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_ext_frag_stats
+## @defgroup net_gnrc_ipv6_fwd_cache  gnrc_ipv6_fwd_cache
+## @ingroup net_gnrc_ipv6
+## @{
+## @brief   Cache the next hop of recently forwarded flows
+## @see     CONFIG_GNRC_IPV6_FWD_CACHE_SIZE
+PSEUDOMODULES += gnrc_ipv6_fwd_cache
+## @}
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
 PSEUDOMODULES += gnrc_ipv6_nib_6lbr
@@ -125,6 +132,7 @@ PSEUDOMODULES += gnrc_lorawan_1_1
 PSEUDOMODULES += gnrc_netdev_default
 ## @}
 PSEUDOMODULES += gnrc_neterr
+PSEUDOMODULES += gnrc_netapi_batch
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_netif_bus
@@ -149,6 +157,7 @@ PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_cmd_lora
 ## @}
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netreg_hash
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -237,6 +246,13 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_stats
 ##
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure
 ## @}
+## @defgroup net_gnrc_sixlowpan_iphc_cache  gnrc_sixlowpan_iphc_cache
+## @ingroup net_gnrc_sixlowpan_iphc
+## @{
+## @brief   Cache the IPHC header encoding of recently sent flows
+## @see     CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+PSEUDOMODULES += gnrc_sixlowpan_iphc_cache
+## @}
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
@@ -288,6 +304,11 @@ PSEUDOMODULES += libc_gettimeofday
 ##        of malloc(), calloc(), realloc() and free
 PSEUDOMODULES += malloc_tracing
 
+## @defgroup pseudomodule_malloc_thread_cache malloc_thread_cache
+## @brief Per-thread caches for small allocations in front of
+##        @ref sys_malloc_ts, see @ref sys_malloc_ts_cache
+PSEUDOMODULES += malloc_thread_cache
+
 ## @defgroup pseudomodule_mpu_stack_guard mpu_stack_guard
 ## @brief MPU based stack guard
 ##
@@ -379,6 +400,10 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+## @defgroup pseudomodule_schedstatistics_latency schedstatistics_latency
+## @ingroup schedstatistics
+## @brief Record wakeup-to-run latencies and preemptions per thread
+PSEUDOMODULES += schedstatistics_latency
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -430,6 +455,7 @@ PSEUDOMODULES += shell_cmd_fib
 PSEUDOMODULES += shell_cmd_gnrc_icmpv6_echo
 PSEUDOMODULES += shell_cmd_gnrc_ipv6_blacklist
 PSEUDOMODULES += shell_cmd_gnrc_ipv6_frag_stats
+PSEUDOMODULES += shell_cmd_gnrc_ipv6_fwd_cache
 PSEUDOMODULES += shell_cmd_gnrc_ipv6_nib
 PSEUDOMODULES += shell_cmd_gnrc_ipv6_whitelist
 PSEUDOMODULES += shell_cmd_gnrc_netif
@@ -510,6 +536,9 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+## @defgroup pseudomodule_trace_hooks trace_hooks
+## @brief Record scheduler, msg, mutex, ztimer and netif events with @ref trace
+PSEUDOMODULES += trace_hooks
 PSEUDOMODULES += usbus_urb
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
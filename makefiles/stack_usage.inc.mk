@@ -0,0 +1,52 @@
+# Static worst case stack depth analysis of thread entry functions
+#
+# With STACK_USAGE=1 every object is compiled with -fstack-usage and
+# -fcallgraph-info=su. `make stack-usage` then combines the per function
+# frame sizes along the call graph, and compares the worst case depth of each
+# thread in STACK_USAGE_THREADS against the size of its stack.
+#
+# Please see dist/tools/stack_usage/README.md for more info.
+
+STACK_USAGE ?= 0
+
+# List of <entry function>:<stack symbol> pairs, applications add their own
+# threads, e.g. `STACK_USAGE_THREADS += _event_loop:_stack`
+STACK_USAGE_THREADS += main_trampoline:main_stack
+ifneq (,$(filter core_idle_thread,$(USEMODULE)))
+  STACK_USAGE_THREADS += idle_thread:idle_stack
+endif
+
+# Bytes used on each thread stack in addition to the call chain of the entry
+# function: the thread control block and the saved context of the thread
+# (and on some architectures an exception frame)
+STACK_USAGE_EXTRA ?= 256
+
+# If set, a header with a right-sized stack size for each thread is written to
+# this file
+STACK_USAGE_HEADER ?=
+
+# If set to 1, linking fails when a stack is smaller than its worst case depth
+STACK_USAGE_CHECK ?= 0
+
+STACK_USAGE_TOOL ?= $(RIOTTOOLS)/stack_usage/stack_usage.py
+
+ifeq (1,$(STACK_USAGE))
+  ifneq (gnu,$(TOOLCHAIN))
+    $(error STACK_USAGE=1 requires TOOLCHAIN=gnu)
+  endif
+  CFLAGS += -fstack-usage -fcallgraph-info=su
+  ifeq (1,$(STACK_USAGE_CHECK))
+    BUILD_FILES += stack-usage
+  endif
+else ifneq (,$(filter stack-usage,$(MAKECMDGOALS)))
+  $(error stack-usage requires building with STACK_USAGE=1)
+endif
+
+STACK_USAGE_FLAGS += --nm $(NM) --extra $(STACK_USAGE_EXTRA)
+STACK_USAGE_FLAGS += $(addprefix --thread ,$(STACK_USAGE_THREADS))
+STACK_USAGE_FLAGS += $(if $(STACK_USAGE_HEADER),--header $(STACK_USAGE_HEADER))
+STACK_USAGE_FLAGS += $(if $(filter 1,$(STACK_USAGE_CHECK)),--check)
+
+.PHONY: stack-usage
+stack-usage: $(ELFFILE)
+	$(Q)$(STACK_USAGE_TOOL) $(STACK_USAGE_FLAGS) $(ELFFILE) $(BINDIR)
@@ -87,6 +87,11 @@ export SIZEFLAGS             # The optional size flags.
 export UNDEF                 # Object files that the linker must include in the ELFFILE even if no call to the functions or symbols (ex: interrupt vectors).
 export WERROR                # Treat all compiler warnings as errors if set to 1 (see -Werror flag in GCC manual)
 export WPEDANTIC             # Issue all (extensive) compiler warnings demanded by strict C/C++
+# STACK_USAGE                # Compile with -fstack-usage and -fcallgraph-info for `make stack-usage` if set to 1 (see makefiles/stack_usage.inc.mk)
+# STACK_USAGE_THREADS        # <entry function>:<stack symbol> pairs analysed by `make stack-usage`.
+# STACK_USAGE_EXTRA          # Bytes each thread stack needs beyond the call chain of its entry function (thread control block, saved context).
+# STACK_USAGE_HEADER         # Header file written by `make stack-usage` with a right-sized stack size for each thread.
+# STACK_USAGE_CHECK          # Fail linking if a thread stack is smaller than its worst case depth, if set to 1.
 # EEPROM_FILE                # (Native only!) file path where the content of the EEPROM is stored
 
 # GITCACHE                   # path to git-cache executable
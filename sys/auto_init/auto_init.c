@@ -70,6 +70,11 @@ extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
           AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN);
 #endif
+#if IS_USED(MODULE_SCHED_EDF)
+extern void sched_edf_init(void);
+AUTO_INIT(sched_edf_init,
+          AUTO_INIT_PRIO_MOD_SCHED_EDF);
+#endif
 #if IS_USED(MODULE_DUMMY_THREAD)
 extern void dummy_thread_create(void);
 AUTO_INIT(dummy_thread_create,
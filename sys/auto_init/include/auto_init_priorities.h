@@ -65,6 +65,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN            1060
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_EDF
+/**
+ * @brief   EDF scheduling priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_EDF                    1065
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_DUMMY_THREAD
 /**
  * @brief   dummy thread priority
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include "event/channel.h"
+
+static void _notify(chan_t *chan, void *arg)
+{
+    event_chan_t *event = arg;
+
+    (void)chan;
+    event_post(event->queue, &event->super);
+}
+
+void event_chan_attach(event_chan_t *event, chan_t *chan,
+                       event_queue_t *queue, event_handler_t handler,
+                       unsigned threshold)
+{
+    event->super = (event_t){ .handler = handler };
+    event->queue = queue;
+    event->chan = chan;
+    chan_set_notify(chan, _notify, event, threshold);
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include "event/coalesce.h"
+#include "irq.h"
+
+void event_coalesce_post(event_queue_t *queue, event_coalesce_t *event)
+{
+    unsigned state = irq_disable();
+    if (event->count < UINT16_MAX) {
+        event->count++;
+    }
+    irq_restore(state);
+
+    /* count first: a handler running in between takes this post and
+     * finds a count of 0 on the next call, instead of leaving a count
+     * behind without the event being queued */
+    event_post(queue, &event->super);
+}
+
+unsigned event_coalesce_take(event_coalesce_t *event)
+{
+    unsigned state = irq_disable();
+    unsigned count = event->count;
+    event->count = 0;
+    irq_restore(state);
+
+    return count;
+}
+
+void event_coalesce_cancel(event_queue_t *queue, event_coalesce_t *event)
+{
+    unsigned state = irq_disable();
+    event_cancel(queue, &event->super);
+    event->count = 0;
+    irq_restore(state);
+}
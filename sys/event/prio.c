@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue implementation
+ *
+ * Each level is a circular doubly linked list, levels[n] points to its
+ * oldest event and levels[n]->prev to its newest one.
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "bitarithm.h"
+#include "event/prio.h"
+#include "irq.h"
+#include "thread_flags.h"
+
+static_assert(CONFIG_EVENT_PRIO_LEVELS <= 8,
+              "event_prio_queue_t::pending holds at most 8 levels");
+
+/* requires interrupts to be disabled */
+static void _unlink(event_prio_queue_t *queue, event_prio_t *event)
+{
+    event_prio_t **head = &queue->levels[event->level];
+
+    if (event->next == event) {
+        *head = NULL;
+        queue->pending &= ~(1U << event->level);
+    }
+    else {
+        event->prev->next = event->next;
+        event->next->prev = event->prev;
+        if (*head == event) {
+            *head = event->next;
+        }
+    }
+    event->next = NULL;
+    event->prev = NULL;
+}
+
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event)
+{
+    assert(queue && event);
+    assert(event->level < CONFIG_EVENT_PRIO_LEVELS);
+
+    unsigned state = irq_disable();
+    if (!event->prev) {
+        event_prio_t **head = &queue->levels[event->level];
+        if (*head) {
+            event->next = *head;
+            event->prev = (*head)->prev;
+            event->prev->next = event;
+            (*head)->prev = event;
+        }
+        else {
+            event->next = event;
+            event->prev = event;
+            *head = event;
+            queue->pending |= 1U << event->level;
+        }
+    }
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    if (event->prev) {
+        _unlink(queue, event);
+    }
+    irq_restore(state);
+}
+
+event_prio_t *event_prio_get(event_prio_queue_t *queue)
+{
+    event_prio_t *result = NULL;
+
+    unsigned state = irq_disable();
+    if (queue->pending) {
+        result = queue->levels[bitarithm_lsb(queue->pending)];
+        _unlink(queue, result);
+    }
+    irq_restore(state);
+
+    return result;
+}
+
+event_prio_t *event_prio_wait(event_prio_queue_t *queue)
+{
+    assert(queue && queue->waiter);
+    event_prio_t *result;
+
+    while ((result = event_prio_get(queue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+    return result;
+}
@@ -23,6 +23,7 @@
 
 #include "architecture.h"
 #include "thread.h"
+#include "thread_static.h"
 #include "event.h"
 #include "event/thread.h"
 
@@ -91,13 +92,66 @@ void event_thread_init_multi(event_queue_t *queues, size_t queues_numof,
 #define EVENT_THREAD_LOWEST_PRIO   (THREAD_PRIORITY_IDLE - 1)
 #endif
 
+event_queue_t event_thread_queues[EVENT_QUEUE_PRIO_NUMOF];
+
+#if IS_USED(MODULE_CORE_THREAD_STATIC)
+/* The event threads are created by the kernel at boot. Until a thread
+ * claims its queues, they are detached, as event_thread_queues is zero
+ * initialized. The thread control block is not part of the stack, so it is
+ * taken from it to keep the same footprint. */
+
+static void *_static_handler_thread(void *arg)
+{
+    const struct event_queue_and_size *qs = arg;
+
+    event_queues_claim(qs->q, qs->q_numof);
+    event_loop_multi(qs->q, qs->q_numof);
+
+    /* should be never reached */
+    return NULL;
+}
+
+#if IS_USED(MODULE_EVENT_THREAD_HIGHEST)
+static const struct event_queue_and_size _evq_highest = {
+    .q = EVENT_PRIO_HIGHEST, .q_numof = 1,
+};
+THREAD_STATIC(event_highest,
+              EVENT_THREAD_HIGHEST_STACKSIZE - sizeof(thread_t),
+              EVENT_THREAD_HIGHEST_PRIO, THREAD_CREATE_STACKTEST,
+              _static_handler_thread, (void *)&_evq_highest);
+#endif
+
+#if IS_USED(MODULE_EVENT_THREAD_MEDIUM)
+static const struct event_queue_and_size _evq_lowest = {
+    .q = EVENT_PRIO_LOWEST, .q_numof = 1,
+};
+THREAD_STATIC(event_lowest,
+              EVENT_THREAD_LOWEST_STACKSIZE - sizeof(thread_t),
+              EVENT_THREAD_LOWEST_PRIO, THREAD_CREATE_STACKTEST,
+              _static_handler_thread, (void *)&_evq_lowest);
+#endif
+
+static const struct event_queue_and_size _evq_medium = {
+    .q = IS_USED(MODULE_EVENT_THREAD_HIGHEST) ? EVENT_PRIO_MEDIUM
+                                              : EVENT_PRIO_HIGHEST,
+    .q_numof = 1 + !IS_USED(MODULE_EVENT_THREAD_HIGHEST)
+                 + !IS_USED(MODULE_EVENT_THREAD_MEDIUM),
+};
+THREAD_STATIC(event,
+              EVENT_THREAD_MEDIUM_STACKSIZE - sizeof(thread_t),
+              EVENT_THREAD_MEDIUM_PRIO, THREAD_CREATE_STACKTEST,
+              _static_handler_thread, (void *)&_evq_medium);
+
+void auto_init_event_thread(void)
+{
+    /* nothing left to do */
+}
+#else
 /* rely on compiler / linker to garbage collect unused stacks */
 static char WORD_ALIGNED _evq_highest_stack[EVENT_THREAD_HIGHEST_STACKSIZE];
 static char WORD_ALIGNED _evq_medium_stack[EVENT_THREAD_MEDIUM_STACKSIZE];
 static char WORD_ALIGNED _evq_lowest_stack[EVENT_THREAD_LOWEST_STACKSIZE];
 
-event_queue_t event_thread_queues[EVENT_QUEUE_PRIO_NUMOF];
-
 void auto_init_event_thread(void)
 {
     if (IS_USED(MODULE_EVENT_THREAD_HIGHEST)) {
@@ -131,3 +185,4 @@ void auto_init_event_thread(void)
                             _evq_medium_stack, sizeof(_evq_medium_stack),
                             EVENT_THREAD_MEDIUM_PRIO);
 }
+#endif
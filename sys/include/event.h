@@ -270,6 +270,7 @@ void event_post(event_queue_t *queue, event_t *event);
  * This will remove a queued event from an event queue.
  *
  * @note    Due to the underlying list implementation, this will run in O(n).
+ *          @ref event_prio_cancel of a priority event queue runs in O(1).
  *
  * @param[in]   queue   event queue to remove event from
  * @param[in]   event   event to remove from queue
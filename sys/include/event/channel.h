@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides an event posted when a bulk channel has data
+ *
+ * The event is posted whenever the number of filled slots of the channel
+ * reaches the threshold (see @ref core_chan). The handler should consume
+ * all filled slots, as it is only called again once the threshold is
+ * reached anew.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * void handler(event_t *event)
+ * {
+ *     event_chan_t *ev = container_of(event, event_chan_t, super);
+ *     unsigned numof = 16;
+ *     sample_t *s;
+ *
+ *     while ((s = chan_read_reserve(ev->chan, &numof))) {
+ *         process(s, numof);
+ *         chan_read_commit(ev->chan, numof);
+ *         numof = 16;
+ *     }
+ * }
+ *
+ * [...]
+ * event_chan_attach(&event_chan, &chan, EVENT_PRIO_MEDIUM, handler, 8);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event Channel API
+ */
+
+#ifndef EVENT_CHANNEL_H
+#define EVENT_CHANNEL_H
+
+#include "chan.h"
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Channel event structure
+ */
+typedef struct {
+    event_t super;              /**< event_t structure that gets extended   */
+    event_queue_t *queue;       /**< queue the event is posted to           */
+    chan_t *chan;               /**< channel notifying the event            */
+} event_chan_t;
+
+/**
+ * @brief   Post @p event to @p queue whenever @p chan reaches @p threshold
+ *          filled slots
+ *
+ * @param[out]  event       event to initialize, must stay valid as long
+ *                          as it is attached
+ * @param[in]   chan        channel to attach to as consumer
+ * @param[in]   queue       queue to post the event to
+ * @param[in]   handler     handler of the event
+ * @param[in]   threshold   number of filled slots to notify at, at least 1
+ */
+void event_chan_attach(event_chan_t *event, chan_t *chan,
+                       event_queue_t *queue, event_handler_t handler,
+                       unsigned threshold);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_CHANNEL_H */
+/** @} */
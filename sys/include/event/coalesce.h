@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides an event that counts how often it was posted
+ *
+ * Posting an event that is already queued has no effect, so a plain event
+ * posted by a bursty source (e.g. an interrupt) loses how often the source
+ * fired. A coalescing event counts the posts until its handler takes the
+ * count, so a burst is handled by a single call of the handler.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void handler(event_t *event)
+ * {
+ *     event_coalesce_t *ev = container_of(event, event_coalesce_t, super);
+ *     printf("%u interrupts\n", event_coalesce_take(ev));
+ * }
+ *
+ * static event_coalesce_t event = EVENT_COALESCE_INIT(handler);
+ *
+ * static void isr(void *arg)
+ * {
+ *     event_coalesce_post(&queue, &event);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Coalescing event API
+ */
+
+#ifndef EVENT_COALESCE_H
+#define EVENT_COALESCE_H
+
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Coalescing event structure
+ */
+typedef struct {
+    event_t super;              /**< event_t structure that gets extended   */
+    uint16_t count;             /**< posts not yet taken by the handler,
+                                     saturating                             */
+} event_coalesce_t;
+
+/**
+ * @brief   Static initializer for a coalescing event
+ *
+ * @param[in]   _handler    handler of the event
+ */
+#define EVENT_COALESCE_INIT(_handler) { .super.handler = (_handler) }
+
+/**
+ * @brief   Count a post of @p event and queue it if it is not queued yet
+ *
+ * May be called from interrupt context.
+ *
+ * @param[in]   queue   event queue to queue the event in
+ * @param[in]   event   event to post
+ */
+void event_coalesce_post(event_queue_t *queue, event_coalesce_t *event);
+
+/**
+ * @brief   Take the number of posts since the last call
+ *
+ * To be called by the handler of @p event. The count may be 0 if the event
+ * was posted again while its handler was running and already took that
+ * post into account.
+ *
+ * @param[in]   event   event to take the count from
+ *
+ * @return  number of posts, at most UINT16_MAX
+ */
+unsigned event_coalesce_take(event_coalesce_t *event);
+
+/**
+ * @brief   Cancel a queued coalescing event and reset its count
+ *
+ * @param[in]   queue   event queue to remove the event from
+ * @param[in]   event   event to cancel
+ */
+void event_coalesce_cancel(event_queue_t *queue, event_coalesce_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_COALESCE_H */
+/** @} */
@@ -0,0 +1,229 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides an event queue with priority levels
+ *
+ * A priority event queue holds @ref CONFIG_EVENT_PRIO_LEVELS FIFO lists of
+ * events. Level 0 is drained first, events of a level are only returned if
+ * all lower levels are empty. Unlike @ref event_queues_init with an array of
+ * queues, finding the next event does not depend on the number of levels,
+ * and the events are doubly linked so that @ref event_prio_cancel runs in
+ * O(1).
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void handler(event_t *event)
+ * {
+ *     event_prio_t *ev = container_of(event, event_prio_t, super);
+ *     printf("event of level %u\n", ev->level);
+ * }
+ *
+ * static event_prio_t urgent = EVENT_PRIO_INIT(handler, 0);
+ * static event_prio_t background = EVENT_PRIO_INIT(handler, 3);
+ * static event_prio_queue_t queue;
+ *
+ * int main(void)
+ * {
+ *     event_prio_queue_init(&queue);
+ *     event_prio_loop(&queue);
+ * }
+ *
+ * [...] event_prio_post(&queue, &urgent);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue API
+ */
+
+#ifndef EVENT_PRIO_H
+#define EVENT_PRIO_H
+
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of priority levels of a queue, at most 8
+ */
+#ifndef CONFIG_EVENT_PRIO_LEVELS
+#define CONFIG_EVENT_PRIO_LEVELS    (4)
+#endif
+
+/**
+ * @brief   Priority event structure forward declaration
+ */
+typedef struct event_prio event_prio_t;
+
+/**
+ * @brief   Priority event structure
+ */
+struct event_prio {
+    event_t super;          /**< event_t structure that gets extended   */
+    event_prio_t *next;     /**< next event of the same level           */
+    event_prio_t *prev;     /**< previous event of the same level,
+                                 NULL if not queued                     */
+    uint8_t level;          /**< level to queue the event at, 0 is
+                                 handled first                          */
+};
+
+/**
+ * @brief   Priority event queue structure
+ */
+typedef struct {
+    event_prio_t *levels[CONFIG_EVENT_PRIO_LEVELS]; /**< oldest event of
+                                                         each level     */
+    thread_t *waiter;       /**< thread owning the queue                */
+    uint8_t pending;        /**< bit n set if level n is not empty      */
+} event_prio_queue_t;
+
+/**
+ * @brief   Static initializer for a priority event
+ *
+ * @param[in]   _handler    handler of the event
+ * @param[in]   _level      level to queue the event at
+ */
+#define EVENT_PRIO_INIT(_handler, _level) { \
+        .super.handler = (_handler), \
+        .level = (_level), \
+}
+
+/**
+ * @brief   event_prio_queue_t static initializer
+ */
+#define EVENT_PRIO_QUEUE_INIT           { .waiter = thread_get_active() }
+
+/**
+ * @brief   Static initializer for detached priority event queues
+ */
+#define EVENT_PRIO_QUEUE_INIT_DETACHED  { .waiter = NULL }
+
+/**
+ * @brief   Initialize a priority event
+ *
+ * @param[out]  event       event to initialize
+ * @param[in]   handler     handler of the event
+ * @param[in]   level       level to queue the event at, below
+ *                          @ref CONFIG_EVENT_PRIO_LEVELS
+ */
+static inline void event_prio_init(event_prio_t *event,
+                                   event_handler_t handler, unsigned level)
+{
+    assert(level < CONFIG_EVENT_PRIO_LEVELS);
+    *event = (event_prio_t)EVENT_PRIO_INIT(handler, level);
+}
+
+/**
+ * @brief   Initialize a priority event queue not binding it to a thread
+ *
+ * @param[out]  queue   queue to initialize
+ */
+static inline void event_prio_queue_init_detached(event_prio_queue_t *queue)
+{
+    *queue = (event_prio_queue_t)EVENT_PRIO_QUEUE_INIT_DETACHED;
+}
+
+/**
+ * @brief   Initialize a priority event queue owned by the calling thread
+ *
+ * @param[out]  queue   queue to initialize
+ */
+static inline void event_prio_queue_init(event_prio_queue_t *queue)
+{
+    *queue = (event_prio_queue_t)EVENT_PRIO_QUEUE_INIT;
+}
+
+/**
+ * @brief   Bind a priority event queue to the calling thread
+ *
+ * @pre     (queue->waiter == NULL)
+ *
+ * @param[out]  queue   queue to bind to a thread
+ */
+static inline void event_prio_queue_claim(event_prio_queue_t *queue)
+{
+    assert(queue->waiter == NULL);
+    queue->waiter = thread_get_active();
+}
+
+/**
+ * @brief   Queue an event at the end of its level
+ *
+ * Reposting an event that is already queued has no effect.
+ *
+ * May be called from interrupt context.
+ *
+ * @param[in]   queue   queue to post to
+ * @param[in]   event   event to post
+ */
+void event_prio_post(event_prio_queue_t *queue, event_prio_t *event);
+
+/**
+ * @brief   Remove a queued event from its queue in O(1)
+ *
+ * Cancelling an event that is not queued has no effect.
+ *
+ * @param[in]   queue   queue the event was posted to
+ * @param[in]   event   event to remove
+ */
+void event_prio_cancel(event_prio_queue_t *queue, event_prio_t *event);
+
+/**
+ * @brief   Get the oldest event of the highest non-empty level, non-blocking
+ *
+ * @param[in]   queue   queue to get the event from
+ *
+ * @return  the event
+ * @retval  NULL    if the queue is empty
+ */
+event_prio_t *event_prio_get(event_prio_queue_t *queue);
+
+/**
+ * @brief   Get the oldest event of the highest non-empty level, blocking
+ *
+ * @warning There can only be a single waiter on a queue!
+ *
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_prio_queue_init)
+ *
+ * @param[in]   queue   queue to get the event from
+ *
+ * @return  the event
+ */
+event_prio_t *event_prio_wait(event_prio_queue_t *queue);
+
+/**
+ * @brief   Simple event loop over a priority event queue
+ *
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_prio_queue_init)
+ *
+ * @param[in]   queue   queue to process
+ */
+static inline void event_prio_loop(event_prio_queue_t *queue)
+{
+    event_prio_t *event;
+
+    while ((event = event_prio_wait(queue))) {
+        event->super.handler(&event->super);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_PRIO_H */
+/** @} */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_malloc_ts_cache  Per-thread malloc caches
+ * @ingroup     sys_malloc_ts
+ * @brief       Thread-local free lists for small allocations in front of the
+ *              thread safe malloc wrappers
+ *
+ * With the `malloc_thread_cache` module, the wrappers of @ref sys_malloc_ts
+ * serve small allocations from per-thread free lists of a few size classes.
+ * A thread only takes the allocator lock when its free list of a size class
+ * runs empty or full: it then fetches or returns
+ * @ref CONFIG_MALLOC_THREAD_CACHE_BATCH blocks at once. This reduces the time
+ * threads spend waiting for each other (and the priority inversion that comes
+ * with it) when several threads allocate concurrently.
+ *
+ * The allocator backend (the C library or `tlsf-malloc`) is not touched, so
+ * this works with either of them.
+ *
+ * Costs:
+ * - every allocation (not only the cached ones) is preceded by a header of
+ *   `sizeof(max_align_t)` bytes,
+ * - small allocations are rounded up to their size class,
+ * - up to @ref CONFIG_MALLOC_THREAD_CACHE_DEPTH blocks per size class stay
+ *   allocated in the cache of each thread until it exits. Threads can return
+ *   their cached blocks earlier with @ref malloc_thread_cache_flush.
+ *
+ * Blocks the C library allocates internally, bypassing the wrappers, have no
+ * such header. They are recognized when freed and passed to the allocator
+ * backend unchanged.
+ *
+ * @note    This module only has an effect on platforms that use
+ *          @ref sys_malloc_ts.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Per-thread malloc cache API
+ */
+
+#ifndef MALLOC_THREAD_CACHE_H
+#define MALLOC_THREAD_CACHE_H
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_malloc_ts_cache_conf  Per-thread malloc cache configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of cached size classes
+ *
+ * Size class i holds blocks of up to
+ * @ref CONFIG_MALLOC_THREAD_CACHE_MIN_SIZE << i bytes.
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_CLASSES
+#define CONFIG_MALLOC_THREAD_CACHE_CLASSES      3
+#endif
+
+/**
+ * @brief   Block size of the smallest size class in bytes
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_MIN_SIZE
+#define CONFIG_MALLOC_THREAD_CACHE_MIN_SIZE     16
+#endif
+
+/**
+ * @brief   Maximum number of blocks cached per thread and size class
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_DEPTH
+#define CONFIG_MALLOC_THREAD_CACHE_DEPTH        8
+#endif
+
+/**
+ * @brief   Number of blocks fetched from or returned to the allocator at once
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_BATCH
+#define CONFIG_MALLOC_THREAD_CACHE_BATCH        4
+#endif
+/** @} */
+
+/**
+ * @brief   Per-thread cache statistics
+ */
+typedef struct {
+    uint32_t hits;      /**< allocations served from the cache */
+    uint32_t refills;   /**< batches fetched from the allocator */
+    uint32_t drains;    /**< batches returned to the allocator */
+    uint16_t cached;    /**< number of blocks currently held in the cache */
+} malloc_thread_cache_stats_t;
+
+/**
+ * @brief   Return all blocks cached by the calling thread to the allocator
+ *
+ * @pre     Must be called in thread context
+ */
+void malloc_thread_cache_flush(void);
+
+/**
+ * @brief   Get the cache statistics of a thread
+ *
+ * @param[in]   pid     thread to get the statistics of
+ * @param[out]  stats   statistics of @p pid
+ */
+void malloc_thread_cache_stats(kernel_pid_t pid,
+                               malloc_thread_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MALLOC_THREAD_CACHE_H */
+/** @} */
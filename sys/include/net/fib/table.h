@@ -24,6 +24,7 @@
 #include "sched.h"
 #include "universal_address.h"
 #include "mutex.h"
+#include "xtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,6 +36,24 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief Node of the longest-prefix-match trie of a FIB table
+ *
+ * The trie is path compressed: a node either belongs to an entry and
+ * represents its destination prefix, or it is a branching node that joins
+ * two sub-tries diverging at bit @ref fib_trie_node_t::bits.
+ */
+typedef struct fib_trie_node {
+    /** sub-tries, selected by the bit following the first `bits` bits */
+    struct fib_trie_node *child[2];
+    /** next entry with the very same prefix (entry nodes only) */
+    struct fib_trie_node *same;
+    /** length in bits of the prefix shared by all nodes of this sub-trie */
+    uint16_t bits;
+    /** kind of this node (unused, entry or branching node) */
+    uint8_t type;
+} fib_trie_node_t;
+
 /**
  * @brief Container descriptor for a FIB entry
  */
@@ -51,6 +70,10 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+    /** node representing this entry in the LPM trie of the table */
+    fib_trie_node_t node;
+    /** spare branching node, may be used by the trie for any entry */
+    fib_trie_node_t glue;
 } fib_entry_t;
 
 /**
@@ -133,6 +156,16 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** root of the longest-prefix-match trie over the single hop entries */
+    fib_trie_node_t *trie;
+    /** unused branching nodes of the trie */
+    fib_trie_node_t *trie_free;
+    /** timer triggering the removal of expired entries */
+    xtimer_t expiry_timer;
+    /** earliest absolute lifetime of all entries in this table */
+    uint64_t next_expiry;
+    /** set by @ref fib_table_t::expiry_timer once entries have expired */
+    volatile uint8_t expiry_pending;
 } fib_table_t;
 
 #ifdef __cplusplus
@@ -146,6 +146,19 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Number of forwarded flows the next hop is cached for
+ *
+ * @note    Only applicable with module `gnrc_ipv6_fwd_cache`.
+ *
+ * A flow is identified by its destination address and the interface it is
+ * received on. When more flows are forwarded, the least recently forwarded
+ * one is replaced.
+ */
+#ifndef CONFIG_GNRC_IPV6_FWD_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_FWD_CACHE_SIZE        (8U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -204,6 +217,14 @@ extern kernel_pid_t gnrc_ipv6_pid;
 extern fib_table_t gnrc_ipv6_fib_table;
 #endif
 
+/**
+ * @brief   Statistics of the forwarding cache
+ */
+typedef struct {
+    uint32_t hits;      /**< forwarded packets with a cached next hop */
+    uint32_t misses;    /**< forwarded packets that needed a NIB lookup */
+} gnrc_ipv6_fwd_cache_stats_t;
+
 /**
  * @brief   Initialization of the IPv6 thread.
  *
@@ -229,6 +250,20 @@ kernel_pid_t gnrc_ipv6_init(void);
  */
 ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Get the current statistics of the forwarding cache
+ *
+ * With module `gnrc_ipv6_fwd_cache`, a router keeps the next hop of the last
+ * @ref CONFIG_GNRC_IPV6_FWD_CACHE_SIZE forwarded flows, so packets of a known
+ * flow are forwarded without resolving the next hop with the
+ * @ref net_gnrc_ipv6_nib "NIB". A cached next hop is discarded when the
+ * @ref gnrc_ipv6_nib_version() "version of the NIB" changes.
+ *
+ * @return  The current statistics of the forwarding cache.
+ * @return  NULL, if module `gnrc_ipv6_fwd_cache` is not compiled in.
+ */
+const gnrc_ipv6_fwd_cache_stats_t *gnrc_ipv6_fwd_cache_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -358,6 +358,21 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets the version of the NIB
+ *
+ * The version changes whenever the NIB changes in a way that may change the
+ * result of @ref gnrc_ipv6_nib_get_next_hop_l2addr() for any destination,
+ * e.g. when a neighbor changes its reachability state or link-layer address,
+ * or when a route, prefix, or default router is added or removed.
+ *
+ * A result of @ref gnrc_ipv6_nib_get_next_hop_l2addr() may be reused as long
+ * as the version read *before* the call did not change.
+ *
+ * @return  The current version of the NIB.
+ */
+uint32_t gnrc_ipv6_nib_version(void);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
@@ -54,6 +54,31 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_batch   Batched dispatch extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Pass bursts of packets between GNRC modules in one message
+ * @{
+ * @details The submodule `gnrc_netapi_batch` allows to hand up to
+ *          @ref CONFIG_GNRC_NETAPI_BATCH_SIZE packets to a thread in a single
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH or
+ *          @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH message. Under load, this
+ *          saves a message and usually a context switch per packet.
+ *
+ * A producer collects packets in a @ref gnrc_netapi_batch_t with
+ * @ref gnrc_netapi_batch_dispatch() or @ref gnrc_netapi_batch_send() and
+ * calls @ref gnrc_netapi_batch_flush() before it blocks waiting for new work.
+ * Only subscribers registered with @ref GNRC_NETREG_TYPE_BATCH and
+ * @ref net_gnrc_netif threads get batch messages; all other subscribers
+ * get the packets one by one as before.
+ *
+ * To use, add the module `gnrc_netapi_batch` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_batch
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
@@ -93,6 +118,44 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a batch of packets up the network
+ *          stack
+ *
+ * The content pointer of the message points to a batch carrier. Use
+ * @ref gnrc_netapi_batch_numof() and @ref gnrc_netapi_batch_get() to access
+ * the packets and release the carrier with @ref gnrc_pktbuf_release()
+ * afterwards.
+ *
+ * @note    Only sent with @ref net_gnrc_netapi_batch.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0207)
+
+/**
+ * @brief   @ref core_msg type for passing a batch of packets down the network
+ *          stack
+ *
+ * @see     @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *
+ * @note    Only sent with @ref net_gnrc_netapi_batch.
+ */
+#define GNRC_NETAPI_MSG_TYPE_SND_BATCH  (0x0208)
+
+/**
+ * @defgroup net_gnrc_netapi_conf GNRC NETAPI compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Maximum number of packets in a batch
+ *
+ * @note    Only used with @ref net_gnrc_netapi_batch.
+ */
+#ifndef CONFIG_GNRC_NETAPI_BATCH_SIZE
+#define CONFIG_GNRC_NETAPI_BATCH_SIZE   (8U)
+#endif
+/** @} */
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -261,6 +324,150 @@ static inline int gnrc_netapi_set(kernel_pid_t pid, netopt_t opt,
                                 GNRC_NETAPI_MSG_TYPE_SET);
 }
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Packets collected by a thread for a single target
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * All members are private.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETAPI_BATCH_SIZE];    /**< the packets */
+    uint32_t demux_ctx;     /**< demultiplexing context of the target */
+    gnrc_nettype_t type;    /**< protocol type of the target */
+    kernel_pid_t pid;       /**< PID of the target, if not dispatched */
+    uint16_t cmd;           /**< command for the target */
+    uint8_t numof;          /**< number of packets in gnrc_netapi_batch_t::pkts */
+} gnrc_netapi_batch_t;
+
+/**
+ * @brief   Sends @p cmd for each of @p pkts to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * Has the same effect as calling @ref gnrc_netapi_dispatch() for each packet,
+ * but subscribers registered with @ref GNRC_NETREG_TYPE_BATCH get all of
+ * @p pkts in a single message.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] cmd       command for all subscribers. Must be either
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV
+ * @param[in] pkts      the packets to send
+ * @param[in] numof     number of packets in @p pkts.
+ *                      Must not exceed @ref CONFIG_GNRC_NETAPI_BATCH_SIZE.
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+int gnrc_netapi_dispatch_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t *const *pkts,
+                               unsigned numof);
+
+/**
+ * @brief   Sends @p pkts in a single message to a thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] pid       PID of the targeted network module, must handle
+ *                      batch messages
+ * @param[in] cmd       Must be either @ref GNRC_NETAPI_MSG_TYPE_SND or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV
+ * @param[in] pkts      the packets to send
+ * @param[in] numof     number of packets in @p pkts.
+ *                      Must not exceed @ref CONFIG_GNRC_NETAPI_BATCH_SIZE.
+ *
+ * @return  1 if the packets were successfully delivered
+ * @return  -1 on error (invalid PID or no space in queue), the packets
+ *          are not released then
+ */
+int gnrc_netapi_send_batch(kernel_pid_t pid, uint16_t cmd,
+                           gnrc_pktsnip_t *const *pkts, unsigned numof);
+
+/**
+ * @brief   Collects a packet for all subscribers to (@p type, @p demux_ctx)
+ *
+ * Sends the packets collected in @p batch before, if they have a different
+ * target or @p batch is full.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in,out] batch     collected packets of the calling thread
+ * @param[in] type          protocol type of the targeted network module.
+ * @param[in] demux_ctx     demultiplexing context for @p type.
+ * @param[in] cmd           command for all subscribers
+ * @param[in] pkt           the packet
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx). If 0, @p pkt
+ *         was not collected.
+ */
+int gnrc_netapi_batch_dispatch(gnrc_netapi_batch_t *batch,
+                               gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Collects a packet to send to a thread
+ *
+ * Sends the packets collected in @p batch before, if they have a different
+ * target or @p batch is full.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in,out] batch     collected packets of the calling thread
+ * @param[in] pid           PID of the targeted network module, must handle
+ *                          batch messages
+ * @param[in] pkt           the packet to send
+ */
+void gnrc_netapi_batch_send(gnrc_netapi_batch_t *batch, kernel_pid_t pid,
+                            gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Sends all packets collected in @p batch
+ *
+ * Packets that can't be delivered are released.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in,out] batch     collected packets of the calling thread
+ */
+void gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch);
+
+/**
+ * @brief   Get the number of packets in a batch carrier
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] carrier   content of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH message
+ *
+ * @return  number of packets in @p carrier
+ */
+static inline unsigned gnrc_netapi_batch_numof(const gnrc_pktsnip_t *carrier)
+{
+    return carrier->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Get a packet of a batch carrier
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @param[in] carrier   content of a @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH message
+ * @param[in] idx       index of the packet,
+ *                      < gnrc_netapi_batch_numof(@p carrier)
+ *
+ * @return  the packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_batch_get(const gnrc_pktsnip_t *carrier,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t *const *)carrier->data)[idx];
+}
+#endif /* defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,6 +39,7 @@
 #include "msg_bus.h"
 #endif
 #include "event.h"
+#include "event/coalesce.h"
 #include "net/ipv6/addr.h"
 #include "net/gnrc/netapi.h"
 #include "net/gnrc/pkt.h"
@@ -164,8 +165,22 @@ typedef struct {
     event_queue_t evq[GNRC_NETIF_EVQ_NUMOF];
     /**
      * @brief   ISR event for the network device
+     *
+     * Interrupts of the device that occur before the event is handled are
+     * coalesced into a single call of netdev_driver_t::isr().
+     */
+    event_coalesce_t event_isr;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Received packets not yet passed on to the upper layer
+     *
+     * @details Only provided with module `gnrc_netapi_batch`
+     *
+     * Filled while the event queue is drained and flushed before the
+     * interface thread waits for new events or messages.
      */
-    event_t event_isr;
+    gnrc_netapi_batch_t rx_batch;
+#endif
 #if IS_USED(MODULE_NETDEV_NEW_API) || defined(DOXYGEN)
     /**
      * @brief   TX done event for the network device
@@ -36,7 +36,7 @@ extern "C" {
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
 /**
  *  @brief  The type of the netreg entry.
  *
@@ -51,6 +51,17 @@ typedef enum {
      *          `gnrc_netapi_callbacks` modules.
      */
     GNRC_NETREG_TYPE_DEFAULT = 0,
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Use [default IPC](@ref core_msg) for
+     *          [netapi](@ref net_gnrc_netapi) operations. The thread also
+     *          handles @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH and
+     *          @ref GNRC_NETAPI_MSG_TYPE_SND_BATCH messages.
+     *
+     * @note    Only available with `gnrc_netapi_batch` module.
+     */
+    GNRC_NETREG_TYPE_BATCH,
+#endif
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
     /**
      * @brief   Use [centralized IPC](@ref core_mbox) for
@@ -79,6 +90,30 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC netreg compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per network type as exponent of 2
+ *
+ * With module `gnrc_netreg_hash` entries with a
+ * @ref gnrc_netreg_entry_t::demux_ctx "demux context" other than
+ * @ref GNRC_NETREG_DEMUX_CTX_ALL are kept in
+ * 2^CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP buckets per network type, so a
+ * lookup only walks the entries that share a bucket with the demux context.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP     (3U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of hash buckets per network type
+ */
+#define GNRC_NETREG_HASH_BUCKETS    (1U << CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP)
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -93,7 +128,8 @@ typedef enum {
  *
  * @return  An initialized netreg entry
  */
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
                                                       { pid } }
@@ -101,6 +137,24 @@ typedef enum {
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
 #endif
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry statically with PID of a thread that
+ *          accepts batches of packets
+ *
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ *
+ * @return  An initialized netreg entry
+ */
+#define GNRC_NETREG_ENTRY_INIT_PID_BATCH(demux_ctx, pid)    { NULL, demux_ctx, \
+                                                              GNRC_NETREG_TYPE_BATCH, \
+                                                              { pid } }
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry statically with mbox
@@ -181,12 +235,13 @@ typedef struct gnrc_netreg_entry {
      */
     uint32_t demux_ctx;
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
-    defined(DOXYGEN)
+    defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
     /**
      * @brief   Type of the registry entry
      *
-     * @note    Only available with @ref net_gnrc_netapi_mbox or
-     *          @ref net_gnrc_netapi_callbacks.
+     * @note    Only available with @ref net_gnrc_netapi_mbox,
+     *          @ref net_gnrc_netapi_callbacks, or
+     *          @ref net_gnrc_netapi_batch.
      */
     gnrc_netreg_type_t type;
 #endif
@@ -229,9 +284,14 @@ typedef struct gnrc_netreg_entry {
  * gnrc_netreg_register and @ref gnrc_netreg_unregister). The current
  * implementation priorizes shared locks. This means that shared locks are
  * generally acquired fast (they only block if an exclusive operation has
- * already started), but constant access through shared locks might starve
+ * already started, and only the first shared lock and the release of the last
+ * one touch a mutex), but constant access through shared locks might starve
  * registration and deregistration.
  *
+ * This is a lock, not a lock-free read path: readers rely on the registry not
+ * changing while they hold it, e.g. to hand out as many references to a
+ * packet as @ref gnrc_netreg_num reported before iterating the entries.
+ *
  * @{
  */
 
@@ -275,12 +335,36 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
 {
     entry->next = NULL;
     entry->demux_ctx = demux_ctx;
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
 }
 
+#if defined(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Initializes a netreg entry dynamically with PID of a thread that
+ *          accepts batches of packets
+ *
+ * @param[out] entry    A netreg entry
+ * @param[in] demux_ctx The @ref gnrc_netreg_entry_t::demux_ctx "demux context"
+ *                      for the netreg entry
+ * @param[in] pid       The PID of the registering thread
+ *
+ * @note    Only available with @ref net_gnrc_netapi_batch.
+ */
+static inline void gnrc_netreg_entry_init_pid_batch(gnrc_netreg_entry_t *entry,
+                                                    uint32_t demux_ctx,
+                                                    kernel_pid_t pid)
+{
+    entry->next = NULL;
+    entry->demux_ctx = demux_ctx;
+    entry->type = GNRC_NETREG_TYPE_BATCH;
+    entry->target.pid = pid;
+}
+#endif
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
 /**
  * @brief   Initializes a netreg entry dynamically with mbox
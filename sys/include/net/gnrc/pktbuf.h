@@ -18,6 +18,12 @@
  *          this *will* lead to alignment problems and can potentially result
  *          in segmentation/hard faults and other unexpected behaviour.
  *
+ * With the `gnrc_pktbuf_slab` module, packet snip descriptors and small chunks
+ * of the static packet buffer (i.e. most headers) are taken from fixed size
+ * classes in constant time, so only larger chunks are allocated from its
+ * arena (see @ref CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF and following). This
+ * keeps the arena from fragmenting under mixed traffic.
+ *
  * @{
  *
  * @file
@@ -63,6 +69,43 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors kept in their own size class
+ *
+ * @note    Only used with the `gnrc_pktbuf_slab` module. The size classes of
+ *          that module are allocated in addition to @ref CONFIG_GNRC_PKTBUF_SIZE.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF  (16)
+#endif
+
+/**
+ * @brief   Number of 16 byte chunks for small headers
+ *
+ * @note    Only used with the `gnrc_pktbuf_slab` module.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_16_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_16_NUMOF    (8)
+#endif
+
+/**
+ * @brief   Number of 32 byte chunks for medium sized headers
+ *
+ * @note    Only used with the `gnrc_pktbuf_slab` module.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_32_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_32_NUMOF    (8)
+#endif
+
+/**
+ * @brief   Number of 64 byte chunks for large headers (e.g. IPv6 headers)
+ *
+ * @note    Only used with the `gnrc_pktbuf_slab` module.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_64_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_64_NUMOF    (8)
+#endif
 /** @} */
 
 /**
@@ -94,6 +137,31 @@ void gnrc_pktbuf_init(void);
 gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
                                 gnrc_nettype_t type);
 
+/**
+ * @brief   Adds a new, empty gnrc_pktsnip_t to receive a frame into.
+ *
+ * Network interfaces pass gnrc_pktsnip_t::data of the result directly to the
+ * device driver to read a frame into. The data is placed so that the data
+ * behind the first @p hdr_len bytes has the alignment of the packet buffer.
+ * If @p hdr_len is the length of the link layer header, that header and the
+ * network and transport layer headers behind it can later be split off with
+ * @ref gnrc_pktbuf_mark() by only adjusting pointers and lengths instead of
+ * copying the frame.
+ *
+ * @pre size < CONFIG_GNRC_PKTBUF_SIZE
+ *
+ * @param[in] size      Maximum length of the frame. Must not be 0.
+ * @param[in] hdr_len   Expected length of the link layer header of the frame.
+ *                      A wrong guess only costs a copy of that header on
+ *                      @ref gnrc_pktbuf_mark().
+ * @param[in] type      Protocol type of the gnrc_pktsnip_t.
+ *
+ * @return  Pointer to the packet part that represents the new gnrc_pktsnip_t.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_add_rx(size_t size, size_t hdr_len,
+                                   gnrc_nettype_t type);
+
 /**
  * @brief   Marks the first @p size bytes in a received packet with a new
  *          packet snip that is appended to the packet.
@@ -121,7 +189,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
  * @param[in] type  The type of the new packet snip.
  *
  * @note    It's not guaranteed that `result->data` points to the same address
- *          as the original `pkt->data`.
+ *          as the original `pkt->data`. With the static packet buffer it
+ *          does, if `pkt->data + size` is suitably aligned (see
+ *          @ref gnrc_pktbuf_add_rx()). Otherwise only the marked section is
+ *          copied.
  *
  * @return  The new packet snip in @p pkt on success.
  * @return  NULL, if pkt == NULL or size == 0 or size > pkt->size or pkt->data == NULL.
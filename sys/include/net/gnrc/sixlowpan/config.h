@@ -53,6 +53,19 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Number of flows the IPHC header encoding is cached for
+ *
+ * Packets of a flow share the same compressed header, apart from the UDP
+ * checksum. A flow is identified by the IPv6 header, apart from the payload
+ * length, the UDP ports and the link-layer destination.
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_iphc_cache` module
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (4U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
@@ -121,6 +134,39 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Maximum size of a datagram in the reassembly buffer in bytes
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * The received parts of a datagram are tracked in a bitmap of 8-octet units
+ * within each (virtual) reassembly buffer entry, so this value determines the
+ * size of these entries. Fragments of larger datagrams are dropped. Defaults
+ * to the largest datagram size expressible in a RFC 4944 fragment header.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DATAGRAM_SIZE_MAX
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DATAGRAM_SIZE_MAX      (2047U)
+#endif
+
+/**
+ * @brief   Number of partially received 8-octet units tracked per (virtual)
+ *          reassembly buffer entry
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * Fragments that do not start or end at a multiple of 8 octets, i.e. the
+ * first fragment of a compressed datagram, the last fragment of a datagram,
+ * and any fragment with selective fragment recovery, cover some units only
+ * partially. The octets received of those units are tracked in this many
+ * records until the units are complete. Fragments that would need more
+ * records are dropped.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_PARTIAL_UNITS
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_PARTIAL_UNITS          (4U)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -145,9 +191,7 @@ extern "C" {
  * @see     https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  *
  * @note    Only applicable with
- *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module,
- *          but has also a direct influence on the number of available
- *          gnrc_sixlowpan_frag_rb_int_t entries.
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module
  */
 #ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
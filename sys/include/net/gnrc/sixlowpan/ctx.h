@@ -118,14 +118,27 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
 /**
  * @brief   Removes context.
  *
- * @param[in] id    A context ID.
+ * @note    Can be called from interrupt context.
+ *
+ * @param[in] id    A context ID. Must be < @ref GNRC_SIXLOWPAN_CTX_SIZE.
  */
-static inline void gnrc_sixlowpan_ctx_remove(uint8_t id)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_CTX)) {
-        gnrc_sixlowpan_ctx_lookup_id(id)->prefix_len = 0;
-    }
-}
+void gnrc_sixlowpan_ctx_remove(uint8_t id);
+
+/**
+ * @brief   Gets the version of the contexts.
+ *
+ * The version changes whenever a context is updated or removed or the
+ * lifetime of a context used for compression ends. Users can keep results
+ * derived from the contexts as long as the version does not change.
+ *
+ * @note    Contexts changed through the pointers returned by
+ *          gnrc_sixlowpan_ctx_lookup_addr() and gnrc_sixlowpan_ctx_lookup_id()
+ *          don't change the version. Use gnrc_sixlowpan_ctx_update() and
+ *          gnrc_sixlowpan_ctx_remove() instead.
+ *
+ * @return  The current version.
+ */
+uint32_t gnrc_sixlowpan_ctx_version(void);
 
 /**
  * @brief   Check if a prefix matches a compression context
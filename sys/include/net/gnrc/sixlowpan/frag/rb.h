@@ -25,6 +25,7 @@
 #include <stdalign.h>
 
 #include "architecture.h"
+#include "bitfield.h"
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
@@ -42,23 +43,35 @@ extern "C" {
 #define GNRC_SIXLOWPAN_FRAG_RB_GC_MSG       (0x0226)
 
 /**
- * @brief   Fragment intervals to identify limits of fragments and duplicates.
+ * @brief   Size of the units received fragments are tracked in
  *
- * @note    Fragments MUST NOT overlap and overlapping fragments are to be
- *          discarded
+ * Fragment offsets are expressed in units of 8 octets.
  *
  * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
  *          RFC 4944, section 5.3
  *      </a>
  */
-typedef struct gnrc_sixlowpan_frag_rb_int {
+#define GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE    (8U)
+
+/**
+ * @brief   Number of units tracked per reassembly buffer entry
+ */
+#define GNRC_SIXLOWPAN_FRAG_RB_UNITS \
+    ((CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DATAGRAM_SIZE_MAX + \
+      GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE - 1) / GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE)
+
+/**
+ * @brief   A partially received unit
+ */
+typedef struct {
+    uint16_t unit;      /**< index of the unit */
     /**
-     * @brief   next element in fragment interval list
+     * @brief   Received octets of the unit, bit i for octet i
+     *
+     * 0 if the record is unused.
      */
-    struct gnrc_sixlowpan_frag_rb_int *next;
-    uint16_t start;             /**< start byte of the fragment interval */
-    uint16_t end;               /**< end byte of the fragment interval */
-} gnrc_sixlowpan_frag_rb_int_t;
+    uint8_t octets;
+} gnrc_sixlowpan_frag_rb_part_t;
 
 /**
  * @brief   Base class for both reassembly buffer and virtual reassembly buffer
@@ -74,7 +87,25 @@ typedef struct gnrc_sixlowpan_frag_rb_int {
  * @see https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  */
 typedef struct {
-    gnrc_sixlowpan_frag_rb_int_t *ints;         /**< intervals of already received fragments */
+    /**
+     * @brief   Units all octets of which were received
+     *
+     * @note    Fragments MUST NOT overlap and overlapping fragments are to be
+     *          discarded
+     *
+     * @see <a href="https://tools.ietf.org/html/rfc4944#section-5.3">
+     *          RFC 4944, section 5.3
+     *      </a>
+     */
+    BITFIELD(received, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    /**
+     * @brief   First units starting within already received fragments
+     */
+    BITFIELD(starts, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    /**
+     * @brief   Units only some octets of which were received
+     */
+    gnrc_sixlowpan_frag_rb_part_t parts[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_PARTIAL_UNITS];
     uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
     uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination address */
     uint8_t src_len;                            /**< length of gnrc_sixlowpan_frag_rb_t::src */
@@ -237,6 +268,19 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void);
  */
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry);
 
+/**
+ * @brief   Merge the received parts of a base entry into another
+ *
+ * A partially received unit that can't be tracked in @p dst anymore is taken
+ * as received completely, so that later fragments overlapping it are
+ * treated as overlapping.
+ *
+ * @param[in,out] dst   Entry to merge into
+ * @param[in] src       Entry to merge from
+ */
+void gnrc_sixlowpan_frag_rb_base_merge(gnrc_sixlowpan_frag_rb_base_t *dst,
+                                       const gnrc_sixlowpan_frag_rb_base_t *src);
+
 /**
  * @brief   Garbage collect reassembly buffer.
  */
@@ -269,18 +313,14 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
  *
  * @pre `rbuf != NULL`
  *
- * This functions sets rbuf_t::super::pkt to NULL and removes all rbuf::ints.
+ * This functions sets rbuf_t::super::pkt to NULL, clears the received units
+ * and removes the entry from the lookup index.
  *
  * @note    Does nothing if module `gnrc_sixlowpan_frag_rb` is not included.
  *
  * @param[in] rbuf  A reassembly buffer entry. Must not be NULL.
  */
-static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    assert(rbuf != NULL);
-    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
-    rbuf->pkt = NULL;
-}
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf);
 #else
 /* NOPs to be used with gnrc_sixlowpan_iphc if gnrc_sixlowpan_frag_rb is not
  * compiled in */
@@ -293,19 +333,18 @@ static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
 
 #if defined(TEST_SUITES) || defined(DOXYGEN)
 /**
- * @brief   Check if pool of fragment intervals is empty
+ * @brief   Check if all unused reassembly buffer entries are cleared, i.e. no
+ *          received units were left behind by removing an entry
  *
- * @see     @ref gnrc_sixlowpan_frag_rb_int_t
  * @note    Returns only non-true values if @ref TEST_SUITES is defined.
  *
- * @return  true, if pool of fragment intervals is empty
- * @return  false, if pool of fragment intervals is not empty
+ * @return  true, if no unused entry has received units set
+ * @return  false, if an unused entry still has received units set
  */
 bool gnrc_sixlowpan_frag_rb_ints_empty(void);
 #else   /* defined(TEST_SUITES) || defined(DOXYGEN) */
 /* always true without TEST_SUITES defined to optimize out when not testing,
- * as checking the status of the fragment interval pool is unnecessary in
- * production */
+ * as checking the status of unused entries is unnecessary in production */
 static inline bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 {
     return true;
@@ -214,6 +214,9 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Transmitted data is retransmitted in the background until it is
+ *       acknowledged, up to CONFIG_GNRC_TCP_RTX_QUEUE_SIZE segments are in
+ *       flight.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -154,6 +154,30 @@ extern "C" {
 #define CONFIG_GNRC_TCP_RTO_K (4U)
 #endif
 
+/**
+ * @brief Number of segments in the retransmission queue, i.e. the maximum
+ *        number of unacknowledged segments in flight. Default is 4.
+ *
+ * @note A value of 1 limits a connection to one segment per round trip.
+ *       At most 254 segments are supported.
+ */
+#ifndef CONFIG_GNRC_TCP_RTX_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RTX_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Number of segments in the out-of-order queue, i.e. the maximum
+ *        number of received segments held back until a gap before them
+ *        is filled. Default is 4.
+ *
+ * @note Segments are only accepted within the receive window. With the
+ *       default window of one MSS (see @ref CONFIG_GNRC_TCP_MSS_MULTIPLICATOR),
+ *       full sized segments never arrive out of order.
+ */
+#ifndef CONFIG_GNRC_TCP_OOO_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_OOO_QUEUE_SIZE (4U)
+#endif
+
 /**
  * @brief Lower bound for the duration between probes in milliseconds. Default is 1 seconds
  */
@@ -20,6 +20,8 @@
 #ifndef NET_GNRC_TCP_TCB_H
 #define NET_GNRC_TCP_TCB_H
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -28,6 +30,7 @@
 #include "msg.h"
 #include "mbox.h"
 #include "net/gnrc/pkt.h"
+#include "congure/reno.h"
 #include "config.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -38,6 +41,32 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Segment in the retransmission queue of a TCB.
+ */
+typedef struct {
+    congure_snd_msg_t msg;  /**< Send time, sequence number consumption and
+                                 number of retransmissions of the segment */
+    gnrc_pktsnip_t *pkt;    /**< Segment, holds a reference in the packet buffer */
+    uint32_t seq;           /**< Sequence number of the segment */
+} gnrc_tcp_rtx_seg_t;
+
+/**
+ * @brief Segment in the out-of-order queue of a TCB.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;    /**< Payload, holds a reference in the packet buffer */
+    uint32_t seq;           /**< Sequence number of the first payload byte */
+    bool fin;               /**< Segment carried a FIN after its payload */
+} gnrc_tcp_ooo_seg_t;
+
+/* The queues are indexed by uint8_t, the retransmission queue holds one entry
+ * more than configured for SYN and FIN */
+static_assert(CONFIG_GNRC_TCP_RTX_QUEUE_SIZE + 1 <= UINT8_MAX,
+              "CONFIG_GNRC_TCP_RTX_QUEUE_SIZE must not exceed 254");
+static_assert(CONFIG_GNRC_TCP_OOO_QUEUE_SIZE <= UINT8_MAX,
+              "CONFIG_GNRC_TCP_OOO_QUEUE_SIZE must not exceed 255");
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -57,12 +86,12 @@ typedef struct sock_tcp {
     uint16_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
+    uint32_t snd_recover;  /**< Send next, when the last loss was detected */
     uint32_t rcv_nxt;      /**< Receive next */
     uint16_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
-    uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
@@ -70,7 +99,16 @@ typedef struct sock_tcp {
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    gnrc_tcp_rtx_seg_t rtx[CONFIG_GNRC_TCP_RTX_QUEUE_SIZE + 1]; /**< Retransmission queue,
+                                                                     one entry is reserved
+                                                                     for SYN and FIN */
+    uint8_t rtx_first;       /**< Index of the oldest segment in @ref rtx */
+    uint8_t rtx_len;         /**< Number of segments in @ref rtx */
+    congure_reno_snd_t cong; /**< Congestion control state */
+    gnrc_tcp_ooo_seg_t ooo[CONFIG_GNRC_TCP_OOO_QUEUE_SIZE]; /**< Out-of-order queue, sorted
+                                                                 by sequence number */
+    uint8_t ooo_len;         /**< Number of segments in @ref ooo */
+    uint32_t ooo_last;       /**< Sequence number of the last segment added to @ref ooo */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
@@ -73,6 +73,58 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Updates an Internet Checksum after a part of its domain changed.
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @details Rewriting e.g. an address or a port of a header doesn't require to
+ *          checksum the whole domain again: the sums of the old and new data
+ *          are enough. Unlike inet_csum_slice(), @p csum and the result are
+ *          the normalized checksum as found in the header.
+ *          As for a full recalculation, the result may be 0x0000. Protocols
+ *          that transmit it as 0xffff (e.g. UDP) need to handle that.
+ *
+ * @param[in] csum      The checksum of the domain before the change, in host
+ *                      byte order.
+ * @param[in] old_buf   The data before the change.
+ * @param[in] new_buf   The data after the change.
+ * @param[in] len       Length of @p old_buf and @p new_buf in byte.
+ * @param[in] accum_len Offset of the changed data within the checksum domain.
+ *
+ * @return  The checksum of the domain after the change.
+ */
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old_buf, const uint8_t *new_buf,
+                          uint16_t len, size_t accum_len);
+
+/**
+ * @brief   Updates an Internet Checksum after a 16-bit word at an even offset
+ *          of its domain changed.
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @param[in] csum      The checksum of the domain before the change, in host
+ *                      byte order.
+ * @param[in] old_word  The word before the change, in host byte order.
+ * @param[in] new_word  The word after the change, in host byte order.
+ *
+ * @return  The checksum of the domain after the change.
+ */
+static inline uint16_t inet_csum_update16(uint16_t csum, uint16_t old_word,
+                                          uint16_t new_word)
+{
+    /* HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum + (uint16_t)~old_word + new_word;
+
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return ~sum;
+}
+
 #ifdef __cplusplus
 }
 #endif
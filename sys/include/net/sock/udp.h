@@ -361,6 +361,28 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A datagram for @ref sock_udp_recv_batch and
+ *          @ref sock_udp_send_batch
+ */
+typedef struct {
+    void *data;             /**< payload of the datagram */
+    /**
+     * @brief   Length of the payload
+     *
+     * For @ref sock_udp_recv_batch this is the space available at
+     * sock_udp_msg_t::data. It is set to the number of bytes received.
+     */
+    size_t len;
+    /**
+     * @brief   Remote end point of the datagram
+     *
+     * May be `NULL`, as the `remote` parameter of @ref sock_udp_recv
+     * resp. @ref sock_udp_send.
+     */
+    sock_udp_ep_t *remote;
+} sock_udp_msg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -785,6 +807,65 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Only waits for the first datagram. After that, only datagrams that are
+ * already waiting at @p sock are received, so the call drains a burst of
+ * datagrams without waiting for more.
+ *
+ * Stacks that can't hand over several datagrams at once receive them one by
+ * one with @ref sock_udp_recv (module `sock_udp_batch`).
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (numof > 0)`
+ * @pre `(msgs[i].data != NULL) && (msgs[i].len > 0)` for all datagrams
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Datagrams to receive into. sock_udp_msg_t::len
+ *                      is set to the number of bytes received and
+ *                      sock_udp_msg_t::remote, if not `NULL`, to the
+ *                      remote end point of the datagram.
+ * @param[in] numof     Number of datagrams in @p msgs.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @note    Function blocks if no packet is currently waiting.
+ *
+ * @return  The number of datagrams received, if at least one datagram was
+ *          received. Datagrams that can't be received (see the errors of
+ *          @ref sock_udp_recv) are dropped in that case.
+ * @return  The errors of @ref sock_udp_recv otherwise.
+ */
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned numof,
+                        uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages to remote end points
+ *
+ * Stacks that can't pass several datagrams on at once send them one by one
+ * with @ref sock_udp_send (module `sock_udp_batch`).
+ *
+ * @pre `(msgs != NULL) && (numof > 0)`
+ * @pre `(sock != NULL) || (msgs[i].remote != NULL)` for all datagrams
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] msgs      Datagrams to send. sock_udp_msg_t::remote may be
+ *                      `NULL`, if @p sock has a remote end point.
+ * @param[in] numof     Number of datagrams in @p msgs.
+ *
+ * @return  The number of datagrams sent on success. If sending a datagram
+ *          fails after at least one datagram was sent, the datagrams sent so
+ *          far are returned and the remaining ones are not sent.
+ * @return  The errors of @ref sock_udp_send for the first datagram.
+ */
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned numof);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
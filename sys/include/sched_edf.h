@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sched_edf Earliest Deadline First Scheduling
+ * @ingroup     sys
+ * @brief       Deadline aware scheduling class on top of the priority
+ *              run queues
+ *
+ *              Periodic threads may join the EDF class with a period, a
+ *              relative deadline and an execution budget. All joined threads
+ *              share the priority @ref CONFIG_SCHED_EDF_PRIO, whose run queue
+ *              is kept sorted by absolute deadline: among the EDF threads,
+ *              the one with the earliest deadline runs. Threads at a higher
+ *              priority still preempt every EDF thread, threads at a lower
+ *              priority only run when no EDF job is pending.
+ *
+ *              A job that runs longer than its budget is counted as an
+ *              overrun, a job that completes after its deadline as a miss.
+ *              The budget is accounted in the scheduler callback
+ *              (see @ref sched_register_cb); the job is neither stopped nor
+ *              demoted on an overrun.
+ *
+ *              Only threads that joined the EDF class must be run at
+ *              @ref CONFIG_SCHED_EDF_PRIO. A thread that priority
+ *              inheritance (`core_mutex_priority_inheritance`) lifts to that
+ *              priority is queued before all EDF threads until it releases
+ *              the mutex. A thread that yields is queued behind the threads
+ *              with an earlier or equal deadline, so it keeps the CPU if its
+ *              deadline is still the earliest. `sched_edf` can't be combined
+ *              with `sched_round_robin`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduling
+ */
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sched.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CONFIG_SCHED_EDF_PRIO
+/**
+ * @brief   Priority level used for the EDF run queue
+ */
+#define CONFIG_SCHED_EDF_PRIO       (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   EDF task descriptor
+ *
+ * All times are in microseconds (@ref ZTIMER_USEC).
+ */
+typedef struct {
+    ztimer_t timer;         /**< release timer */
+    thread_t *thread;       /**< thread of the task */
+    uint32_t period;        /**< release period */
+    uint32_t deadline;      /**< deadline relative to the release */
+    uint32_t budget;        /**< execution budget per job */
+    uint32_t release;       /**< release time of the current job */
+    uint32_t started;       /**< time the task last got the CPU */
+    uint32_t consumed;      /**< CPU time used by the current job */
+    uint32_t jobs;          /**< number of completed jobs */
+    uint32_t misses;        /**< number of jobs completed after their deadline */
+    uint32_t overruns;      /**< number of jobs that exceeded their budget */
+    uint8_t prio;           /**< priority of the thread before joining */
+    bool overrun;           /**< current job exceeded its budget */
+} sched_edf_t;
+
+/**
+ * @brief   Initializes the EDF scheduling class
+ *
+ * Called by auto_init, registers the budget accounting as scheduler
+ * callback.
+ */
+void sched_edf_init(void);
+
+/**
+ * @brief   Let the calling thread join the EDF class
+ *
+ * The first job is released immediately.
+ *
+ * @param[out]  edf         task descriptor, must stay valid until
+ *                          @ref sched_edf_leave
+ * @param[in]   period      release period in µs
+ * @param[in]   deadline    relative deadline in µs, at most @p period
+ * @param[in]   budget      execution budget per job in µs
+ */
+void sched_edf_join(sched_edf_t *edf, uint32_t period, uint32_t deadline,
+                    uint32_t budget);
+
+/**
+ * @brief   Complete the current job and sleep until the next release
+ *
+ * If the next release is already due (the job took longer than a period),
+ * the next job starts immediately.
+ *
+ * @param[in,out]   edf     task descriptor of the calling thread
+ */
+void sched_edf_wait_period(sched_edf_t *edf);
+
+/**
+ * @brief   Leave the EDF class
+ *
+ * The calling thread gets back the priority it had before
+ * @ref sched_edf_join.
+ *
+ * @param[in,out]   edf     task descriptor of the calling thread
+ */
+void sched_edf_leave(sched_edf_t *edf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
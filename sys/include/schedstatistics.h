@@ -16,6 +16,15 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * With the `schedstatistics_latency` module, the wakeup-to-run latency of
+ * each thread is recorded in addition: the time from the thread being put on
+ * the run queue (e.g. when receiving a message or getting a mutex) to the
+ * scheduler actually switching to it. For each thread, the maximum and
+ * average latency, a log2 histogram of the latencies and the number of times
+ * the thread was preempted are kept. Latencies are measured with the cycle
+ * counter of the CPU if there is one (Cortex-M3 and above), and with
+ * `ZTIMER_USEC` otherwise; @ref schedstat_ticks_to_ns converts them.
  * @{
  *
  * @file
@@ -29,12 +38,26 @@
 #ifndef SCHEDSTATISTICS_H
 #define SCHEDSTATISTICS_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "kernel_defines.h"
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+/**
+ * @brief   Number of buckets of the wakeup latency histograms
+ *
+ * Bucket 0 counts latencies below 2 µs, bucket i counts latencies from 2^i µs
+ * to below 2^(i+1) µs. The last bucket also counts all longer latencies.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_HIST_BUCKETS
+#define CONFIG_SCHEDSTATISTICS_HIST_BUCKETS     16
+#endif
+
 /**
  *  Scheduler statistics
  */
@@ -43,6 +66,21 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY) || defined(DOXYGEN)
+    uint32_t wakeup;         /**< Time stamp in ticks of the last time this
+                                  thread was put on the run queue */
+    bool waking;             /**< Thread is on the run queue since @p wakeup */
+    uint32_t wakeups;        /**< Number of measured wakeup latencies */
+    uint32_t preemptions;    /**< How often the thread was switched out while
+                                  still runnable */
+    uint32_t latency_max;    /**< Maximum wakeup latency in ticks */
+    uint64_t latency_sum;    /**< Sum of all wakeup latencies in ticks */
+    /**
+     * @brief   log2 histogram of the wakeup latencies in µs, see
+     *          @ref CONFIG_SCHEDSTATISTICS_HIST_BUCKETS
+     */
+    uint16_t latency_hist[CONFIG_SCHEDSTATISTICS_HIST_BUCKETS];
+#endif
 } schedstat_t;
 
 /**
@@ -56,6 +94,53 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ * @brief   Scheduler callback updating the statistics
+ *
+ * Registered by @ref init_schedstatistics. Modules that register their own
+ * scheduler callback have to call this one from it.
+ *
+ * @param[in]   active_thread   pid of the thread leaving the CPU
+ * @param[in]   next_thread     pid of the thread getting the CPU
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY) || defined(DOXYGEN)
+/**
+ * @brief   Record that a thread was put on the run queue
+ *
+ * Called by the scheduler, interrupts are disabled.
+ *
+ * @param[in]   pid     thread that became runnable
+ */
+void sched_statistics_wakeup(kernel_pid_t pid);
+
+/**
+ * @brief   Get a consistent copy of the statistics of a thread
+ *
+ * @param[in]   pid     thread to get the statistics of, @ref KERNEL_PID_UNDEF
+ *                      for the idle time without `core_idle_thread`
+ * @param[out]  stat    statistics of @p pid
+ */
+void schedstat_get(kernel_pid_t pid, schedstat_t *stat);
+
+/**
+ * @brief   Clear the latency statistics and preemption count of a thread
+ *
+ * @param[in]   pid     thread to reset the statistics of
+ */
+void schedstat_reset_latency(kernel_pid_t pid);
+
+/**
+ * @brief   Convert a latency in ticks to nanoseconds
+ *
+ * @param[in]   ticks   latency as stored in @ref schedstat_t
+ *
+ * @return  @p ticks in nanoseconds
+ */
+uint64_t schedstat_ticks_to_ns(uint64_t ticks);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,14 @@ extern "C" {
 #define BENCH_PORT_DEFAULT      (12345)
 #endif
 
+/**
+ * @brief   Maximum number of datagrams passed to the stack in one call by
+ *          @ref benchmark_udp_flood and @ref benchmark_udp_sink
+ */
+#ifndef BENCH_BATCH_MAX
+#define BENCH_BATCH_MAX         (16)
+#endif
+
 /**
  * @brief   Flag indicating the benchmark packet is a configuration command.
  */
@@ -105,6 +113,37 @@ int benchmark_udp_start(const char *server, uint16_t port);
  */
 bool benchmark_udp_stop(void);
 
+/**
+ * @brief   Send datagrams to a server as fast as possible
+ *
+ * Uses @ref sock_udp_send_batch to hand @p batch datagrams to the stack per
+ * call and prints the achieved throughput.
+ *
+ * @param[in]   server  destination (address or hostname)
+ * @param[in]   port    destination port
+ * @param[in]   count   number of datagrams to send
+ * @param[in]   size    payload size of the datagrams
+ * @param[in]   batch   datagrams per call, at most @ref BENCH_BATCH_MAX
+ * @return      0 on success
+ *              error otherwise
+ */
+int benchmark_udp_flood(const char *server, uint16_t port, unsigned count,
+                        unsigned size, unsigned batch);
+
+/**
+ * @brief   Receive datagrams for a given time
+ *
+ * Uses @ref sock_udp_recv_batch to take up to @p batch datagrams from the
+ * stack per call and prints the achieved throughput.
+ *
+ * @param[in]   port    local port to receive on
+ * @param[in]   seconds time to receive for
+ * @param[in]   batch   datagrams per call, at most @ref BENCH_BATCH_MAX
+ * @return      0 on success
+ *              error otherwise
+ */
+int benchmark_udp_sink(uint16_t port, unsigned seconds, unsigned batch);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,14 +22,21 @@
  * At any point, `trace_dump()` can be used to print the trace buffer.
  *
  * The buffer has a default size of 512 entries, which can be overridden by
- * defining CONFIG_TRACE_BUFSIZE. It can be cleared using `trace_reset()`.
+ * defining CONFIG_TRACE_BUFSIZE (a power of two). It can be cleared using
+ * `trace_reset()`.
  * The trace buffer works like a ring-buffer. If it is full, it will start
  * overwriting from the beginning.
  *
- * Tracing is made thread safe by disabling interrupts for critical sections.
+ * Entries are stored as compact, typed binary records (@ref trace_event_t) in
+ * a lock-free ring: a writer only reserves its slot with a single atomic
+ * increment and publishes the record by storing its sequence number last, so
+ * neither @ref trace nor the kernel hooks keep interrupts disabled while
+ * filling in a record. (On platforms without atomic read-modify-write
+ * instructions, @ref atomic_fetch_add_u32 briefly disables interrupts for the
+ * increment.) Readers drop records that were overwritten while being copied.
  *
  * It does incur some overhead (at least a function call, getting the current
- * time, a pair of enable/disable interrupts and a couple of memory accesses).
+ * time and a couple of memory accesses).
  *
  * Example:
  *
@@ -41,6 +48,28 @@
  * trace_dump();
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Kernel and network stack events
+ * -------------------------------
+ *
+ * With the `trace_hooks` pseudo-module, the scheduler, `msg`, `mutex`,
+ * `ztimer` and `gnrc_netif` record events of their own. Hooks are disabled
+ * after boot and are enabled per type with @ref trace_hooks_enable, e.g.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * trace_hooks_enable(TRACE_EVENT_MASK(TRACE_EVENT_SCHED_SWITCH) |
+ *                    TRACE_EVENT_MASK(TRACE_EVENT_MSG_SEND));
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Binary export
+ * -------------
+ *
+ * @ref trace_export streams the buffer in a binary format to a user supplied
+ * sink, @ref trace_export_stdio and @ref trace_export_vfs are provided for
+ * convenience. The stream starts with a @ref trace_export_hdr_t followed by
+ * the valid records in chronological order. `dist/tools/trace/trace2json.py`
+ * converts such a stream into the Chrome trace event format, which can be
+ * viewed with `chrome://tracing` or https://ui.perfetto.dev.
+ *
  * @{
  *
  * @brief       Execution tracing module API
@@ -53,12 +82,114 @@
 #ifndef TRACE_H
 #define TRACE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "atomic_utils.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Trace buffer size in entries
+ *
+ * Needs to be a power of two.
+ */
+#ifndef CONFIG_TRACE_BUFSIZE
+#define CONFIG_TRACE_BUFSIZE        512
+#endif
+
+/**
+ * @brief   Trace event types
+ *
+ * The meaning of @ref trace_event_t::arg depends on the type.
+ */
+typedef enum {
+    TRACE_EVENT_USER = 0,       /**< @ref trace call, arg: user value */
+    TRACE_EVENT_SCHED_SWITCH,   /**< context switch to trace_event_t::pid,
+                                 *   arg: previous PID */
+    TRACE_EVENT_MSG_SEND,       /**< arg: target PID << 16 | message type */
+    TRACE_EVENT_MSG_RECV,       /**< arg: sender PID << 16 | message type */
+    TRACE_EVENT_MUTEX_LOCK,     /**< mutex acquired, arg: mutex address */
+    TRACE_EVENT_MUTEX_BLOCK,    /**< waiting for mutex, arg: mutex address */
+    TRACE_EVENT_MUTEX_UNLOCK,   /**< mutex released, arg: mutex address */
+    TRACE_EVENT_ZTIMER_FIRE,    /**< timer expired, arg: callback address */
+    TRACE_EVENT_NETIF_RX,       /**< packet received, arg: length of the
+                                 *   packet snips including the netif header */
+    TRACE_EVENT_NETIF_TX,       /**< packet handed to the device, arg: length
+                                 *   as for TRACE_EVENT_NETIF_RX */
+    TRACE_EVENT_NUMOF,          /**< number of event types */
+} trace_event_type_t;
+
+/**
+ * @brief   Bit of @p type in the mask given to @ref trace_hooks_enable
+ */
+#define TRACE_EVENT_MASK(type)      (1UL << (type))
+
+/**
+ * @brief   Event was recorded in interrupt context
+ */
+#define TRACE_EVENT_FLAG_ISR        (0x01)
+
+/**
+ * @brief   Trace record
+ *
+ * This is also the record format of the binary export.
+ */
+typedef struct {
+    /**
+     * @brief   Sequence number of the event plus one, 0 while being written
+     */
+    uint32_t seq;
+    uint32_t time;              /**< time stamp in microseconds */
+    uint32_t arg;               /**< type specific argument */
+    uint8_t type;               /**< @ref trace_event_type_t */
+    uint8_t flags;              /**< TRACE_EVENT_FLAG_* */
+    int16_t pid;                /**< PID of the thread recording the event */
+} trace_event_t;
+
+/**
+ * @brief   Magic number at the start of a binary export
+ */
+#define TRACE_EXPORT_MAGIC          "RTRC"
+
+/**
+ * @brief   Version of the binary export format
+ */
+#define TRACE_EXPORT_VERSION        (1U)
+
+/**
+ * @brief   Records of the binary export are in big endian byte order
+ */
+#define TRACE_EXPORT_FLAG_BIG_ENDIAN    (0x0001)
+
+/**
+ * @brief   Header of the binary export
+ *
+ * Multi-byte fields are in the byte order of the exporting node, see
+ * @ref TRACE_EXPORT_FLAG_BIG_ENDIAN.
+ */
+typedef struct {
+    char magic[4];              /**< @ref TRACE_EXPORT_MAGIC */
+    uint8_t version;            /**< @ref TRACE_EXPORT_VERSION */
+    uint8_t record_size;        /**< sizeof(trace_event_t) */
+    uint16_t flags;             /**< TRACE_EXPORT_FLAG_* */
+    uint32_t numof;             /**< number of records following */
+} trace_export_hdr_t;
+
+/**
+ * @brief   Sink for @ref trace_export
+ *
+ * @param[in]   arg     user argument given to @ref trace_export
+ * @param[in]   data    chunk of the export
+ * @param[in]   len     length of @p data
+ *
+ * @return  0 on success
+ * @return  negative errno on error, this aborts the export
+ */
+typedef int (*trace_export_cb_t)(void *arg, const void *data, size_t len);
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -73,6 +204,16 @@ extern "C" {
  */
 void trace(uint32_t val);
 
+/**
+ * @brief   Add a typed entry to the trace buffer
+ *
+ * Safe to call from anywhere, including interrupt context.
+ *
+ * @param[in]   type    event type
+ * @param[in]   arg     type specific argument
+ */
+void trace_event(trace_event_type_t type, uint32_t arg);
+
 /**
  * @brief   Print the current trace buffer
  *
@@ -92,6 +233,75 @@ void trace_dump(void);
  */
 void trace_reset(void);
 
+/**
+ * @brief   Stream the trace buffer in binary form
+ *
+ * Writes a @ref trace_export_hdr_t followed by the records in chronological
+ * order to @p cb. Tracing can continue while exporting, records overwritten
+ * in the meantime are exported with trace_event_t::seq set to 0 and are to
+ * be skipped by the reader.
+ *
+ * @param[in]   cb      sink to write to
+ * @param[in]   arg     argument passed to @p cb
+ *
+ * @return  number of valid exported records
+ * @return  negative errno returned by @p cb
+ */
+int trace_export(trace_export_cb_t cb, void *arg);
+
+/**
+ * @brief   Stream the trace buffer in binary form to stdio
+ *
+ * @return  number of valid exported records
+ * @return  negative errno on error
+ */
+int trace_export_stdio(void);
+
+/**
+ * @brief   Stream the trace buffer in binary form into a file
+ *
+ * @note    Only available with the `vfs` module.
+ *
+ * @param[in]   path    file to create or truncate
+ *
+ * @return  number of valid exported records
+ * @return  negative errno on error
+ */
+int trace_export_vfs(const char *path);
+
+#if defined(MODULE_TRACE_HOOKS) || defined(DOXYGEN)
+/**
+ * @brief   Event types recorded by the kernel and network stack hooks
+ *
+ * @warning Do not access directly, use @ref trace_hooks_enable.
+ */
+extern uint32_t trace_hooks_mask;
+
+/**
+ * @brief   Select the event types recorded by the hooks
+ *
+ * @param[in]   mask    bitwise or of @ref TRACE_EVENT_MASK of the event types
+ *                      to record, 0 to disable all hooks
+ */
+static inline void trace_hooks_enable(uint32_t mask)
+{
+    atomic_store_u32(&trace_hooks_mask, mask);
+}
+
+/**
+ * @brief   Record a hook event if its type is enabled
+ *
+ * @param[in]   type    event type
+ * @param[in]   arg     type specific argument
+ */
+static inline void trace_hook(trace_event_type_t type, uint32_t arg)
+{
+    if (atomic_load_u32(&trace_hooks_mask) & TRACE_EVENT_MASK(type)) {
+        trace_event(type, arg);
+    }
+}
+#endif /* MODULE_TRACE_HOOKS || DOXYGEN */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_wheel ztimer hierarchical timing wheel
+ * @ingroup     sys_ztimer
+ * @brief       Optional timing-wheel timer storage for ztimer clocks
+ *
+ * By default, a ztimer clock keeps its timers in a delta-sorted singly linked
+ * list. Setting a timer thus has to walk the list with interrupts disabled,
+ * which gets expensive with hundreds of concurrently armed timers.
+ *
+ * With the module `ztimer_wheel`, a clock can instead be backed by a
+ * hierarchical timing wheel (Varghese & Lauck) using
+ * @ref ztimer_wheel_attach(). The wheel consists of
+ * @ref ZTIMER_WHEEL_LEVELS levels of @ref ZTIMER_WHEEL_SLOTS slots each. Level
+ * `n` has a resolution of `ZTIMER_WHEEL_SLOTS ^ n` ticks. A timer is put into
+ * the lowest level whose slot range contains its target and cascades into a
+ * lower level once the clock reaches that slot, so every timer is moved at
+ * most @ref ZTIMER_WHEEL_LEVELS - 1 times. Timers still fire at their exact
+ * target tick.
+ *
+ * This makes @ref ztimer_set() and @ref ztimer_remove() O(1) (amortized),
+ * independent of the number of armed timers, at the cost of one additional
+ * pointer per @ref ztimer_t and the memory of the wheel itself
+ * (`ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_SLOTS` pointers).
+ *
+ * Example:
+ *
+ * ```
+ * #include "ztimer/wheel.h"
+ *
+ * static ztimer_wheel_t _msec_wheel;
+ *
+ * int main(void)
+ * {
+ *     ztimer_wheel_attach(ZTIMER_MSEC, &_msec_wheel);
+ *     ...
+ * }
+ * ```
+ *
+ * @note    Timers set to the very same target tick are not guaranteed to fire
+ *          in the order they have been set.
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer timing wheel API
+ */
+
+#ifndef ZTIMER_WHEEL_H
+#define ZTIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_ztimer_wheel_config ztimer timing wheel compile time configuration
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of bits of a timer target resolved per wheel level
+ *
+ * Each level has `2 ^ CONFIG_ZTIMER_WHEEL_BITS` slots. Must be between 1 and 4,
+ * so that a level's occupancy bitmap fits into an `unsigned` on all platforms.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_BITS
+#define CONFIG_ZTIMER_WHEEL_BITS    4
+#endif
+/** @} */
+
+/**
+ * @brief   Number of slots per wheel level
+ */
+#define ZTIMER_WHEEL_SLOTS      (1U << CONFIG_ZTIMER_WHEEL_BITS)
+
+/**
+ * @brief   Number of wheel levels needed to cover 32 bit targets
+ */
+#define ZTIMER_WHEEL_LEVELS     ((32 + CONFIG_ZTIMER_WHEEL_BITS - 1) / \
+                                 CONFIG_ZTIMER_WHEEL_BITS)
+
+/**
+ * @brief   ztimer timing wheel storage
+ *
+ * All members are private.
+ */
+struct ztimer_wheel {
+    /**
+     * @brief   Timer buckets, one singly linked list per slot
+     */
+    ztimer_base_t *slots[ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+    unsigned occupied[ZTIMER_WHEEL_LEVELS]; /**< non-empty slots per level */
+    ztimer_base_t *due;                     /**< expired timers (FIFO)     */
+    ztimer_base_t **due_tail;               /**< end of the expired list   */
+};
+
+/**
+ * @brief   Make a clock use a timing wheel for its timers
+ *
+ * @pre     No timer is set on @p clock
+ *
+ * @param[in]   clock       clock to operate on
+ * @param[out]  wheel       wheel storage to use, must stay valid as long as
+ *                          @p clock is used
+ */
+void ztimer_wheel_attach(ztimer_clock_t *clock, ztimer_wheel_t *wheel);
+
+/**
+ * @brief   Check if a wheel holds no timers at all
+ *
+ * @internal
+ *
+ * @param[in]   wheel       wheel to check
+ *
+ * @return  true if @p wheel is empty
+ */
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel);
+
+/**
+ * @brief   Add a timer to a wheel
+ *
+ * @internal
+ *
+ * @param[in]   wheel       wheel to operate on
+ * @param[in]   now         current position of the wheel (clock base)
+ * @param[in]   entry       timer to add, `entry->offset` is relative to @p now
+ *
+ * @return  true if the next event of the wheel moved closer, i.e. the clock
+ *          has to be re-armed
+ */
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, uint32_t now,
+                      ztimer_base_t *entry);
+
+/**
+ * @brief   Remove a timer from a wheel
+ *
+ * @internal
+ *
+ * @param[in]   wheel       wheel to operate on
+ * @param[in]   entry       timer to remove
+ */
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry);
+
+/**
+ * @brief   Get the time until the next event of a wheel
+ *
+ * The next event is either the expiry of a timer or the point in time at which
+ * timers have to be cascaded into a lower level.
+ *
+ * @internal
+ *
+ * @param[in]   wheel       wheel to operate on
+ * @param[in]   now         current position of the wheel (clock base)
+ * @param[out]  offset      ticks from @p now until the next event
+ *
+ * @return  false if there are no timers in @p wheel
+ */
+bool ztimer_wheel_next(const ztimer_wheel_t *wheel, uint32_t now,
+                       uint32_t *offset);
+
+/**
+ * @brief   Move a wheel from @p from to @p to
+ *
+ * All timers with targets up to @p to are moved to the wheel's list of
+ * expired timers.
+ *
+ * @internal
+ *
+ * @param[in]   wheel       wheel to operate on
+ * @param[in]   from        current position of the wheel (old clock base)
+ * @param[in]   to          new position of the wheel
+ */
+void ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t from, uint32_t to);
+
+/**
+ * @brief   Pop the first expired timer of a wheel
+ *
+ * @internal
+ *
+ * @param[in]   wheel       wheel to operate on
+ *
+ * @return  the expired timer, or NULL if none expired
+ */
+ztimer_base_t *ztimer_wheel_pop_due(ztimer_wheel_t *wheel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_WHEEL_H */
+/** @} */
@@ -25,6 +25,14 @@
 #include "irq.h"
 #include "kernel_defines.h"
 #include "mutex.h"
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE)
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "malloc_thread_cache.h"
+#include "thread.h"
+#endif
 
 extern void *__real_malloc(size_t size);
 extern void __real_free(void *ptr);
@@ -32,6 +40,314 @@ extern void *__real_realloc(void *ptr, size_t size);
 
 static mutex_t _lock;
 
+static void *_backend_malloc(size_t size)
+{
+    mutex_lock(&_lock);
+    void *ptr = __real_malloc(size);
+    mutex_unlock(&_lock);
+    return ptr;
+}
+
+static void _backend_free(void *ptr)
+{
+    mutex_lock(&_lock);
+    __real_free(ptr);
+    mutex_unlock(&_lock);
+}
+
+static void *_backend_realloc(void *ptr, size_t size)
+{
+    mutex_lock(&_lock);
+    void *new = __real_realloc(ptr, size);
+    mutex_unlock(&_lock);
+    return new;
+}
+
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE)
+#define CLASSES         CONFIG_MALLOC_THREAD_CACHE_CLASSES
+#define CLASS_NONE      UINT8_MAX
+
+static_assert(CONFIG_MALLOC_THREAD_CACHE_BATCH <= CONFIG_MALLOC_THREAD_CACHE_DEPTH,
+              "CONFIG_MALLOC_THREAD_CACHE_BATCH exceeds the cache depth");
+static_assert(CONFIG_MALLOC_THREAD_CACHE_DEPTH <= UINT8_MAX,
+              "CONFIG_MALLOC_THREAD_CACHE_DEPTH too large");
+static_assert(CONFIG_MALLOC_THREAD_CACHE_MIN_SIZE >= sizeof(void *),
+              "CONFIG_MALLOC_THREAD_CACHE_MIN_SIZE too small to hold a pointer");
+
+/* The tag in the last word of the header marks blocks allocated through
+ * the wrappers. The C library may allocate internally without them (e.g.
+ * strdup() or stdio buffers), but those blocks are still freed through the
+ * wrappers. Their word in front of the user data is the allocator's chunk
+ * size or padding, which never matches TAG_MAGIC. */
+#define TAG_MAGIC       (0xa110c000UL)
+#define TAG_MAGIC_MASK  (0xffffff00UL)
+
+/* precedes every allocation, keeping the user data aligned */
+typedef union {
+    max_align_t align;
+} _hdr_t;
+
+static_assert(sizeof(_hdr_t) >= sizeof(uint32_t), "header too small for tag");
+
+typedef struct {
+    /* free lists, linked through the first word of the user data */
+    _hdr_t *free[CLASSES];
+    uint8_t numof[CLASSES];
+    uint32_t hits;
+    uint32_t refills;
+    uint32_t drains;
+} _cache_t;
+
+static _cache_t _caches[MAXTHREADS];
+
+static inline void *_data(_hdr_t *hdr)
+{
+    return hdr + 1;
+}
+
+static inline _hdr_t *_hdr(void *ptr)
+{
+    return (_hdr_t *)ptr - 1;
+}
+
+static inline _hdr_t **_next(_hdr_t *hdr)
+{
+    return _data(hdr);
+}
+
+static inline uint32_t *_tag(_hdr_t *hdr)
+{
+    return (uint32_t *)_data(hdr) - 1;
+}
+
+static inline void _set_class(_hdr_t *hdr, unsigned cls)
+{
+    *_tag(hdr) = TAG_MAGIC | cls;
+}
+
+/* returns false for blocks not allocated through the wrappers */
+static inline bool _get_class(_hdr_t *hdr, unsigned *cls)
+{
+    uint32_t tag = *_tag(hdr);
+
+    if ((tag & TAG_MAGIC_MASK) != TAG_MAGIC) {
+        return false;
+    }
+    *cls = tag & ~TAG_MAGIC_MASK;
+    return true;
+}
+
+static inline size_t _class_size(unsigned cls)
+{
+    return (size_t)CONFIG_MALLOC_THREAD_CACHE_MIN_SIZE << cls;
+}
+
+/* returns CLASSES for allocations too large to be cached */
+static unsigned _class(size_t size)
+{
+    unsigned cls = 0;
+
+    while ((cls < CLASSES) && (size > _class_size(cls))) {
+        cls++;
+    }
+    return cls;
+}
+
+static _cache_t *_cache(void)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    /* there is no thread yet during early boot */
+    return pid_is_valid(pid) ? &_caches[pid - KERNEL_PID_FIRST] : NULL;
+}
+
+static void _push(_cache_t *c, unsigned cls, _hdr_t *hdr)
+{
+    *_next(hdr) = c->free[cls];
+    c->free[cls] = hdr;
+    c->numof[cls]++;
+}
+
+static _hdr_t *_pop(_cache_t *c, unsigned cls)
+{
+    _hdr_t *hdr = c->free[cls];
+
+    c->free[cls] = *_next(hdr);
+    c->numof[cls]--;
+    return hdr;
+}
+
+static void _refill(_cache_t *c, unsigned cls)
+{
+    unsigned numof = 0;
+
+    mutex_lock(&_lock);
+    while (numof < CONFIG_MALLOC_THREAD_CACHE_BATCH) {
+        _hdr_t *hdr = __real_malloc(sizeof(_hdr_t) + _class_size(cls));
+
+        if (hdr == NULL) {
+            break;
+        }
+        _set_class(hdr, cls);
+        _push(c, cls, hdr);
+        numof++;
+    }
+    mutex_unlock(&_lock);
+    if (numof) {
+        c->refills++;
+    }
+}
+
+static void _drain(_cache_t *c, unsigned cls, unsigned numof)
+{
+    mutex_lock(&_lock);
+    while (numof--) {
+        __real_free(_pop(c, cls));
+    }
+    mutex_unlock(&_lock);
+    c->drains++;
+}
+
+static void *_malloc(size_t size)
+{
+    unsigned cls = _class(size);
+    _hdr_t *hdr;
+
+    if (cls < CLASSES) {
+        _cache_t *c = _cache();
+
+        if (c) {
+            if (c->numof[cls]) {
+                c->hits++;
+            }
+            else {
+                _refill(c, cls);
+            }
+            if (c->numof[cls]) {
+                return _data(_pop(c, cls));
+            }
+        }
+        /* allocate the full class size, so that the block can be cached when
+         * it is freed */
+        size = _class_size(cls);
+    }
+    else if (size > SIZE_MAX - sizeof(_hdr_t)) {
+        return NULL;
+    }
+
+    hdr = _backend_malloc(sizeof(_hdr_t) + size);
+    if (hdr == NULL) {
+        return NULL;
+    }
+    _set_class(hdr, (cls < CLASSES) ? cls : CLASS_NONE);
+    return _data(hdr);
+}
+
+static void _free(void *ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+
+    _hdr_t *hdr = _hdr(ptr);
+    _cache_t *c = _cache();
+    unsigned cls;
+
+    if (!_get_class(hdr, &cls)) {
+        _backend_free(ptr);
+        return;
+    }
+    if ((cls == CLASS_NONE) || (c == NULL)) {
+        _backend_free(hdr);
+        return;
+    }
+    if (c->numof[cls] >= CONFIG_MALLOC_THREAD_CACHE_DEPTH) {
+        _drain(c, cls, CONFIG_MALLOC_THREAD_CACHE_BATCH);
+    }
+    _push(c, cls, hdr);
+}
+
+static void *_realloc(void *ptr, size_t size)
+{
+    if (ptr == NULL) {
+        return _malloc(size);
+    }
+
+    _hdr_t *hdr = _hdr(ptr);
+    unsigned cls;
+
+    if (!_get_class(hdr, &cls)) {
+        return _backend_realloc(ptr, size);
+    }
+    if (cls == CLASS_NONE) {
+        if (size > SIZE_MAX - sizeof(_hdr_t)) {
+            return NULL;
+        }
+        hdr = _backend_realloc(hdr, sizeof(_hdr_t) + size);
+        return (hdr) ? _data(hdr) : NULL;
+    }
+    if (size <= _class_size(cls)) {
+        return ptr;
+    }
+
+    void *new = _malloc(size);
+
+    if (new) {
+        memcpy(new, ptr, _class_size(cls));
+        _free(ptr);
+    }
+    return new;
+}
+
+void malloc_thread_cache_flush(void)
+{
+    _cache_t *c = _cache();
+
+    assert(!irq_is_in());
+    if (c == NULL) {
+        return;
+    }
+    for (unsigned cls = 0; cls < CLASSES; cls++) {
+        if (c->numof[cls]) {
+            _drain(c, cls, c->numof[cls]);
+        }
+    }
+}
+
+void malloc_thread_cache_stats(kernel_pid_t pid,
+                               malloc_thread_cache_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+    if (!pid_is_valid(pid)) {
+        return;
+    }
+
+    const _cache_t *c = &_caches[pid - KERNEL_PID_FIRST];
+
+    stats->hits = c->hits;
+    stats->refills = c->refills;
+    stats->drains = c->drains;
+    for (unsigned cls = 0; cls < CLASSES; cls++) {
+        stats->cached += c->numof[cls];
+    }
+}
+#else /* MODULE_MALLOC_THREAD_CACHE */
+static inline void *_malloc(size_t size)
+{
+    return _backend_malloc(size);
+}
+
+static inline void _free(void *ptr)
+{
+    _backend_free(ptr);
+}
+
+static inline void *_realloc(void *ptr, size_t size)
+{
+    return _backend_realloc(ptr, size);
+}
+#endif /* MODULE_MALLOC_THREAD_CACHE */
+
 void __attribute__((used)) *__wrap_malloc(size_t size)
 {
     uinttxtptr_t pc;
@@ -39,9 +355,7 @@ void __attribute__((used)) *__wrap_malloc(size_t size)
         pc = cpu_get_caller_pc();
     }
     assert(!irq_is_in());
-    mutex_lock(&_lock);
-    void *ptr = __real_malloc(size);
-    mutex_unlock(&_lock);
+    void *ptr = _malloc(size);
     if (IS_USED(MODULE_MALLOC_TRACING)) {
         printf("malloc(%u) @ 0x%" PRIxTXTPTR " returned %p\n",
                (unsigned)size, pc, ptr);
@@ -56,9 +370,7 @@ void __attribute__((used)) __wrap_free(void *ptr)
         printf("free(%p) @0x%" PRIxTXTPTR ")\n", ptr, pc);
     }
     assert(!irq_is_in());
-    mutex_lock(&_lock);
-    __real_free(ptr);
-    mutex_unlock(&_lock);
+    _free(ptr);
 }
 
 void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
@@ -79,9 +391,7 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
         return NULL;
     }
 
-    mutex_lock(&_lock);
-    void *res = __real_malloc(total_size);
-    mutex_unlock(&_lock);
+    void *res = _malloc(total_size);
     if (res) {
         memset(res, 0, total_size);
     }
@@ -102,9 +412,7 @@ void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
     }
 
     assert(!irq_is_in());
-    mutex_lock(&_lock);
-    void *new = __real_realloc(ptr, size);
-    mutex_unlock(&_lock);
+    void *new = _realloc(ptr, size);
 
     if (IS_USED(MODULE_MALLOC_TRACING)) {
         printf("realloc(%p, %u) @0x%" PRIxTXTPTR " returned %p\n",
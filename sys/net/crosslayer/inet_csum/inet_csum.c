@@ -14,7 +14,13 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
@@ -22,6 +28,109 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if UINTPTR_MAX > UINT16_MAX
+/* sum up 32-bit words, the accumulator can't overflow for 64 KiB of data */
+typedef uint32_t _word_t;
+typedef uint64_t _acc_t;
+#else
+/* 8 and 16 bit platforms: stick to words the CPU can add natively */
+typedef uint16_t _word_t;
+typedef uint32_t _acc_t;
+#endif
+
+/* memory is read in words after aligning the buffer, so it may alias */
+typedef _word_t __attribute__((may_alias)) _alias_word_t;
+typedef uint16_t __attribute__((may_alias)) _alias_u16_t;
+
+static uint16_t _fold(_acc_t acc)
+{
+    while (acc >> 16) {
+        acc = (acc & 0xffff) + (acc >> 16);
+    }
+    return acc;
+}
+
+static uint16_t _u16(uint8_t first, uint8_t second)
+{
+    uint8_t bytes[2] = { first, second };
+    uint16_t res;
+
+    memcpy(&res, bytes, sizeof(res));
+    return res;
+}
+
+#ifdef __SSE2__
+static _acc_t _sum_sse2(const uint8_t **buf, size_t *len)
+{
+    const __m128i mask = _mm_set1_epi32(0xffff);
+    __m128i acc = _mm_setzero_si128();
+    uint32_t lanes[4];
+
+    /* add the 16-bit halves of the 32-bit lanes separately, 64 KiB of data
+     * can't overflow a lane */
+    for (; *len >= 32; *buf += 32, *len -= 32) {
+        __m128i a = _mm_loadu_si128((const void *)*buf);
+        __m128i b = _mm_loadu_si128((const void *)(*buf + 16));
+
+        acc = _mm_add_epi32(acc, _mm_and_si128(a, mask));
+        acc = _mm_add_epi32(acc, _mm_srli_epi32(a, 16));
+        acc = _mm_add_epi32(acc, _mm_and_si128(b, mask));
+        acc = _mm_add_epi32(acc, _mm_srli_epi32(b, 16));
+    }
+    _mm_storeu_si128((void *)lanes, acc);
+    return (_acc_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+#endif
+
+/**
+ * @brief   Sums up @p buf in 16-bit words of host byte order.
+ *
+ * One's complement addition is commutative and the byte order of the words
+ * just swaps the bytes of the sum (RFC 1071, section 2), so the buffer is
+ * summed up in the widest words the platform adds efficiently.
+ *
+ * @return  The folded sum, with swapped bytes if @p buf is at an odd address.
+ */
+static uint16_t _sum(const uint8_t *buf, size_t len)
+{
+    _acc_t acc = 0;
+
+    if (((uintptr_t)buf & 1) && (len > 0)) {
+        /* shift all bytes into the other half of the words */
+        acc = _u16(0, *buf);
+        buf++;
+        len--;
+    }
+    while (((uintptr_t)buf & (sizeof(_word_t) - 1)) && (len >= 2)) {
+        acc += *(const _alias_u16_t *)(const void *)buf;
+        buf += 2;
+        len -= 2;
+    }
+#ifdef __SSE2__
+    acc += _sum_sse2(&buf, &len);
+#endif
+    const _alias_word_t *words = (const _alias_word_t *)(const void *)buf;
+    for (; len >= 4 * sizeof(_word_t); len -= 4 * sizeof(_word_t), words += 4) {
+        acc += words[0];
+        acc += words[1];
+        acc += words[2];
+        acc += words[3];
+    }
+    for (; len >= sizeof(_word_t); len -= sizeof(_word_t), words++) {
+        acc += *words;
+    }
+    buf = (const uint8_t *)words;
+    if (len >= 2) {
+        acc += *(const _alias_u16_t *)(const void *)buf;
+        buf += 2;
+        len -= 2;
+    }
+    if (len > 0) {
+        acc += _u16(*buf, 0);
+    }
+    return _fold(acc);
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -40,29 +149,31 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
     if (len == 0)
         return csum;
 
-    if (accum_len & 1) {      /* if accumulated length is odd */
-        csum += *buf;         /* add first byte as bottom half of 16-byte word */
-        buf++;
-        len--;
-        accum_len++;
-    }
-
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    uint16_t part = ntohs(_sum(buf, len));
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
+    /* if accumulated length or address is odd, the first byte is the bottom
+     * half of a 16-bit word: swap the bytes of the sum (once for each) */
+    if ((accum_len ^ (uintptr_t)buf) & 1) {
+        part = byteorder_swaps(part);
     }
+    csum += part;
+    csum = (csum & 0xffff) + (csum >> 16);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
     return csum;
 }
 
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old_buf, const uint8_t *new_buf,
+                          uint16_t len, size_t accum_len)
+{
+    /* RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m'), with the sum of ~m being
+     * the one's complement of the sum of m */
+    uint32_t sum = (uint16_t)~csum;
+
+    sum += (uint16_t)~inet_csum_slice(0, old_buf, len, accum_len);
+    sum += inet_csum_slice(0, new_buf, len, accum_len);
+    return ~_fold(sum);
+}
+
 /** @} */
@@ -82,6 +82,51 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+static void _dispatch_single(const gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                             gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
+    uint32_t status = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        case GNRC_NETREG_TYPE_BATCH:
+#endif
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            status = ECANCELED;
+            break;
+    }
+    if (status != 0) {
+        gnrc_pktbuf_release_error(pkt, status);
+    }
+#else
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release_error(pkt, EIO);
+    }
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -95,48 +140,175 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            uint32_t status = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
-#endif
-                default:
-                    /* unknown dispatch type */
-                    status = ECANCELED;
-                    break;
+            _dispatch_single(sendto, cmd, pkt);
+            sendto = gnrc_netreg_getnext(sendto);
+        }
+    }
+
+    gnrc_netreg_release_shared();
+
+    return numof;
+}
+
+#ifdef MODULE_GNRC_NETAPI_BATCH
+static inline uint16_t _batch_cmd(uint16_t cmd)
+{
+    return (cmd == GNRC_NETAPI_MSG_TYPE_SND) ? GNRC_NETAPI_MSG_TYPE_SND_BATCH
+                                             : GNRC_NETAPI_MSG_TYPE_RCV_BATCH;
+}
+
+static inline gnrc_pktsnip_t *_batch_carrier(gnrc_pktsnip_t *const *pkts,
+                                             unsigned numof)
+{
+    /* the carrier only references the packets, releasing it does not release
+     * them */
+    return gnrc_pktbuf_add(NULL, pkts, numof * sizeof(gnrc_pktsnip_t *),
+                           GNRC_NETTYPE_UNDEF);
+}
+
+static void _release_all(gnrc_pktsnip_t *const *pkts, unsigned numof,
+                         uint32_t err)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktbuf_release_error(pkts[i], err);
+    }
+}
+
+int gnrc_netapi_dispatch_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t *const *pkts,
+                               unsigned numof)
+{
+    assert(numof <= CONFIG_GNRC_NETAPI_BATCH_SIZE);
+    gnrc_netreg_acquire_shared();
+
+    int numof_subs = gnrc_netreg_num(type, demux_ctx);
+
+    if (numof_subs != 0) {
+        gnrc_netreg_entry_t *sendto;
+        gnrc_pktsnip_t *carrier = NULL;
+        unsigned batch_subs = 0;
+
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_hold(pkts[i], numof_subs - 1);
+        }
+        if (numof > 1) {
+            for (sendto = gnrc_netreg_lookup(type, demux_ctx); sendto;
+                 sendto = gnrc_netreg_getnext(sendto)) {
+                if (sendto->type == GNRC_NETREG_TYPE_BATCH) {
+                    batch_subs++;
+                }
             }
-            if (status != 0) {
-                gnrc_pktbuf_release_error(pkt, status);
+        }
+        /* all batch subscribers share the same carrier. If there is no space
+         * left for it, they get the packets one by one */
+        if ((batch_subs > 0) &&
+            ((carrier = _batch_carrier(pkts, numof)) != NULL)) {
+            gnrc_pktbuf_hold(carrier, batch_subs - 1);
+        }
+        for (sendto = gnrc_netreg_lookup(type, demux_ctx); sendto;
+             sendto = gnrc_netreg_getnext(sendto)) {
+            if ((carrier != NULL) && (sendto->type == GNRC_NETREG_TYPE_BATCH)) {
+                if (_gnrc_netapi_send_recv(sendto->target.pid, carrier,
+                                           _batch_cmd(cmd)) < 1) {
+                    /* unable to dispatch batch */
+                    gnrc_pktbuf_release(carrier);
+                    _release_all(pkts, numof, EIO);
+                }
+                continue;
             }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release_error(pkt, EIO);
+            for (unsigned i = 0; i < numof; i++) {
+                _dispatch_single(sendto, cmd, pkts[i]);
             }
-#endif
-            sendto = gnrc_netreg_getnext(sendto);
         }
     }
 
     gnrc_netreg_release_shared();
 
+    return numof_subs;
+}
+
+int gnrc_netapi_send_batch(kernel_pid_t pid, uint16_t cmd,
+                           gnrc_pktsnip_t *const *pkts, unsigned numof)
+{
+    gnrc_pktsnip_t *carrier;
+    int res;
+
+    assert((numof > 0) && (numof <= CONFIG_GNRC_NETAPI_BATCH_SIZE));
+    if (numof == 1) {
+        return _gnrc_netapi_send_recv(pid, pkts[0], cmd);
+    }
+    if ((carrier = _batch_carrier(pkts, numof)) == NULL) {
+        DEBUG("gnrc_netapi: no space left for batch to %" PRIkernel_pid "\n",
+              pid);
+        return -1;
+    }
+    res = _gnrc_netapi_send_recv(pid, carrier, _batch_cmd(cmd));
+    if (res < 1) {
+        gnrc_pktbuf_release(carrier);
+    }
+    return res;
+}
+
+static void _batch_add(gnrc_netapi_batch_t *batch, gnrc_nettype_t type,
+                       uint32_t demux_ctx, kernel_pid_t pid, uint16_t cmd,
+                       gnrc_pktsnip_t *pkt)
+{
+    if ((batch->numof > 0) &&
+        ((batch->type != type) || (batch->demux_ctx != demux_ctx) ||
+         (batch->pid != pid) || (batch->cmd != cmd))) {
+        /* keep order of packets over target changes */
+        gnrc_netapi_batch_flush(batch);
+    }
+    if (batch->numof == 0) {
+        batch->type = type;
+        batch->demux_ctx = demux_ctx;
+        batch->pid = pid;
+        batch->cmd = cmd;
+    }
+    batch->pkts[batch->numof++] = pkt;
+    if (batch->numof == CONFIG_GNRC_NETAPI_BATCH_SIZE) {
+        gnrc_netapi_batch_flush(batch);
+    }
+}
+
+int gnrc_netapi_batch_dispatch(gnrc_netapi_batch_t *batch,
+                               gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netreg_acquire_shared();
+    int numof = gnrc_netreg_num(type, demux_ctx);
+    gnrc_netreg_release_shared();
+
+    if (numof != 0) {
+        _batch_add(batch, type, demux_ctx, KERNEL_PID_UNDEF, cmd, pkt);
+    }
     return numof;
 }
+
+void gnrc_netapi_batch_send(gnrc_netapi_batch_t *batch, kernel_pid_t pid,
+                            gnrc_pktsnip_t *pkt)
+{
+    _batch_add(batch, GNRC_NETTYPE_UNDEF, 0, pid, GNRC_NETAPI_MSG_TYPE_SND,
+               pkt);
+}
+
+void gnrc_netapi_batch_flush(gnrc_netapi_batch_t *batch)
+{
+    if (batch->numof == 0) {
+        return;
+    }
+    if (batch->pid == KERNEL_PID_UNDEF) {
+        if (gnrc_netapi_dispatch_batch(batch->type, batch->demux_ctx,
+                                       batch->cmd, batch->pkts,
+                                       batch->numof) == 0) {
+            /* subscribers left since the packets were collected */
+            _release_all(batch->pkts, batch->numof, GNRC_NETERR_SUCCESS);
+        }
+    }
+    else if (gnrc_netapi_send_batch(batch->pid, batch->cmd, batch->pkts,
+                                    batch->numof) < 1) {
+        _release_all(batch->pkts, batch->numof, EIO);
+    }
+    batch->numof = 0;
+}
+#endif /* MODULE_GNRC_NETAPI_BATCH */
@@ -178,9 +178,10 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
 
     if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
+        /* place the frame so that the Ethernet header and the headers behind
+         * it can be marked without copying */
+        pkt = gnrc_pktbuf_add_rx(bytes_expected, sizeof(ethernet_hdr_t),
+                                 GNRC_NETTYPE_UNDEF);
 
         if (!pkt) {
             DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
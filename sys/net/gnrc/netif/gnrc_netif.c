@@ -42,6 +42,9 @@
 #if IS_USED(MODULE_ZTIMER)
 #include "ztimer.h"
 #endif
+#if IS_USED(MODULE_TRACE_HOOKS)
+#include "trace.h"
+#endif
 
 #include "net/gnrc/netif.h"
 #include "net/gnrc/netif/internal.h"
@@ -1644,11 +1647,21 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
 /**
  * @brief   Call the ISR handler from an event
  *
+ * The driver's ISR handler services all pending interrupts of the device, so
+ * it is called once for all interrupts that occurred since the last call.
+ *
  * @param[in]   evp     pointer to the event
  */
 static void _event_handler_isr(event_t *evp)
 {
-    gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
+    gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr.super);
+    unsigned irqs = event_coalesce_take(&netif->event_isr);
+
+    if (irqs == 0) {
+        /* already serviced by the previous call */
+        return;
+    }
+    DEBUG("gnrc_netif: servicing %u interrupt(s)\n", irqs);
     netif->dev->driver->isr(netif->dev);
 }
 
@@ -1713,6 +1726,10 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
                 evp->handler(evp);
             }
         }
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+        /* pass on the packets received while handling the events */
+        gnrc_netapi_batch_flush(&netif->rx_batch);
+#endif
         /* non-blocking msg check */
         int msg_waiting = msg_try_receive(msg);
         if (msg_waiting > 0) {
@@ -1883,6 +1900,9 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     /* Split off the TX sync snip */
     gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
                             ? gnrc_tx_sync_split(pkt) : NULL;
+#if IS_USED(MODULE_TRACE_HOOKS)
+    trace_hook(TRACE_EVENT_NETIF_TX, gnrc_pkt_len(pkt));
+#endif
     int res = netif->ops->send(netif, pkt);
 
     /* For legacy netdevs (no confirm_send) TX is blocking, thus it is always
@@ -1919,7 +1939,7 @@ static void *_gnrc_netif_thread(void *args)
     gnrc_netif_acquire(netif);
     netif->pid = thread_getpid();
 
-    netif->event_isr.handler = _event_handler_isr;
+    netif->event_isr = (event_coalesce_t)EVENT_COALESCE_INIT(_event_handler_isr);
 #if IS_USED(MODULE_NETDEV_NEW_API)
     netif->event_tx_done.handler = _event_handler_tx_done;
 #endif
@@ -1974,6 +1994,15 @@ static void *_gnrc_netif_thread(void *args)
                 last_wakeup = ztimer_now(ZTIMER_USEC);
 #endif
                 break;
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("gnrc_netif: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                    _send(netif, gnrc_netapi_batch_get(msg.content.ptr, i), false);
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
                 opt = msg.content.ptr;
 #ifdef MODULE_NETOPT
@@ -2021,11 +2050,19 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+    /* throw away packet if no one is interested */
+    if (!gnrc_netapi_batch_dispatch(&netif->rx_batch, pkt->type,
+                                    GNRC_NETREG_DEMUX_CTX_ALL,
+                                    GNRC_NETAPI_MSG_TYPE_RCV, pkt)) {
+#else
+    (void)netif;
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
+#endif
         DEBUG("gnrc_netif: unable to forward packet of type %i\n", pkt->type);
         gnrc_pktbuf_release(pkt);
         return;
@@ -2037,7 +2074,8 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
     gnrc_netif_t *netif = (gnrc_netif_t *)dev->context;
 
     if (event == NETDEV_EVENT_ISR) {
-        event_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW], &netif->event_isr);
+        event_coalesce_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW],
+                            &netif->event_isr);
     }
 #if IS_USED(MODULE_NETDEV_NEW_API)
     else if (gnrc_netif_netdev_new_api(netif)
@@ -2070,8 +2108,11 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
+#if IS_USED(MODULE_TRACE_HOOKS)
+                    trace_hook(TRACE_EVENT_NETIF_RX, gnrc_pkt_len(pkt));
+#endif
                     _process_receive_stats(netif, pkt);
-                    _pass_on_packet(pkt);
+                    _pass_on_packet(netif, pkt);
                 }
                 break;
 #if IS_USED(MODULE_NETDEV_LEGACY_API)
@@ -100,7 +100,13 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     if (bytes_expected >= (int)IEEE802154_MIN_FRAME_LEN) {
         int nread;
 
-        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+        /* guess the MAC header length from our own addressing mode (frame
+         * control, sequence number, compressed PAN ID, destination and source
+         * address), so the MAC header can usually be marked without copying */
+        pkt = gnrc_pktbuf_add_rx(bytes_expected,
+                                 IEEE802154_FCF_LEN + 1U + 2U +
+                                 (2U * netif->l2addr_len),
+                                 GNRC_NETTYPE_UNDEF);
         if (pkt == NULL) {
             DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
             /* Discard packet on netdev device */
@@ -17,7 +17,9 @@
 #include <limits.h>
 
 #include "assert.h"
+#include "irq.h"
 #include "log.h"
+#include "mutex.h"
 #include "utlist.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/nettype.h"
@@ -31,66 +33,96 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
+/* The registry as lookup table by gnrc_nettype_t. With gnrc_netreg_hash
+ * this only holds the entries for GNRC_NETREG_DEMUX_CTX_ALL */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+#ifdef MODULE_GNRC_NETREG_HASH
+/* The entries for all other demux contexts by gnrc_nettype_t and hash of
+ * the demux context */
+static gnrc_netreg_entry_t *_buckets[GNRC_NETTYPE_NUMOF][GNRC_NETREG_HASH_BUCKETS];
+#endif
 
-/** Held while accessing _lock_counter, and also while the exclusive lock is held */
-static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
  * reaches UINT_MAX, the lock will never be freed again. This is likely
  * accurate, given that it will only happen when the lock was leaked, so it
  * can't be freed any more anyway.
  *
- * This can be accessed only when _lock_for_counter is held; an alternative
- * implementation with atomics would likely be possible, but for the case of "I
- * can't do that right now" it would still need a mutex. But that's
- * optimization that could be done without changing the public API.
+ * This is only accessed with interrupts disabled. Only the first shared lock
+ * and the release of the last one touch _lock, all others only touch this
+ * counter.
  * */
 static unsigned int _lock_counter = 0;
-/** Held while the netreg lists are being read. This is what the exclusive
- * users block on if they can't grab the exclusive lock right away.
+/** Held while _lock_counter is not 0, and also while the exclusive lock is
+ * held. The first shared lock takes it and the last one releases it, so
+ * this is what the exclusive users block on while the netreg lists are
+ * being read.
  *
- * This is largely used as a boolean flag (is locked / is unlocked) that is
- * modified while the _lock_for_counter is held, and will not block because it
- * is synchronized to _lock_counter being 0. It is only ever accessed outside
- * _lock_for_counter when waiting for the counter to reach 0, and even then is
- * released immediately to avoid deadlocks. (Instead, the exclusive acquisition
- * tries to acquire the _lock_for_counter, and if that fails it queues up again
- * after the reader that just snatched it).
+ * Shared users only block on it when they find _lock_counter at 0 and can't
+ * take it right away, i.e. while an exclusive operation is going on. Note
+ * that the thread unlocking this is not necessarily the one that locked it.
  * */
-static mutex_t _lock_wait_exclusive = MUTEX_INIT;
+static mutex_t _lock = MUTEX_INIT;
+
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type,
+                                          uint32_t demux_ctx)
+{
+#ifdef MODULE_GNRC_NETREG_HASH
+    if (demux_ctx != GNRC_NETREG_DEMUX_CTX_ALL) {
+        /* demux contexts are mostly ports or protocol numbers, so fold the
+         * upper bytes into the lowest one */
+        demux_ctx ^= demux_ctx >> 16;
+        demux_ctx ^= demux_ctx >> 8;
+        return &_buckets[type][demux_ctx & (GNRC_NETREG_HASH_BUCKETS - 1)];
+    }
+#else
+    (void)demux_ctx;
+#endif
+    return &netreg[type];
+}
 
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+#ifdef MODULE_GNRC_NETREG_HASH
+    memset(_buckets, 0, sizeof(_buckets));
+#endif
 }
 
 void gnrc_netreg_acquire_shared(void) {
-    mutex_lock(&_lock_for_counter);
-    if (_lock_counter == 0) {
-        /* At most, this blocks for the very short time until
-         * _gnrc_netreg_acquire_exclusive returns it immediately */
-        mutex_lock(&_lock_wait_exclusive);
-    }
-    if (_lock_counter != UINT_MAX) {
-        _lock_counter += 1;
+    while (true) {
+        unsigned state = irq_disable();
+
+        if ((_lock_counter != 0) || mutex_trylock(&_lock)) {
+            if (_lock_counter != UINT_MAX) {
+                _lock_counter += 1;
+            }
+            irq_restore(state);
+            return;
+        }
+        irq_restore(state);
+
+        /* an exclusive operation (or the release of the last shared lock) is
+         * going on, wait for it to finish and try again */
+        mutex_lock(&_lock);
+        mutex_unlock(&_lock);
     }
-    mutex_unlock(&_lock_for_counter);
 }
 
 void gnrc_netreg_release_shared(void) {
-    mutex_lock(&_lock_for_counter);
+    unsigned state = irq_disable();
 
     assert(_lock_counter != 0); /* Release without acquire */
 
     if (_lock_counter != UINT_MAX) {
         _lock_counter -= 1;
     }
-    if (_lock_counter == 0) {
-        mutex_unlock(&_lock_wait_exclusive);
+    bool last = (_lock_counter == 0);
+    irq_restore(state);
+
+    if (last) {
+        mutex_unlock(&_lock);
     }
-    mutex_unlock(&_lock_for_counter);
 }
 
 /** Assert that there is a shared lock on gnrc_netreg -- this should help weed
@@ -98,46 +130,47 @@ void gnrc_netreg_release_shared(void) {
 static void _gnrc_netreg_assert_shared(void) {
 #if DEVELHELP
     /* Even if we just peek: It's not an atomic, so it needs synchronization */
-    mutex_lock(&_lock_for_counter);
+    unsigned state = irq_disable();
     assert(_lock_counter != 0);
-    mutex_unlock(&_lock_for_counter);
+    irq_restore(state);
 #endif
 }
 
 static void _gnrc_netreg_acquire_exclusive(void) {
-    while (true) {
-        mutex_lock(&_lock_for_counter);
-        if (_lock_counter == 0) {
-            /* At most, this blocks for the very short time until
-             * another caller of _gnrc_netreg_acquire_exclusive returns it
-             * immediately */
-            mutex_lock(&_lock_wait_exclusive);
-            /* Leaving both locked */
-            return;
-        }
-        mutex_unlock(&_lock_for_counter);
-
-        mutex_lock(&_lock_wait_exclusive);
-        /* ... but maybe someone just started grabbing _lock_for_counter, so we
-         * give them a chance to finish rather than deadlocking them */
-        mutex_unlock(&_lock_wait_exclusive);
-    }
+    /* blocks until the last shared lock is released */
+    mutex_lock(&_lock);
 }
 
 static void _gnrc_netreg_release_exclusive(void) {
-     mutex_unlock(&_lock_wait_exclusive);
-     mutex_unlock(&_lock_for_counter);
+    mutex_unlock(&_lock);
 }
 
+#if DEVELHELP
+static inline bool _targets_pid(const gnrc_netreg_entry_t *entry)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
+    defined(MODULE_GNRC_NETAPI_BATCH)
+    switch (entry->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        case GNRC_NETREG_TYPE_BATCH:
+#endif
+            return true;
+        default:
+            return false;
+    }
+#else
+    (void)entry;
+    return true;
+#endif
+}
+#endif /* DEVELHELP */
+
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 {
 #if DEVELHELP
-# if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-    bool has_msg_q = (entry->type != GNRC_NETREG_TYPE_DEFAULT) ||
+    bool has_msg_q = !_targets_pid(entry) ||
                      thread_has_msg_queue(thread_get(entry->target.pid));
-# else
-    bool has_msg_q = thread_has_msg_queue(thread_get(entry->target.pid));
-# endif
 
     /* only threads with a message queue are allowed to register at gnrc */
     if (!has_msg_q) {
@@ -153,13 +186,15 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **head = _head(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*head, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*head, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +207,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_head(type, entry->demux_ctx), entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +249,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_head(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
@@ -16,6 +16,7 @@
 #include <inttypes.h>
 #include <kernel_defines.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "byteorder.h"
 #include "cpu_conf.h"
@@ -67,6 +68,35 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
+#ifdef MODULE_GNRC_NETAPI_BATCH
+/* packets collected for upper layers resp. network interfaces, sent when
+ * the message queue is drained */
+static gnrc_netapi_batch_t _rx_batch;
+static gnrc_netapi_batch_t _tx_batch;
+#endif
+
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+/**
+ * @brief   Next hop of a forwarded flow
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination of the flow */
+    gnrc_netif_t *netif;        /**< interface to the next hop, NULL if unused */
+    uint32_t nib_version;       /**< version of the NIB the next hop is from */
+    uint32_t last_used;         /**< _fwd_cache_clock when last used */
+    kernel_pid_t in_iface;      /**< interface the flow is received on */
+    uint8_t netif_hdr_len;      /**< length of netif_hdr */
+    /**
+     * @brief   Interface header with the link-layer address of the next hop
+     */
+    uint8_t netif_hdr[sizeof(gnrc_netif_hdr_t) + GNRC_NETIF_L2ADDR_MAXLEN];
+} _fwd_cache_entry_t;
+
+static _fwd_cache_entry_t _fwd_cache[CONFIG_GNRC_IPV6_FWD_CACHE_SIZE];
+static uint32_t _fwd_cache_clock;
+static gnrc_ipv6_fwd_cache_stats_t _fwd_cache_stats;
+#endif
+
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* Sends packet over the appropriate interface(s).
@@ -140,6 +170,17 @@ ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt)
 }
 
 /* internal functions */
+static inline int _dispatch_receive(gnrc_nettype_t type, uint32_t demux_ctx,
+                                    gnrc_pktsnip_t *pkt)
+{
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    return gnrc_netapi_batch_dispatch(&_rx_batch, type, demux_ctx,
+                                      GNRC_NETAPI_MSG_TYPE_RCV, pkt);
+#else
+    return gnrc_netapi_dispatch_receive(type, demux_ctx, pkt);
+#endif
+}
+
 static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
                                   bool interested)
 {
@@ -152,9 +193,7 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
     }
-    if (gnrc_netapi_dispatch_receive(pkt->type,
-                                     GNRC_NETREG_DEMUX_CTX_ALL,
-                                     pkt) == 0) {
+    if (_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 0) {
         gnrc_pktbuf_release(pkt);
     }
     if (!has_nh_subs) {
@@ -165,7 +204,7 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
     }
-    if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6, nh, pkt) == 0) {
+    if (_dispatch_receive(GNRC_NETTYPE_IPV6, nh, pkt) == 0) {
         gnrc_pktbuf_release(pkt);
     }
 }
@@ -173,8 +212,13 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
 static void *_event_loop(void *args)
 {
     msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                                  thread_getpid());
+#else
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
 
     (void)args;
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
@@ -191,6 +235,13 @@ static void *_event_loop(void *args)
 
     /* start event loop */
     while (1) {
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        if (msg_avail() == 0) {
+            /* burst is over, pass on what was collected */
+            gnrc_netapi_batch_flush(&_rx_batch);
+            gnrc_netapi_batch_flush(&_tx_batch);
+        }
+#endif
         DEBUG("ipv6: waiting for incoming message.\n");
         msg_receive(&msg);
 
@@ -205,6 +256,24 @@ static void *_event_loop(void *args)
                 _send(msg.content.ptr, true);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_BATCH
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND_BATCH received\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                    _send(gnrc_netapi_batch_get(msg.content.ptr, i), true);
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_GET:
             case GNRC_NETAPI_MSG_TYPE_SET:
                 DEBUG("ipv6: reply to unsupported get/set\n");
@@ -295,10 +364,14 @@ static void _send_to_iface(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         return;
     }
 #endif
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    gnrc_netapi_batch_send(&_tx_batch, netif->pid, pkt);
+#else
     if (gnrc_netif_send(netif, pkt) < 1) {
         DEBUG("ipv6: unable to send packet\n");
         gnrc_pktbuf_release(pkt);
     }
+#endif
 }
 
 static gnrc_pktsnip_t *_create_netif_hdr(uint8_t *dst_l2addr,
@@ -489,6 +562,26 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 }
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
+static void _send_unicast_over_iface(gnrc_pktsnip_t *pkt,
+                                     gnrc_netif_t *netif, bool from_me)
+{
+    if (_fragment_pkt_if_needed(pkt, netif, from_me)) {
+        DEBUG("ipv6: packet is fragmented\n");
+        return;
+    }
+    DEBUG("ipv6: send unicast over interface %" PRIkernel_pid "\n",
+          netif->pid);
+    /* and send to interface */
+#ifdef MODULE_NETSTATS_IPV6
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    netif->ipv6.stats.tx_unicast_count++;
+    irq_restore(irq_state);
+#endif
+    _send_to_iface(netif, pkt);
+}
+
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
@@ -512,24 +605,131 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
             return;
         }
         /* prep_hdr => The packet is from me */
-        if (_fragment_pkt_if_needed(pkt, netif, prep_hdr)) {
-            DEBUG("ipv6: packet is fragmented\n");
-            return;
+        _send_unicast_over_iface(pkt, netif, prep_hdr);
+    }
+}
+
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+const gnrc_ipv6_fwd_cache_stats_t *gnrc_ipv6_fwd_cache_stats(void)
+{
+    return &_fwd_cache_stats;
+}
+
+static _fwd_cache_entry_t *_fwd_cache_get(const ipv6_addr_t *dst,
+                                          kernel_pid_t in_iface,
+                                          uint32_t nib_version)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_fwd_cache); i++) {
+        _fwd_cache_entry_t *entry = &_fwd_cache[i];
+
+        if ((entry->netif != NULL) && (entry->nib_version == nib_version) &&
+            (entry->in_iface == in_iface) && ipv6_addr_equal(&entry->dst, dst)) {
+            entry->last_used = ++_fwd_cache_clock;
+            return entry;
         }
-        DEBUG("ipv6: send unicast over interface %" PRIkernel_pid "\n",
-              netif->pid);
-        /* and send to interface */
-#ifdef MODULE_NETSTATS_IPV6
-        /* This is read from the netif thread. To prevent data corruptions, we
-         * have to guarantee mutually exclusive access */
-        unsigned irq_state = irq_disable();
-        netif->ipv6.stats.tx_unicast_count++;
-        irq_restore(irq_state);
+    }
+    return NULL;
+}
+
+static bool _fwd_cacheable(const gnrc_ipv6_nib_nc_t *nce,
+                           const ipv6_addr_t *dst, gnrc_netif_t *netif)
+{
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+    case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+    case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+        break;
+    default:
+        /* the NIB needs to see the packets to verify reachability */
+        return false;
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    /* the routing protocol wants to learn about every use of a route */
+    if ((netif->ipv6.route_info_cb != NULL) &&
+        !ipv6_addr_equal(&nce->ipv6, dst)) {
+        return false;
+    }
+#else
+    (void)dst;
+    (void)netif;
 #endif
-        _send_to_iface(netif, pkt);
+    return (nce->l2addr_len <= GNRC_NETIF_L2ADDR_MAXLEN);
+}
+
+static void _fwd_cache_add(const ipv6_addr_t *dst, kernel_pid_t in_iface,
+                           uint32_t nib_version, gnrc_netif_t *netif,
+                           const gnrc_pktsnip_t *netif_hdr)
+{
+    _fwd_cache_entry_t *entry = &_fwd_cache[0];
+
+    /* replace an outdated entry or the least recently used one */
+    for (unsigned i = 0; i < ARRAY_SIZE(_fwd_cache); i++) {
+        if ((_fwd_cache[i].netif == NULL) ||
+            (_fwd_cache[i].nib_version != nib_version)) {
+            entry = &_fwd_cache[i];
+            break;
+        }
+        if ((_fwd_cache_clock - _fwd_cache[i].last_used) >
+            (_fwd_cache_clock - entry->last_used)) {
+            entry = &_fwd_cache[i];
+        }
     }
+    assert(netif_hdr->size <= sizeof(entry->netif_hdr));
+    entry->dst = *dst;
+    entry->netif = netif;
+    entry->nib_version = nib_version;
+    entry->last_used = ++_fwd_cache_clock;
+    entry->in_iface = in_iface;
+    entry->netif_hdr_len = netif_hdr->size;
+    memcpy(entry->netif_hdr, netif_hdr->data, netif_hdr->size);
 }
 
+static void _forward_unicast(gnrc_pktsnip_t *pkt, gnrc_netif_t *in_netif)
+{
+    const ipv6_hdr_t *ipv6_hdr = pkt->data;
+    /* read before the lookup, so changes during the lookup outdate the entry */
+    uint32_t nib_version = gnrc_ipv6_nib_version();
+    _fwd_cache_entry_t *entry = _fwd_cache_get(&ipv6_hdr->dst, in_netif->pid,
+                                               nib_version);
+    gnrc_ipv6_nib_nc_t nce;
+    gnrc_pktsnip_t *netif_hdr;
+    gnrc_netif_t *netif;
+
+    if (entry != NULL) {
+        DEBUG("ipv6: next hop to %s is cached\n",
+              ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
+        _fwd_cache_stats.hits++;
+        netif_hdr = gnrc_pktbuf_add(pkt, entry->netif_hdr,
+                                    entry->netif_hdr_len, GNRC_NETTYPE_NETIF);
+        if (netif_hdr == NULL) {
+            DEBUG("ipv6: error on interface header allocation, dropping packet\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+        _send_unicast_over_iface(netif_hdr, entry->netif, false);
+        return;
+    }
+    _fwd_cache_stats.misses++;
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, NULL, pkt,
+                                          &nce) < 0) {
+        /* packet is released by NIB */
+        DEBUG("ipv6: no link-layer address or interface for next hop to %s\n",
+              ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
+        return;
+    }
+    netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+    assert(netif != NULL);
+    if ((netif_hdr = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
+                                       0)) == NULL) {
+        return;
+    }
+    if (_fwd_cacheable(&nce, &ipv6_hdr->dst, netif)) {
+        _fwd_cache_add(&ipv6_hdr->dst, in_netif->pid, nib_version, netif,
+                       netif_hdr);
+    }
+    _send_unicast_over_iface(netif_hdr, netif, false);
+}
+#endif  /* MODULE_GNRC_IPV6_FWD_CACHE */
+
 static inline void _send_multicast_over_iface(gnrc_pktsnip_t *pkt,
                                               bool prep_hdr,
                                               gnrc_netif_t *netif,
@@ -724,6 +924,25 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
     }
 }
 
+#ifdef MODULE_GNRC_IPV6_ROUTER
+/* forwards a packet received over in_netif (may be NULL) in send order */
+static void _forward(gnrc_pktsnip_t *pkt, gnrc_netif_t *in_netif)
+{
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+    const ipv6_addr_t *dst = &((ipv6_hdr_t *)pkt->data)->dst;
+
+    if ((in_netif != NULL) && !ipv6_addr_is_multicast(dst) &&
+        !ipv6_addr_is_unspecified(dst)) {
+        _forward_unicast(pkt, in_netif);
+        return;
+    }
+#else
+    (void)in_netif;
+#endif
+    _send(pkt, false);
+}
+#endif  /* MODULE_GNRC_IPV6_ROUTER */
+
 /* functions for receiving */
 static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
 {
@@ -885,13 +1104,16 @@ static void _receive(gnrc_pktsnip_t *pkt)
         else if (--(hdr->hl) > 0) {  /* drop packets that *reach* Hop Limit 0 */
             DEBUG("ipv6: forward packet to next hop\n");
 
+            gnrc_netif_t *in_netif = NULL;
+
             /* remove L2 headers around IPV6 */
             if (netif_hdr != NULL) {
+                in_netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
                 gnrc_pktbuf_remove_snip(pkt, netif_hdr);
             }
             pkt = gnrc_pktbuf_reverse_snips(pkt);
             if (pkt != NULL) {
-                _send(pkt, false);
+                _forward(pkt, in_netif);
             }
             else {
                 DEBUG("ipv6: unable to reverse pkt from receive order to send "
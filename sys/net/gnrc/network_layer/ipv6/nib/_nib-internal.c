@@ -24,6 +24,7 @@
 #include "net/gnrc/ipv6/nib/conf.h"
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib.h"
+#include "atomic_utils.h"
 #include "net/gnrc/netif/internal.h"
 #include "random.h"
 
@@ -45,15 +46,193 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
+/* changed under _nib_mutex, but read without it by gnrc_ipv6_nib_version() */
+static uint32_t _nib_version;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
 
+/*
+ * Hash indices over _nodes (keyed by address and interface) and _dsts (keyed
+ * by prefix and prefix length), using open addressing with linear probing.
+ * A slot holds the index of an entry + 1, 0 marks a free slot. With twice as
+ * many slots as entries, probe sequences stay short. Entries are removed by
+ * shifting the following entries of the probe sequence back, so no tombstones
+ * accumulate.
+ *
+ * A node is in _nodes_idx if and only if its address is not unspecified, an
+ * off-link entry is in _dsts_idx if and only if its prefix length is not 0.
+ */
+#define _NODES_IDX_NUMOF    (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+#define _DSTS_IDX_NUMOF     (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+
+static_assert(CONFIG_GNRC_IPV6_NIB_NUMOF < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_NUMOF too large for hash index");
+static_assert(CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF too large for hash index");
+
+static uint16_t _nodes_idx[_NODES_IDX_NUMOF];
+static uint16_t _dsts_idx[_DSTS_IDX_NUMOF];
+/* prefix lengths of the entries in _dsts_idx */
+static BITFIELD(_dsts_pfx_lens, IPV6_ADDR_BIT_LEN + 1);
+
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
 
+static unsigned _addr_hash(const ipv6_addr_t *addr, unsigned salt)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32 ^ salt;
+
+    /* Knuth's multiplicative hash, the upper bits are mixed best */
+    return (hash * 2654435761U) >> 16;
+}
+
+static unsigned _node_home(unsigned idx)
+{
+    return _addr_hash(&_nodes[idx].ipv6, 0) % _NODES_IDX_NUMOF;
+}
+
+static unsigned _dst_home(unsigned idx)
+{
+    return _addr_hash(&_dsts[idx].pfx, _dsts[idx].pfx_len) % _DSTS_IDX_NUMOF;
+}
+
+static void _idx_insert(uint16_t *index, unsigned numof, unsigned home,
+                        unsigned idx)
+{
+    unsigned slot = home;
+
+    /* there are always free slots, as numof is twice the number of entries */
+    while (index[slot] != 0) {
+        slot = (slot + 1) % numof;
+    }
+    index[slot] = idx + 1;
+}
+
+static void _idx_remove(uint16_t *index, unsigned numof, unsigned home,
+                        unsigned idx, unsigned (*home_of)(unsigned))
+{
+    unsigned hole = home;
+
+    while (index[hole] != (idx + 1)) {
+        assert(index[hole] != 0);
+        hole = (hole + 1) % numof;
+    }
+    /* move entries after the hole back, unless that would put them before
+     * their home slot */
+    for (unsigned slot = (hole + 1) % numof; index[slot] != 0;
+         slot = (slot + 1) % numof) {
+        unsigned slot_home = home_of(index[slot] - 1);
+
+        if (((slot - slot_home + numof) % numof) >=
+            ((slot - hole + numof) % numof)) {
+            index[hole] = index[slot];
+            hole = slot;
+        }
+    }
+    index[hole] = 0;
+}
+
+static void _node_idx_add(_nib_onl_entry_t *node)
+{
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        _idx_insert(_nodes_idx, _NODES_IDX_NUMOF,
+                    _addr_hash(&node->ipv6, 0) % _NODES_IDX_NUMOF,
+                    node - _nodes);
+    }
+}
+
+static void _node_idx_remove(_nib_onl_entry_t *node)
+{
+    if (!ipv6_addr_is_unspecified(&node->ipv6)) {
+        _idx_remove(_nodes_idx, _NODES_IDX_NUMOF,
+                    _addr_hash(&node->ipv6, 0) % _NODES_IDX_NUMOF,
+                    node - _nodes, _node_home);
+    }
+}
+
+/**
+ * @brief   Gets the first non-empty node in _nodes with @p addr on @p iface
+ *
+ * @param[in] addr      A specified address.
+ * @param[in] iface     An interface.
+ * @param[in] any_iface Also match nodes without interface and, if @p iface
+ *                      is 0, nodes on any interface.
+ */
+static _nib_onl_entry_t *_node_idx_get(const ipv6_addr_t *addr, unsigned iface,
+                                       bool any_iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned slot = _addr_hash(addr, 0) % _NODES_IDX_NUMOF;
+         _nodes_idx[slot] != 0; slot = (slot + 1) % _NODES_IDX_NUMOF) {
+        _nib_onl_entry_t *node = &_nodes[_nodes_idx[slot] - 1];
+        unsigned node_iface = _nib_onl_get_if(node);
+
+        if ((node->mode != _EMPTY) &&
+            ((node_iface == iface) ||
+             (any_iface && ((node_iface == 0) || (iface == 0)))) &&
+            ipv6_addr_equal(&node->ipv6, addr) &&
+            ((res == NULL) || (node < res))) {
+            /* entries of the same key are not ordered in the probe sequence,
+             * so keep the one first in _nodes */
+            res = node;
+        }
+    }
+    return res;
+}
+
+static void _dst_idx_add(_nib_offl_entry_t *dst)
+{
+    _idx_insert(_dsts_idx, _DSTS_IDX_NUMOF,
+                _addr_hash(&dst->pfx, dst->pfx_len) % _DSTS_IDX_NUMOF,
+                dst - _dsts);
+    bf_set(_dsts_pfx_lens, dst->pfx_len);
+}
+
+static void _dst_idx_remove(_nib_offl_entry_t *dst)
+{
+    if (dst->pfx_len == 0) {
+        return;
+    }
+    _idx_remove(_dsts_idx, _DSTS_IDX_NUMOF,
+                _addr_hash(&dst->pfx, dst->pfx_len) % _DSTS_IDX_NUMOF,
+                dst - _dsts, _dst_home);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        if ((&_dsts[i] != dst) && (_dsts[i].pfx_len == dst->pfx_len)) {
+            return;
+        }
+    }
+    bf_unset(_dsts_pfx_lens, dst->pfx_len);
+}
+
+/**
+ * @brief   Gets the first non-empty off-link entry in _dsts with prefix
+ *          @p pfx / @p pfx_len
+ *
+ * @param[in] pfx       A prefix with all bits after @p pfx_len set to 0.
+ * @param[in] pfx_len   Length of @p pfx.
+ */
+static _nib_offl_entry_t *_dst_idx_get(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    _nib_offl_entry_t *res = NULL;
+
+    for (unsigned slot = _addr_hash(pfx, pfx_len) % _DSTS_IDX_NUMOF;
+         _dsts_idx[slot] != 0; slot = (slot + 1) % _DSTS_IDX_NUMOF) {
+        _nib_offl_entry_t *dst = &_dsts[_dsts_idx[slot] - 1];
+
+        if ((dst->mode != _EMPTY) && (dst->pfx_len == pfx_len) &&
+            ipv6_addr_equal(&dst->pfx, pfx) &&
+            ((res == NULL) || (dst < res))) {
+            res = dst;
+        }
+    }
+    return res;
+}
+
 void _nib_init(void)
 {
 #ifdef TEST_SUITES
@@ -62,6 +241,9 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+    memset(_nodes_idx, 0, sizeof(_nodes_idx));
+    memset(_dsts_idx, 0, sizeof(_dsts_idx));
+    memset(_dsts_pfx_lens, 0, sizeof(_dsts_pfx_lens));
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -80,6 +262,16 @@ void _nib_release(void)
     rmutex_unlock(&_nib_mutex);
 }
 
+void _nib_changed(void)
+{
+    atomic_fetch_add_u32(&_nib_version, 1);
+}
+
+uint32_t gnrc_ipv6_nib_version(void)
+{
+    return atomic_load_u32(&_nib_version);
+}
+
 static inline bool _addr_equals(const ipv6_addr_t *addr,
                                 const _nib_onl_entry_t *node)
 {
@@ -94,6 +286,14 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr)) {
+        node = _node_idx_get(addr, iface, false);
+        if (node != NULL) {
+            DEBUG("  %p is an exact match\n", (void *)node);
+            _override_node(addr, iface, node);
+            return node;
+        }
+    }
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -190,6 +390,7 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
         /* masked above already */
         node->info |= cstate;
         node->mode |= _NC;
+        _nib_changed();
     }
     if (node->next == NULL) {
         DEBUG("nib: queueing (addr = %s, iface = %u) for potential removal\n",
@@ -200,6 +401,16 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
     return node;
 }
 
+bool _nib_onl_clear(_nib_onl_entry_t *node)
+{
+    if (node->mode == _EMPTY) {
+        _node_idx_remove(node);
+        memset(node, 0, sizeof(_nib_onl_entry_t));
+        return true;
+    }
+    return false;
+}
+
 _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
 {
     for (const _nib_onl_entry_t *node = (last) ? last + 1 : _nodes;
@@ -219,6 +430,13 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = _node_idx_get(addr, iface, true);
+
+        DEBUG("  %s %p\n", (node != NULL) ? "Found" : "No suitable entry found",
+              (void *)node);
+        return node;
+    }
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -243,6 +461,7 @@ void _nib_nc_set_reachable(_nib_onl_entry_t *node)
 
     node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
+    _nib_changed();
 #ifdef TEST_SUITES
     /* exit early for unittests */
     if (netif == NULL) {
@@ -265,6 +484,7 @@ void _nib_nc_remove(_nib_onl_entry_t *node)
           ipv6_addr_to_str(addr_str, &node->ipv6, sizeof(addr_str)),
           _nib_onl_get_if(node));
     node->mode &= ~(_NC);
+    _nib_changed();
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->snd_na.event);
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     evtimer_del((evtimer_t *)&_nib_evtimer, &node->nud_timeout.event);
@@ -369,6 +589,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
         }
         _override_node(router_addr, iface, def_router->next_hop);
         def_router->next_hop->mode |= _DRL;
+        _nib_changed();
     }
     return def_router;
 }
@@ -377,6 +598,7 @@ void _nib_drl_remove(_nib_dr_entry_t *nib_dr)
 {
     if (nib_dr->next_hop != NULL) {
         nib_dr->next_hop->mode &= ~(_DRL);
+        _nib_changed();
         _nib_onl_clear(nib_dr->next_hop);
         memset(nib_dr, 0, sizeof(_nib_dr_entry_t));
     }
@@ -493,7 +715,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+                _node_idx_remove(tmp_node);
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _node_idx_add(tmp_node);
+                _nib_changed();
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -512,8 +737,11 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         }
         _override_node(next_hop, iface, dst->next_hop);
         dst->next_hop->mode |= _DST;
+        ipv6_addr_set_unspecified(&dst->pfx);
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _dst_idx_add(dst);
+        _nib_changed();
     }
     return dst;
 }
@@ -550,7 +778,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _dst_idx_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
+        _nib_changed();
     }
 }
 
@@ -575,31 +805,32 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
-    _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
-
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
-    for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
-        if (entry->mode != _EMPTY) {
-            uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
+    /* look up the prefixes of dst, longest first */
+    for (unsigned pfx_len = IPV6_ADDR_BIT_LEN; pfx_len > 0; pfx_len--) {
+        ipv6_addr_t pfx = IPV6_ADDR_UNSPECIFIED;
+        _nib_offl_entry_t *entry;
 
-            DEBUG("nib: %s/%u => ",
+        if (!bf_isset(_dsts_pfx_lens, pfx_len)) {
+            continue;
+        }
+        /* the index keys have all bits after the prefix set to 0 */
+        ipv6_addr_init_prefix(&pfx, dst, pfx_len);
+        entry = _dst_idx_get(&pfx, pfx_len);
+        if (entry != NULL) {
+            DEBUG("nib: best match %s/%u => ",
                   ipv6_addr_to_str(addr_str, &entry->pfx, sizeof(addr_str)),
                   entry->pfx_len);
-            DEBUG("%s%%%u matches with %u bits\n",
+            DEBUG("%s%%%u\n",
                   (entry->mode == _PL) ? "(nil)" :
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
-                  _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
-                res = entry;
-                best_match = match;
-            }
+                  _nib_onl_get_if(entry->next_hop));
+            return entry;
         }
     }
-    return res;
+    return NULL;
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -858,7 +1089,9 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
 {
     _nib_onl_clear(node);
     if (addr != NULL) {
+        _node_idx_remove(node);
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _node_idx_add(node);
     }
     _nib_onl_set_if(node, iface);
 }
@@ -273,6 +273,14 @@ void _nib_acquire(void);
  */
 void _nib_release(void);
 
+/**
+ * @brief   Marks a change of the NIB that may change the result of a next hop
+ *          resolution
+ *
+ * @see gnrc_ipv6_nib_version()
+ */
+void _nib_changed(void);
+
 /**
  * @brief   Gets interface identifier from a NIB entry
  *
@@ -319,14 +327,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
  * @return  true, if entry was cleared.
  * @return  false, if entry was not cleared.
  */
-static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
-{
-    if (node->mode == _EMPTY) {
-        memset(node, 0, sizeof(_nib_onl_entry_t));
-        return true;
-    }
-    return false;
-}
+bool _nib_onl_clear(_nib_onl_entry_t *node);
 
 /**
  * @brief   Iterates over on-link entries
@@ -590,8 +591,9 @@ static inline _nib_offl_entry_t *_nib_offl_add(const ipv6_addr_t *next_hop,
 {
     _nib_offl_entry_t *nib_offl = _nib_offl_alloc(next_hop, iface, pfx, pfx_len);
 
-    if (nib_offl != NULL) {
+    if ((nib_offl != NULL) && !(nib_offl->mode & mode)) {
         nib_offl->mode |= mode;
+        _nib_changed();
     }
     return nib_offl;
 }
@@ -604,6 +606,7 @@ static inline _nib_offl_entry_t *_nib_offl_add(const ipv6_addr_t *next_hop,
 static inline void _nib_offl_remove(_nib_offl_entry_t *nib_offl, uint8_t mode)
 {
     nib_offl->mode &= ~mode;
+    _nib_changed();
     _nib_offl_clear(nib_offl);
 }
 
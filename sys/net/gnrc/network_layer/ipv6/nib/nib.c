@@ -182,6 +182,8 @@ void gnrc_ipv6_nib_iface_down(gnrc_netif_t *netif, bool send_final_ra)
             gnrc_netif_ipv6_addr_remove_internal(netif, &netif->ipv6.addrs[i]);
         }
     }
+    /* next hops cached on this interface are no longer usable */
+    _nib_changed();
 
     gnrc_netif_release(netif);
 }
@@ -30,6 +30,10 @@
 static gnrc_sixlowpan_ctx_t _ctxs[GNRC_SIXLOWPAN_CTX_SIZE];
 static uint32_t _ctx_inval_times[GNRC_SIXLOWPAN_CTX_SIZE];
 static mutex_t _ctx_mutex = MUTEX_INIT;
+/* changes whenever a context changes, see gnrc_sixlowpan_ctx_version() */
+static uint32_t _ctx_version;
+/* minute the first lifetime of a context used for compression ends */
+static uint32_t _ctx_next_inval = UINT32_MAX;
 
 static uint32_t _current_minute(void);
 static void _update_lifetime(uint8_t id);
@@ -129,11 +133,43 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
           id, ipv6_addr_to_str(ipv6str, &_ctxs[id].prefix, sizeof(ipv6str)),
           _ctxs[id].prefix_len, _ctxs[id].ltime);
     _ctx_inval_times[id] = ltime + _current_minute();
+    if (comp && (_ctx_inval_times[id] < _ctx_next_inval)) {
+        _ctx_next_inval = _ctx_inval_times[id];
+    }
+    _ctx_version++;
 
     mutex_unlock(&_ctx_mutex);
     return &(_ctxs[id]);
 }
 
+void gnrc_sixlowpan_ctx_remove(uint8_t id)
+{
+    /* may be called from interrupt context, so don't lock the mutex */
+    _ctxs[id].prefix_len = 0;
+    _ctx_version++;
+}
+
+uint32_t gnrc_sixlowpan_ctx_version(void)
+{
+    uint32_t version;
+
+    mutex_lock(&_ctx_mutex);
+    if ((_ctx_next_inval != UINT32_MAX) && (_current_minute() >= _ctx_next_inval)) {
+        /* expire lifetimes that ended, so the version changes */
+        _ctx_next_inval = UINT32_MAX;
+        for (unsigned id = 0; id < GNRC_SIXLOWPAN_CTX_SIZE; id++) {
+            _update_lifetime(id);
+            if ((_ctxs[id].flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP) &&
+                (_ctx_inval_times[id] < _ctx_next_inval)) {
+                _ctx_next_inval = _ctx_inval_times[id];
+            }
+        }
+    }
+    version = _ctx_version;
+    mutex_unlock(&_ctx_mutex);
+    return version;
+}
+
 static uint32_t _current_minute(void)
 {
 #if IS_USED(MODULE_ZTIMER_MSEC)
@@ -158,6 +194,7 @@ static void _update_lifetime(uint8_t id)
         DEBUG("6lo ctx: context %u was invalidated for compression\n", id);
         _ctxs[id].ltime = 0;
         _ctxs[id].flags_id &= ~GNRC_SIXLOWPAN_CTX_FLAGS_COMP;
+        _ctx_version++;
     }
     else {
         _ctxs[id].ltime = (uint16_t)(_ctx_inval_times[id] - now);
@@ -170,6 +207,8 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    _ctx_next_inval = UINT32_MAX;
+    _ctx_version++;
 }
 #endif
 
@@ -16,6 +16,7 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
@@ -32,36 +33,27 @@
 #include "net/sixlowpan/sfr.h"
 #include "thread.h"
 #include "xtimer.h"
-#include "utlist.h"
 
 #include "net/gnrc/sixlowpan/frag/rb.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-/* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
- * MAC payload size - fragment header. */
-#ifndef GNRC_SIXLOWPAN_FRAG_SIZE
-/* assuming 64-bit source/destination address, source PAN ID omitted */
-#define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
-#endif
-
-#ifndef RBUF_INT_SIZE
-/* same as ((int) ceil((double) N / D)) */
-#define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
-#if     IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD)
-#define RBUF_INT_SIZE (DIV_CEIL(IPV6_MIN_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * \
-                       (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE + \
-                        CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE))
-#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) */
-#define RBUF_INT_SIZE (DIV_CEIL(IPV6_MIN_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * \
-                       CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
-#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) */
-#endif
+/* Hash index over rbuf, keyed by (source, destination, tag). The datagram size
+ * is not part of the key, as subsequent SFR fragments do not carry it and
+ * gnrc_sixlowpan_frag_rb_get_by_datagram() does not know it; entries with the
+ * same key but different size end up in the same chain. A bucket holds the
+ * index of the first entry of its chain + 1, _rbuf_next the index of the next
+ * entry + 1, 0 marks the end of a chain. An entry is in the index if and only
+ * if its `pkt` is not NULL. */
+#define RBUF_BUCKETS    (2 * CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
 
-static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE too large for hash index");
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t _rbuf_buckets[RBUF_BUCKETS];
+static uint8_t _rbuf_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
@@ -71,13 +63,8 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end);
-/* gets a free entry from interval buffer */
-static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
-/* update interval buffer of entry */
-static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
+/* marks the units of a fragment as received in entry */
+static void _rbuf_set_received(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size);
 /* gets an entry identified by its tuple */
 static int _rbuf_get(const void *src, size_t src_len,
@@ -110,30 +97,222 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
                            unsigned page);
 static int _rbuf_resize_for_reassembly(gnrc_sixlowpan_frag_rb_t *rbuf);
 
+/* first unit starting within a fragment */
+static inline unsigned _first_unit(size_t offset)
+{
+    return (offset + GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE - 1) /
+           GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+}
+
+/* octets [from, to) of a unit */
+static inline uint8_t _octets(unsigned from, unsigned to)
+{
+    return (uint8_t)(((1U << (to - from)) - 1) << from);
+}
+
+/* octets of @p unit covered by the fragment [offset, end) */
+static uint8_t _frag_octets(size_t offset, size_t end, unsigned unit)
+{
+    const size_t unit_start = unit * GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+    unsigned from = 0;
+    unsigned to = GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+
+    if (offset > unit_start) {
+        from = offset - unit_start;
+    }
+    if (end < (unit_start + GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE)) {
+        to = end - unit_start;
+    }
+    return _octets(from, to);
+}
+
+static gnrc_sixlowpan_frag_rb_part_t *_part(gnrc_sixlowpan_frag_rb_base_t *entry,
+                                            unsigned unit)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(entry->parts); i++) {
+        if ((entry->parts[i].octets != 0) && (entry->parts[i].unit == unit)) {
+            return &entry->parts[i];
+        }
+    }
+    return NULL;
+}
+
+static unsigned _parts_free(const gnrc_sixlowpan_frag_rb_base_t *entry)
+{
+    unsigned res = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(entry->parts); i++) {
+        res += (entry->parts[i].octets == 0);
+    }
+    return res;
+}
+
+/* received octets of a unit */
+static uint8_t _received(gnrc_sixlowpan_frag_rb_base_t *entry, unsigned unit)
+{
+    gnrc_sixlowpan_frag_rb_part_t *part;
+
+    if (bf_isset(entry->received, unit)) {
+        return UINT8_MAX;
+    }
+    part = _part(entry, unit);
+    return (part != NULL) ? part->octets : 0;
+}
+
+/* adds received octets to a unit, returns false if they would need a record
+ * of a partially received unit, but there is none left */
+static bool _add_received(gnrc_sixlowpan_frag_rb_base_t *entry, unsigned unit,
+                          uint8_t octets)
+{
+    gnrc_sixlowpan_frag_rb_part_t *part = _part(entry, unit);
+
+    octets |= _received(entry, unit);
+    if (octets == UINT8_MAX) {
+        bf_set(entry->received, unit);
+        if (part != NULL) {
+            part->octets = 0;
+        }
+        return true;
+    }
+    for (unsigned i = 0; (part == NULL) && (i < ARRAY_SIZE(entry->parts)); i++) {
+        if (entry->parts[i].octets == 0) {
+            part = &entry->parts[i];
+        }
+    }
+    if (part == NULL) {
+        return false;
+    }
+    part->unit = unit;
+    part->octets = octets;
+    return true;
+}
+
 static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
-    gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
-
+    const size_t end = offset + frag_size;
+    const unsigned first = offset / GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+    const unsigned last = (end - 1) / GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+    bool overlap = false, missing = false;
+    unsigned parts_needed = 0;
+
+    if (frag_size == 0) {
+        return RBUF_ADD_SUCCESS;
+    }
+    if (last >= GNRC_SIXLOWPAN_FRAG_RB_UNITS) {
+        DEBUG("6lo rbuf: fragment exceeds maximum datagram size\n");
+        return RBUF_ADD_REPEAT;
+    }
+    for (unsigned i = first; i <= last; i++) {
+        uint8_t octets = _frag_octets(offset, end, i);
+        uint8_t received = _received(entry, i);
+
+        overlap |= ((received & octets) != 0);
+        missing |= ((received & octets) != octets);
+        if ((received == 0) && (octets != UINT8_MAX)) {
+            parts_needed++;
+        }
+    }
+    if (!overlap) {
+        if (parts_needed > _parts_free(entry)) {
+            DEBUG("6lo rbuf: no record left for partially received units\n");
+            return RBUF_ADD_ERROR;
+        }
+        return RBUF_ADD_SUCCESS;
+    }
+    if (!missing) {
+        if ((offset % GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE) != 0) {
+            /* only selective fragment recovery allows fragments to start
+             * within a unit. The start of received fragments is only known
+             * per unit, so take a fragment that was received completely as
+             * duplicate */
+            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+            return RBUF_ADD_DUPLICATE;
+        }
+        /* Received fragments never overlap, so an already received fragment
+         * is identical to this one if it starts at `offset`, no other
+         * fragment starts within this one, and the octet after it was not
+         * received or starts another fragment. A fragment ending within a
+         * unit is only followed by a received octet with selective fragment
+         * recovery, so take it as duplicate as well. */
+        bool identical = bf_isset(entry->starts, first);
+        const unsigned next = end / GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+
+        for (unsigned i = first + 1; identical && (i <= last); i++) {
+            identical = !bf_isset(entry->starts, i);
+        }
+        if (identical && ((end % GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE) == 0) &&
+            (next < GNRC_SIXLOWPAN_FRAG_RB_UNITS)) {
+            identical = !(_received(entry, next) & 1) ||
+                        bf_isset(entry->starts, next);
+        }
+        if (identical) {
+            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+            return RBUF_ADD_DUPLICATE;
+        }
+    }
     /* If the fragment overlaps another fragment and differs in either the size
      * or the offset of the overlapped fragment, discards the datagram
+     * https://tools.ietf.org/html/rfc4944#section-5.3
+     *
+     * "A fresh reassembly may be commenced with the most recently
+     * received link fragment"
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
+    return RBUF_ADD_REPEAT;
+}
 
-            /* "A fresh reassembly may be commenced with the most recently
-             * received link fragment"
-             * https://tools.ietf.org/html/rfc4944#section-5.3 */
-            return RBUF_ADD_REPEAT;
-        }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
-            return RBUF_ADD_DUPLICATE;
+static unsigned _rbuf_hash(const uint8_t *src, size_t src_len,
+                           const uint8_t *dst, size_t dst_len, uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 31) + src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash * 31) + dst[i];
+    }
+    /* Knuth's multiplicative hash, the upper bits are mixed best */
+    return ((hash * 2654435761U) >> 16) % RBUF_BUCKETS;
+}
+
+static inline unsigned _rbuf_bucket(const gnrc_sixlowpan_frag_rb_t *e)
+{
+    return _rbuf_hash(e->super.src, e->super.src_len,
+                      e->super.dst, e->super.dst_len, e->super.tag);
+}
+
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len, uint16_t tag)
+{
+    return (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+static void _rbuf_idx_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    unsigned bucket = _rbuf_bucket(e);
+
+    _rbuf_next[e - rbuf] = _rbuf_buckets[bucket];
+    _rbuf_buckets[bucket] = (e - rbuf) + 1;
+}
+
+static void _rbuf_idx_remove(gnrc_sixlowpan_frag_rb_t *e)
+{
+    uint8_t *ptr = &_rbuf_buckets[_rbuf_bucket(e)];
+
+    while (*ptr != 0) {
+        if (*ptr == ((e - rbuf) + 1)) {
+            *ptr = _rbuf_next[e - rbuf];
+            _rbuf_next[e - rbuf] = 0;
+            return;
         }
-        ptr = ptr->next;
+        ptr = &_rbuf_next[*ptr - 1];
     }
-    return RBUF_ADD_SUCCESS;
 }
 
 gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_add(gnrc_netif_hdr_t *netif_hdr,
@@ -189,14 +368,12 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    for (unsigned i = _rbuf_buckets[_rbuf_hash(src, src_len, dst, dst_len,
+                                               tag)];
+         i != 0; i = _rbuf_next[i - 1]) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i - 1];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag)) {
             return e;
         }
     }
@@ -358,21 +535,21 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                 DEBUG("6lo rbuf minfwd: not forwarding duplicate\n");
                 gnrc_pktbuf_release(pkt);
                 return RBUF_ADD_FORWARDED;
+            case RBUF_ADD_ERROR:
+                gnrc_pktbuf_release(pkt);
+                return RBUF_ADD_ERROR;
             default:
                 break;
         }
-        res = RBUF_ADD_ERROR;
-        if (_rbuf_update_ints(entry.super, offset, frag_size)) {
-            DEBUG("6lo rbuf minfwd: trying to forward fragment\n");
-            entry.super->current_size += (uint16_t)frag_size;
-            if (_forward_frag(pkt, sizeof(sixlowpan_frag_n_t), entry.vrb,
-                              page) < 0) {
-                DEBUG("6lo rbuf minfwd: unable to forward fragment\n");
-                return RBUF_ADD_ERROR;
-            }
-            res = RBUF_ADD_FORWARDED;
+        _rbuf_set_received(entry.super, offset, frag_size);
+        DEBUG("6lo rbuf minfwd: trying to forward fragment\n");
+        entry.super->current_size += (uint16_t)frag_size;
+        if (_forward_frag(pkt, sizeof(sixlowpan_frag_n_t), entry.vrb,
+                          page) < 0) {
+            DEBUG("6lo rbuf minfwd: unable to forward fragment\n");
+            return RBUF_ADD_ERROR;
         }
-        return res;
+        return RBUF_ADD_FORWARDED;
     }
     else if ((res = _rbuf_get(src, netif_hdr->src_l2addr_len,
                               dst, netif_hdr->dst_l2addr_len,
@@ -402,119 +579,99 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         case RBUF_ADD_DUPLICATE:
             gnrc_pktbuf_release(pkt);
             return res;
+        case RBUF_ADD_ERROR:
+            gnrc_pktbuf_release(pkt);
+            return RBUF_ADD_ERROR;
         default:
             break;
     }
 
-    if (_rbuf_update_ints(entry.super, offset, frag_size)) {
-        DEBUG("6lo rbuf: add fragment data\n");
-        entry.super->current_size += (uint16_t)frag_size;
-        if (offset == 0) {
-            if (IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC) &&
-                sixlowpan_iphc_is(data)) {
-                DEBUG("6lo rbuf: detected IPHC header.\n");
-                gnrc_pktsnip_t *frag_hdr = _mark_frag_hdr(pkt);
-
-                if (frag_hdr == NULL) {
-                    DEBUG("6lo rbuf: unable to mark fragment header. "
-                          "aborting reassembly.\n");
-                    gnrc_pktbuf_release(entry.rbuf->pkt);
-                    gnrc_pktbuf_release(pkt);
-                    gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
-                    return RBUF_ADD_ERROR;
-                }
-                else {
-                    DEBUG("6lo rbuf: handing over to IPHC reception.\n");
-                    /* `pkt` released in IPHC */
-                    gnrc_sixlowpan_iphc_recv(pkt, entry.rbuf, 0);
-                    /* check if entry was deleted in IPHC (error case) */
-                    if (gnrc_sixlowpan_frag_rb_entry_empty(entry.rbuf)) {
-                        res = RBUF_ADD_ERROR;
-                    }
-                    return res;
-                }
+    _rbuf_set_received(entry.super, offset, frag_size);
+    DEBUG("6lo rbuf: add fragment data\n");
+    entry.super->current_size += (uint16_t)frag_size;
+    if (offset == 0) {
+        if (IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC) &&
+            sixlowpan_iphc_is(data)) {
+            DEBUG("6lo rbuf: detected IPHC header.\n");
+            gnrc_pktsnip_t *frag_hdr = _mark_frag_hdr(pkt);
+
+            if (frag_hdr == NULL) {
+                DEBUG("6lo rbuf: unable to mark fragment header. "
+                      "aborting reassembly.\n");
+                gnrc_pktbuf_release(entry.rbuf->pkt);
+                gnrc_pktbuf_release(pkt);
+                gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
+                return RBUF_ADD_ERROR;
             }
-            else if (data[0] == SIXLOWPAN_UNCOMP) {
-                DEBUG("6lo rbuf: detected uncompressed datagram\n");
-                data++;
-                if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) &&
-                    /* only try minimal forwarding when fragment is the only
-                     * fragment in reassembly buffer yet */
-                    sixlowpan_frag_1_is(pkt->data) &&
-                    (entry.super->current_size == frag_size)) {
-                    gnrc_sixlowpan_frag_vrb_t *vrbe;
-                    gnrc_pktsnip_t tmp = {
-                        .data = data,
-                        .size = frag_size,
-                        .users = 1,
-                    };
-
-                    if (_check_hdr(&tmp, page) &&
-                        (vrbe = gnrc_sixlowpan_frag_vrb_from_route(
-                                    entry.super,
-                                    gnrc_netif_hdr_get_netif(netif_hdr),
-                                    &tmp))) {
-                        _adapt_hdr(&tmp, page);
-                        return _forward_uncomp(pkt, rbuf, vrbe, page);
-                    }
-                }
-                else if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-                         sixlowpan_sfr_rfrag_is(pkt->data)) {
-                    entry.super->datagram_size--;
+            else {
+                DEBUG("6lo rbuf: handing over to IPHC reception.\n");
+                /* `pkt` released in IPHC */
+                gnrc_sixlowpan_iphc_recv(pkt, entry.rbuf, 0);
+                /* check if entry was deleted in IPHC (error case) */
+                if (gnrc_sixlowpan_frag_rb_entry_empty(entry.rbuf)) {
+                    res = RBUF_ADD_ERROR;
                 }
+                return res;
             }
         }
-        if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) ||
-            IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)) {
-            /* all cases to try forwarding with minfwd or SFR above failed so
-             * just do normal reassembly. For the `minfwd` case however, we need
-             * to resize `entry.rbuf->pkt`, since we kept the packet allocation
-             * with fragment forwarding as minimal as possible in
-             * `_rbuf_get()` */
-            res = _rbuf_resize_for_reassembly(entry.rbuf);
-            if (res == RBUF_ADD_ERROR) {
-                gnrc_pktbuf_release(pkt);
-                return res;
+        else if (data[0] == SIXLOWPAN_UNCOMP) {
+            DEBUG("6lo rbuf: detected uncompressed datagram\n");
+            data++;
+            if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) &&
+                /* only try minimal forwarding when fragment is the only
+                 * fragment in reassembly buffer yet */
+                sixlowpan_frag_1_is(pkt->data) &&
+                (entry.super->current_size == frag_size)) {
+                gnrc_sixlowpan_frag_vrb_t *vrbe;
+                gnrc_pktsnip_t tmp = {
+                    .data = data,
+                    .size = frag_size,
+                    .users = 1,
+                };
+
+                if (_check_hdr(&tmp, page) &&
+                    (vrbe = gnrc_sixlowpan_frag_vrb_from_route(
+                                entry.super,
+                                gnrc_netif_hdr_get_netif(netif_hdr),
+                                &tmp))) {
+                    _adapt_hdr(&tmp, page);
+                    return _forward_uncomp(pkt, rbuf, vrbe, page);
+                }
+            }
+            else if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
+                     sixlowpan_sfr_rfrag_is(pkt->data)) {
+                entry.super->datagram_size--;
             }
         }
-        memcpy(((uint8_t *)entry.rbuf->pkt->data) + offset, data,
-               frag_size);
     }
-    else {
-        /* no space left in rbuf interval buffer*/
-        gnrc_pktbuf_release(entry.rbuf->pkt);
-        gnrc_sixlowpan_frag_rb_remove(entry.rbuf);
-        res = RBUF_ADD_ERROR;
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) ||
+        IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)) {
+        /* all cases to try forwarding with minfwd or SFR above failed so
+         * just do normal reassembly. For the `minfwd` case however, we need
+         * to resize `entry.rbuf->pkt`, since we kept the packet allocation
+         * with fragment forwarding as minimal as possible in
+         * `_rbuf_get()` */
+        res = _rbuf_resize_for_reassembly(entry.rbuf);
+        if (res == RBUF_ADD_ERROR) {
+            gnrc_pktbuf_release(pkt);
+            return res;
+        }
     }
+    memcpy(((uint8_t *)entry.rbuf->pkt->data) + offset, data,
+           frag_size);
     /* no errors and not consumed => release packet */
     gnrc_pktbuf_release(pkt);
     return res;
 }
 
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end)
-{
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
-}
-
-static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
-{
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
-    }
-
-    return NULL;
-}
-
 #ifdef TEST_SUITES
 bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end > 0) {
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
+            ((bf_find_first_set(rbuf[i].super.received,
+                                GNRC_SIXLOWPAN_FRAG_RB_UNITS) >= 0) ||
+             (_parts_free(&rbuf[i].super) < ARRAY_SIZE(rbuf[i].super.parts)))) {
             return false;
         }
     }
@@ -522,34 +679,36 @@ bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 }
 #endif  /* TEST_SUITES */
 
-static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
+static void _rbuf_set_received(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size)
 {
-    gnrc_sixlowpan_frag_rb_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
-
-    new = _rbuf_int_get_free();
+    const size_t end = offset + frag_size;
+    const unsigned first = offset / GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+    const unsigned last = (end - 1) / GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
 
-    if (new == NULL) {
-        DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
-        return false;
+    if (frag_size == 0) {
+        return;
     }
+    /* _check_fragments() made sure that the fragment fits */
+    assert(last < GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    if (_first_unit(offset) <= last) {
+        bf_set(entry->starts, _first_unit(offset));
+    }
+    for (unsigned i = first; i <= last; i++) {
+        bool added = _add_received(entry, i, _frag_octets(offset, end, i));
 
-    new->start = offset;
-    new->end = end;
+        /* _check_fragments() made sure that there are enough records */
+        assert(added);
+        (void)added;
+    }
 
-    DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(entry->src,
-                                                       entry->src_len,
-                                                       l2addr_str));
+    DEBUG("6lo rfrag: add octets [%u, %u) to entry (%s, ", offset,
+          (unsigned)end,
+          gnrc_netif_addr_to_str(entry->src, entry->src_len, l2addr_str));
     DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->dst,
                                                   entry->dst_len,
                                                   l2addr_str),
           entry->datagram_size, entry->tag);
-
-    LL_PREPEND(entry->ints, new);
-
-    return true;
 }
 
 static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
@@ -607,41 +766,46 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
+    /* check first if entry already available */
+    for (unsigned i = _rbuf_buckets[_rbuf_hash(src, src_len, dst, dst_len,
+                                               tag)];
+         i != 0; i = _rbuf_next[i - 1]) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i - 1];
+
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag) &&
             ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
               /* not all SFR fragments carry the datagram size, so make 0 a
                * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
+              ((size == 0) || (e->super.datagram_size == size))) ||
              (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
+              (e->super.datagram_size == size)))) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)e,
+                  gnrc_netif_addr_to_str(e->super.src, e->super.src_len,
                                          l2addr_str));
             DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
+                  gnrc_netif_addr_to_str(e->super.dst, e->super.dst_len,
                                          l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+                  (unsigned)e->super.datagram_size, e->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
+            if (e->super.current_size == 0) {
                 /* ensure that only empty reassembly buffer entries and entries
                  * scheduled for deletion have `current_size == 0` */
                 DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
                 return -1;
             }
 #endif
-            rbuf[i].super.arrival = now_usec;
+            e->super.arrival = now_usec;
             _set_rbuf_timeout();
-            return i;
+            return i - 1;
         }
+    }
+
+    if (size > CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DATAGRAM_SIZE_MAX) {
+        DEBUG("6lo rfrag: datagram too large for reassembly buffer\n");
+        return -1;
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -729,6 +893,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+    _rbuf_idx_add(res);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
@@ -751,7 +916,6 @@ static int _rbuf_get(const void *src, size_t src_len,
 void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
-    memset(rbuf_int, 0, sizeof(rbuf_int));
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -759,6 +923,8 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    memset(_rbuf_next, 0, sizeof(_rbuf_next));
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -769,15 +935,38 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
-    while (entry->ints != NULL) {
-        gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
+    bf_clear_all(entry->received, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    bf_clear_all(entry->starts, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    memset(entry->parts, 0, sizeof(entry->parts));
+    entry->datagram_size = 0;
+}
 
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
+void gnrc_sixlowpan_frag_rb_base_merge(gnrc_sixlowpan_frag_rb_base_t *dst,
+                                       const gnrc_sixlowpan_frag_rb_base_t *src)
+{
+    bf_or(dst->received, dst->received, src->received,
+          GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    bf_or(dst->starts, dst->starts, src->starts, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
+    for (unsigned i = 0; i < ARRAY_SIZE(src->parts); i++) {
+        const gnrc_sixlowpan_frag_rb_part_t *part = &src->parts[i];
+
+        if ((part->octets != 0) &&
+            !_add_received(dst, part->unit, part->octets)) {
+            /* take the whole unit as received, so that fragments overlapping
+             * it are not missed */
+            _add_received(dst, part->unit, UINT8_MAX);
+        }
     }
-    entry->datagram_size = 0;
+}
+
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    assert(rbuf != NULL);
+    if (rbuf->pkt != NULL) {
+        _rbuf_idx_remove(rbuf);
+    }
+    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
+    rbuf->pkt = NULL;
 }
 
 static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
@@ -802,14 +991,7 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
 static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
-    unsigned frags = 0;
-    gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
-
-    while (frag) {
-        frag = frag->next;
-        frags++;
-    }
-    return frags;
+    return bf_popcnt(rbuf->super.starts, GNRC_SIXLOWPAN_FRAG_RB_UNITS);
 }
 #endif
 
@@ -926,9 +1108,6 @@ static int _forward_uncomp(gnrc_pktsnip_t *pkt,
     int res = _forward_frag(pkt, sizeof(sixlowpan_frag_t),
                             vrbe, page);
 
-    /* prevent intervals from being deleted (they are in the
-     * VRB now) */
-    rbuf->super.ints = NULL;
     gnrc_pktbuf_release(rbuf->pkt);
     gnrc_sixlowpan_frag_rb_remove(rbuf);
     return (res == 0) ? RBUF_ADD_SUCCESS : RBUF_ADD_ERROR;
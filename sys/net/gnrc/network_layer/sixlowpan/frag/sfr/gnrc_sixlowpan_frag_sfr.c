@@ -466,12 +466,6 @@ int gnrc_sixlowpan_frag_sfr_forward(gnrc_pktsnip_t *pkt,
     gnrc_pktsnip_t *hdrsnip = gnrc_pktbuf_add(pkt, rfrag, sizeof(*rfrag),
                                               GNRC_NETTYPE_SIXLOWPAN);
 
-    /* free all intervals associated to the VRB entry, as we don't need them
-     * with SFR, so throw them out, to save this resource */
-    while (vrbe->super.ints) {
-        vrbe->super.ints->end = 0U;
-        vrbe->super.ints = vrbe->super.ints->next;
-    }
     if (hdrsnip == NULL) {
         DEBUG("6lo sfr: Unable to allocate new rfrag header\n");
         gnrc_pktbuf_release(pkt);
@@ -17,8 +17,10 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "byteorder.h"
+#include "container.h"
 #include "net/ipv6/hdr.h"
 #include "net/ipv6/ext.h"
 #include "net/gnrc.h"
@@ -930,8 +932,6 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                 if ((res = _forward_frag(ipv6, sixlo->next, vrbe, page)) == 0) {
                     DEBUG("6lo iphc: successfully recompressed and forwarded "
                           "1st fragment\n");
-                    /* empty list, as it should be in VRB now */
-                    rbuf->super.ints = NULL;
                 }
             }
             if ((ipv6 == NULL) || (res < 0)) {
@@ -1583,6 +1583,187 @@ static inline bool _compressible(gnrc_pktsnip_t *hdr)
     }
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+/* IPHC header with CID extension and all fields inline plus NHC UDP header
+ * without checksum */
+#define IPHC_CACHE_HDR_MAX          (SIXLOWPAN_IPHC_HDR_LEN + \
+                                     SIXLOWPAN_IPHC_CID_EXT_LEN + \
+                                     4U + 1U + 1U + (2 * sizeof(ipv6_addr_t)) + \
+                                     1U + 4U)
+/* the IPv6 header fields behind the payload length */
+#define IPHC_CACHE_IPV6_OFFSET      offsetof(ipv6_hdr_t, nh)
+#define IPHC_CACHE_IPV6_LEN         (sizeof(ipv6_hdr_t) - IPHC_CACHE_IPV6_OFFSET)
+
+/**
+ * @brief   Compressed headers of a flow
+ */
+typedef struct {
+    ipv6_hdr_t ipv6;                    /**< IPv6 header, length is ignored */
+    network_uint16_t ports[2];          /**< UDP ports, if iphc_cache_entry_t::udp */
+    uint32_t ctx_version;               /**< gnrc_sixlowpan_ctx_version() */
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];       /**< address of the interface */
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];   /**< link-layer destination */
+#endif
+    uint8_t hdr[IPHC_CACHE_HDR_MAX];    /**< the compressed headers */
+    kernel_pid_t iface;                 /**< interface the headers were compressed for */
+    uint16_t last_used;                 /**< value of _iphc_cache_clock when last used */
+    uint8_t l2addr_len;                 /**< length of iphc_cache_entry_t::l2addr */
+    uint8_t dst_l2addr_len;             /**< length of iphc_cache_entry_t::dst_l2addr */
+    uint8_t len;                        /**< length of iphc_cache_entry_t::hdr, 0 if unused */
+    bool udp;                           /**< UDP header is compressed with NHC */
+} iphc_cache_entry_t;
+
+/* only accessed from the 6LoWPAN thread */
+static iphc_cache_entry_t _iphc_cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static uint16_t _iphc_cache_clock;
+
+static inline bool _iphc_cache_udp(uint8_t nh)
+{
+    return IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_NHC) && (nh == PROTNUM_UDP);
+}
+
+/* the encoding of other compressible next headers depends on more than the
+ * IPv6 and UDP headers, so only cache flows without them */
+static bool _iphc_cache_flow(const gnrc_pktsnip_t *pkt)
+{
+    const ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+
+    if (_iphc_cache_udp(ipv6_hdr->nh)) {
+        return (pkt->next->next != NULL) &&
+               (pkt->next->next->size >= sizeof(udp_hdr_t));
+    }
+    return !_compressible_nh(ipv6_hdr->nh);
+}
+
+static bool _iphc_cache_match(const iphc_cache_entry_t *entry,
+                              const gnrc_pktsnip_t *pkt,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              const gnrc_netif_t *iface, uint32_t ctx_version)
+{
+    const ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+
+    if ((entry->len == 0) || (entry->iface != iface->pid) ||
+        (entry->ctx_version != ctx_version) ||
+        (entry->ipv6.v_tc_fl.u32 != ipv6_hdr->v_tc_fl.u32) ||
+        memcmp((const uint8_t *)&entry->ipv6 + IPHC_CACHE_IPV6_OFFSET,
+               (const uint8_t *)ipv6_hdr + IPHC_CACHE_IPV6_OFFSET,
+               IPHC_CACHE_IPV6_LEN) ||
+        (entry->dst_l2addr_len != netif_hdr->dst_l2addr_len)) {
+        return false;
+    }
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    /* the IIDs used for compression are derived from the link-layer
+     * addresses */
+    if ((entry->l2addr_len != iface->l2addr_len) ||
+        memcmp(entry->l2addr, iface->l2addr, entry->l2addr_len) ||
+        memcmp(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+               entry->dst_l2addr_len)) {
+        return false;
+    }
+#endif
+    return !entry->udp ||
+           (memcmp(entry->ports, pkt->next->next->data, sizeof(entry->ports)) == 0);
+}
+
+/**
+ * @brief   Copies the cached headers for the flow of @p pkt to @p iphc_hdr
+ *
+ * @pre `_iphc_cache_flow(pkt)`
+ *
+ * @return  Length of the headers in @p iphc_hdr, including the UDP checksum
+ * @return  0, if the flow is not cached
+ */
+static size_t _iphc_cache_encode(gnrc_pktsnip_t *pkt,
+                                 const gnrc_netif_hdr_t *netif_hdr,
+                                 const gnrc_netif_t *iface,
+                                 uint32_t ctx_version, uint8_t *iphc_hdr)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_iphc_cache); i++) {
+        iphc_cache_entry_t *entry = &_iphc_cache[i];
+        size_t len = entry->len;
+
+        if (!_iphc_cache_match(entry, pkt, netif_hdr, iface, ctx_version)) {
+            continue;
+        }
+        DEBUG("6lo iphc: using cached headers of flow %u\n", i);
+        memcpy(iphc_hdr, entry->hdr, len);
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+        if (entry->udp) {
+            gnrc_pktsnip_t *udp = pkt->next->next;
+            const udp_hdr_t *udp_hdr = udp->data;
+
+            iphc_hdr[len++] = udp_hdr->checksum.u8[0];
+            iphc_hdr[len++] = udp_hdr->checksum.u8[1];
+            /* remove UDP header, encode the packet from scratch on failure */
+            if (!_remove_header(pkt, udp, sizeof(udp_hdr_t))) {
+                return 0;
+            }
+        }
+#endif
+        entry->last_used = _iphc_cache_clock++;
+        return len;
+    }
+    return 0;
+}
+
+/**
+ * @brief   Adds the headers @p iphc_hdr of the flow of @p pkt to the cache
+ *
+ * @pre `_iphc_cache_flow(pkt)` was true before encoding @p pkt
+ *
+ * @param[in] ports     The UDP ports of @p pkt before encoding
+ * @param[in] len       Length of @p iphc_hdr, including the UDP checksum
+ */
+static void _iphc_cache_add(const gnrc_pktsnip_t *pkt,
+                            const gnrc_netif_hdr_t *netif_hdr,
+                            const gnrc_netif_t *iface, uint32_t ctx_version,
+                            const network_uint16_t *ports,
+                            const uint8_t *iphc_hdr, size_t len)
+{
+    const ipv6_hdr_t *ipv6_hdr = pkt->next->data;
+    iphc_cache_entry_t *entry = &_iphc_cache[0];
+    bool udp = _iphc_cache_udp(ipv6_hdr->nh);
+
+    if (udp) {
+        /* the checksum is taken from each packet */
+        len -= sizeof(network_uint16_t);
+    }
+    if ((len > sizeof(entry->hdr)) ||
+        (netif_hdr->dst_l2addr_len > GNRC_NETIF_L2ADDR_MAXLEN)) {
+        return;
+    }
+    /* replace the least recently used entry */
+    for (unsigned i = 0; i < ARRAY_SIZE(_iphc_cache); i++) {
+        if (_iphc_cache[i].len == 0) {
+            entry = &_iphc_cache[i];
+            break;
+        }
+        if ((uint16_t)(_iphc_cache_clock - _iphc_cache[i].last_used) >
+            (uint16_t)(_iphc_cache_clock - entry->last_used)) {
+            entry = &_iphc_cache[i];
+        }
+    }
+    entry->ipv6 = *ipv6_hdr;
+    if (udp) {
+        memcpy(entry->ports, ports, sizeof(entry->ports));
+    }
+    entry->ctx_version = ctx_version;
+#if GNRC_NETIF_L2ADDR_MAXLEN > 0
+    entry->l2addr_len = iface->l2addr_len;
+    memcpy(entry->l2addr, iface->l2addr, iface->l2addr_len);
+    memcpy(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+#endif
+    entry->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->hdr, iphc_hdr, len);
+    entry->iface = iface->pid;
+    entry->last_used = _iphc_cache_clock++;
+    entry->len = len;
+    entry->udp = udp;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) */
+
 static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
                                     const gnrc_netif_hdr_t *netif_hdr,
                                     gnrc_netif_t *iface)
@@ -1629,15 +1810,36 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
     }
 
     iphc_hdr = dispatch->data;
-    inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
+    nh = ((ipv6_hdr_t *)pkt->next->data)->nh;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    uint32_t ctx_version = gnrc_sixlowpan_ctx_version();
+    network_uint16_t ports[2] = { { 0 } };
+    bool cache = _iphc_cache_flow(pkt);
 
+    if (cache) {
+        inline_pos = _iphc_cache_encode(pkt, netif_hdr, iface, ctx_version,
+                                        iphc_hdr);
+    }
+    if (inline_pos > 0) {
+        /* next header is already compressed */
+        nh = PROTNUM_RESERVED;
+        cache = false;
+    }
+    else if (cache && _iphc_cache_udp(nh)) {
+        /* UDP header is removed while encoding */
+        memcpy(ports, pkt->next->next->data, sizeof(ports));
+    }
+#endif
     if (inline_pos == 0) {
-        DEBUG("6lo iphc: error encoding IPv6 header\n");
-        gnrc_pktbuf_release(dispatch);
-        return NULL;
+        inline_pos = _iphc_ipv6_encode(pkt, netif_hdr, iface, iphc_hdr);
+
+        if (inline_pos == 0) {
+            DEBUG("6lo iphc: error encoding IPv6 header\n");
+            gnrc_pktbuf_release(dispatch);
+            return NULL;
+        }
     }
 
-    nh = ((ipv6_hdr_t *)pkt->next->data)->nh;
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
     while (_compressible_nh(nh)) {
         ssize_t local_pos = 0;
@@ -1684,6 +1886,12 @@ static gnrc_pktsnip_t *_iphc_encode(gnrc_pktsnip_t *pkt,
         inline_pos += local_pos;
     }
 #endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+    if (cache) {
+        _iphc_cache_add(pkt, netif_hdr, iface, ctx_version, ports, iphc_hdr,
+                        inline_pos);
+    }
+#endif
 
     /* shrink dispatch allocation to final size */
     /* NOTE: Since this only shrinks the data nothing bad SHOULD happen ;-) */
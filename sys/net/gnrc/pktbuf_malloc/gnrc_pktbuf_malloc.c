@@ -112,6 +112,16 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_add_rx(size_t size, size_t hdr_len,
+                                   gnrc_nettype_t type)
+{
+    /* marked headers are always copied into their own allocation here, so
+     * there is nothing to gain from placing the frame */
+    (void)hdr_len;
+    assert(size > 0);
+    return gnrc_pktbuf_add(NULL, NULL, size, type);
+}
+
 static gnrc_pktsnip_t *_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *header;
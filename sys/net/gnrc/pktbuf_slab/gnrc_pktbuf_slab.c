@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Size classes for the static packet buffer
+ *
+ * The chunks of all classes are laid out back to back in `_slab_buf`,
+ * class by class. Free chunks of a class are kept in a singly linked list
+ * stored in the chunks themselves.
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+#include "pktbuf_slab.h"
+#include "pktbuf_static.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* same as _align(sizeof(gnrc_pktsnip_t)), but usable as constant expression */
+#define _SNIP_SIZE      ((sizeof(gnrc_pktsnip_t) + GNRC_PKTBUF_STATIC_ALIGN_MASK) & \
+                         ~(GNRC_PKTBUF_STATIC_ALIGN_MASK))
+#define _SLAB_BUF_SIZE  ((CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF * _SNIP_SIZE) + \
+                         (CONFIG_GNRC_PKTBUF_SLAB_16_NUMOF * 16U) + \
+                         (CONFIG_GNRC_PKTBUF_SLAB_32_NUMOF * 32U) + \
+                         (CONFIG_GNRC_PKTBUF_SLAB_64_NUMOF * 64U))
+
+typedef struct _slab_chunk {
+    struct _slab_chunk *next;
+} _slab_chunk_t;
+
+typedef struct {
+    uint8_t *start;         /**< first chunk of the class */
+    _slab_chunk_t *free;    /**< free list */
+    uint16_t size;          /**< size of a chunk */
+    uint16_t numof;         /**< number of chunks */
+    uint16_t used;          /**< number of allocated chunks */
+    uint16_t max_used;      /**< maximum of used */
+    uint32_t fails;         /**< allocations the class could not serve */
+} _slab_class_t;
+
+static_assert(_SLAB_BUF_SIZE > 0, "all gnrc_pktbuf_slab size classes are empty");
+
+static alignas(_unused_t) uint8_t _slab_buf[_SLAB_BUF_SIZE];
+static _slab_class_t _classes[GNRC_PKTBUF_SLAB_CLASSES];
+
+static _slab_class_t *_class_of_size(size_t size)
+{
+    for (unsigned i = 1; i < GNRC_PKTBUF_SLAB_CLASSES; i++) {
+        if (size <= _classes[i].size) {
+            return &_classes[i];
+        }
+    }
+    return NULL;
+}
+
+static void *_pop(_slab_class_t *cls)
+{
+    _slab_chunk_t *chunk = cls->free;
+
+    if (chunk == NULL) {
+        DEBUG("pktbuf_slab: class of size %u exhausted\n", cls->size);
+        cls->fails++;
+        return NULL;
+    }
+    cls->free = chunk->next;
+    if (++cls->used > cls->max_used) {
+        cls->max_used = cls->used;
+    }
+    return chunk;
+}
+
+static _slab_class_t *_class_of_ptr(const void *ptr)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_CLASSES; i++) {
+        _slab_class_t *cls = &_classes[i];
+
+        if (((const uint8_t *)ptr >= cls->start) &&
+            ((const uint8_t *)ptr < cls->start + (cls->size * cls->numof))) {
+            return cls;
+        }
+    }
+    return NULL;
+}
+
+void gnrc_pktbuf_slab_init(void)
+{
+    static const uint16_t numof[GNRC_PKTBUF_SLAB_CLASSES] = {
+        CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF,
+        CONFIG_GNRC_PKTBUF_SLAB_16_NUMOF,
+        CONFIG_GNRC_PKTBUF_SLAB_32_NUMOF,
+        CONFIG_GNRC_PKTBUF_SLAB_64_NUMOF,
+    };
+    uint8_t *start = _slab_buf;
+
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_CLASSES; i++) {
+        _slab_class_t *cls = &_classes[i];
+
+        cls->start = start;
+        cls->free = NULL;
+        cls->size = (i == 0) ? _SNIP_SIZE : (8U << i);
+        cls->numof = numof[i];
+        cls->used = 0;
+        cls->max_used = 0;
+        cls->fails = 0;
+        /* build free list back to front, so chunks are handed out in order */
+        for (unsigned j = cls->numof; j > 0; j--) {
+            /* chunk sizes are multiples of _unused_t's alignment, we cast
+             * to uintptr_t as intermediate step to silence -Wcast-align */
+            _slab_chunk_t *chunk = (_slab_chunk_t *)(uintptr_t)
+                                   (start + ((j - 1) * cls->size));
+
+            chunk->next = cls->free;
+            cls->free = chunk;
+        }
+        start += cls->size * cls->numof;
+    }
+}
+
+void *gnrc_pktbuf_slab_alloc(size_t size)
+{
+    _slab_class_t *cls;
+
+    size = _align(size);
+    /* snip descriptors are by far the most common allocation, so they get a
+     * class of their own, no matter their size on the platform */
+    if (size == _SNIP_SIZE) {
+        void *chunk = _pop(&_classes[0]);
+
+        if (chunk != NULL) {
+            return chunk;
+        }
+    }
+    cls = _class_of_size(size);
+    return (cls != NULL) ? _pop(cls) : NULL;
+}
+
+bool gnrc_pktbuf_slab_free(void *data)
+{
+    _slab_class_t *cls = _class_of_ptr(data);
+
+    if (cls == NULL) {
+        return false;
+    }
+    if ((((uint8_t *)data - cls->start) % cls->size) == 0) {
+        _slab_chunk_t *chunk = data;
+
+        assert(cls->used > 0);
+        chunk->next = cls->free;
+        cls->free = chunk;
+        cls->used--;
+    }
+    /* else: tail of a shrunk chunk, the chunk itself is still in use */
+    return true;
+}
+
+bool gnrc_pktbuf_slab_contains(const void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_slab_buf;
+    const uintptr_t end = start + sizeof(_slab_buf);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+void gnrc_pktbuf_slab_get_stats(unsigned cls, gnrc_pktbuf_slab_stats_t *stats)
+{
+    assert(cls < GNRC_PKTBUF_SLAB_CLASSES);
+    stats->size = _classes[cls].size;
+    stats->numof = _classes[cls].numof;
+    stats->used = _classes[cls].used;
+    stats->max_used = _classes[cls].max_used;
+    stats->fails = _classes[cls].fails;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_slab_stats(void)
+{
+    printf("size classes: %p - %p (size: %u)\n", (void *)&_slab_buf[0],
+           (void *)&_slab_buf[sizeof(_slab_buf)], (unsigned)sizeof(_slab_buf));
+    puts("  class  chunk size    used  max used  chunks  exhausted");
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_CLASSES; i++) {
+        _slab_class_t *cls = &_classes[i];
+
+        printf("  %5u  %10u  %6u  %8u  %6u  %9" PRIu32 "\n", i, cls->size,
+               cls->used, cls->max_used, cls->numof, cls->fails);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_slab_is_empty(void)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_CLASSES; i++) {
+        if (_classes[i].used != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_slab_is_sane(void)
+{
+    /* Invariants of the size classes:
+     *  - forall chunk in free list of cls: chunk is in cls and at a chunk
+     *                                      boundary of cls
+     *  - forall cls: length of free list of cls == cls->numof - cls->used
+     */
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_CLASSES; i++) {
+        _slab_class_t *cls = &_classes[i];
+        unsigned free = 0;
+
+        for (_slab_chunk_t *chunk = cls->free; chunk; chunk = chunk->next) {
+            if ((_class_of_ptr(chunk) != cls) ||
+                ((((uint8_t *)chunk - cls->start) % cls->size) != 0) ||
+                (++free > cls->numof)) {
+                return false;
+            }
+        }
+        if (free != (unsigned)(cls->numof - cls->used)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+/** @} */
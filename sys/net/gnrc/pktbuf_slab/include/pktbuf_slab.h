@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @brief   Internal definitions of the size classes of the
+ *          `gnrc_pktbuf_slab` module
+ *
+ * With `gnrc_pktbuf_slab`, packet snip descriptors and small chunks of data
+ * (i.e. most headers) are served from fixed size classes with a free list
+ * each, so their allocation and release take constant time and do not
+ * fragment the arena of the static packet buffer. Chunks not fitting into any
+ * class, or of classes that are exhausted, are allocated from the arena.
+ *
+ * All functions are expected to be called with
+ * @ref gnrc_pktbuf_mutex locked.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Size classes for the static packet buffer
+ */
+#ifndef PKTBUF_SLAB_H
+#define PKTBUF_SLAB_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of size classes
+ */
+#define GNRC_PKTBUF_SLAB_CLASSES    (4U)
+
+/**
+ * @brief   Statistics of a size class
+ */
+typedef struct {
+    uint16_t size;      /**< size of a chunk in the class */
+    uint16_t numof;     /**< number of chunks in the class */
+    uint16_t used;      /**< number of chunks currently allocated */
+    uint16_t max_used;  /**< maximum number of chunks allocated at once */
+    uint32_t fails;     /**< allocations that fell back to the arena, as
+                         *   the class was exhausted */
+} gnrc_pktbuf_slab_stats_t;
+
+/**
+ * @brief   Marks all chunks of all size classes as free
+ */
+void gnrc_pktbuf_slab_init(void);
+
+/**
+ * @brief   Allocates a chunk from the size class fitting @p size
+ *
+ * @param[in] size  Number of bytes required.
+ *
+ * @return  The chunk.
+ * @return  NULL, if @p size does not fit any size class or the class is
+ *          exhausted. The chunk should then be allocated from the arena.
+ */
+void *gnrc_pktbuf_slab_alloc(size_t size);
+
+/**
+ * @brief   Releases a chunk to its size class
+ *
+ * Pointers into a chunk that are not its start (e.g. released by shrinking
+ * the chunk with @ref gnrc_pktbuf_realloc_data()) are ignored, the chunk is
+ * released as a whole with its start pointer.
+ *
+ * @param[in] data  A pointer.
+ *
+ * @return  true, if @p data belongs to a size class.
+ * @return  false, if @p data is not in any size class.
+ */
+bool gnrc_pktbuf_slab_free(void *data);
+
+/**
+ * @brief   Checks if a pointer points into any size class
+ *
+ * @param[in] ptr   A pointer.
+ *
+ * @return  true, if @p ptr points into a chunk of a size class.
+ */
+bool gnrc_pktbuf_slab_contains(const void *ptr);
+
+/**
+ * @brief   Gets the statistics of a size class
+ *
+ * @pre `cls < GNRC_PKTBUF_SLAB_CLASSES`
+ *
+ * @param[in] cls       The size class. Class 0 holds packet snip descriptors,
+ *                      classes 1 to 3 chunks of 16, 32, and 64 bytes.
+ * @param[out] stats    The statistics of @p cls.
+ */
+void gnrc_pktbuf_slab_get_stats(unsigned cls, gnrc_pktbuf_slab_stats_t *stats);
+
+#if defined(DEVELHELP) || defined(DOXYGEN)
+/**
+ * @brief   Prints the statistics of all size classes
+ *
+ * @note    Only available with DEVELHELP defined.
+ */
+void gnrc_pktbuf_slab_stats(void);
+#endif
+
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Checks if no chunk of any size class is allocated
+ */
+bool gnrc_pktbuf_slab_is_empty(void);
+
+/**
+ * @brief   Checks the free lists of all size classes for consistency
+ */
+bool gnrc_pktbuf_slab_is_sane(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKTBUF_SLAB_H */
+/** @} */
@@ -33,6 +33,9 @@
 
 #include "pktbuf_internal.h"
 #include "pktbuf_static.h"
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+#include "pktbuf_slab.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -61,6 +64,30 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
 
+/* chunks of the size classes can only be released as a whole */
+static inline bool _in_slab(const void *ptr)
+{
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    return gnrc_pktbuf_slab_contains(ptr);
+#else
+    (void)ptr;
+    return false;
+#endif
+}
+
+/* Snips with unaligned data (see gnrc_pktbuf_add_rx() and gnrc_pktbuf_mark())
+ * own the aligned range around their data: from _ptr_align_down(data) to
+ * _ptr_align(data + size) */
+static inline uintptr_t _ptr_align_down(const void *ptr)
+{
+    return (uintptr_t)ptr & ~(GNRC_PKTBUF_STATIC_ALIGN_MASK);
+}
+
+static inline uintptr_t _ptr_align(const void *ptr)
+{
+    return _align((uintptr_t)ptr);
+}
+
 static const void *mem_is_set(const void *data, uint8_t c, size_t len)
 {
     const uint8_t *end = (uint8_t *)data + len;
@@ -97,6 +124,9 @@ void gnrc_pktbuf_init(void)
     _first_unused = (_unused_t *)(uintptr_t)_static_buf;
     _first_unused->next = NULL;
     _first_unused->size = sizeof(_static_buf);
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    gnrc_pktbuf_slab_init();
+#endif
     mutex_unlock(&gnrc_pktbuf_mutex);
 }
 
@@ -116,11 +146,34 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     return pkt;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_add_rx(size_t size, size_t hdr_len,
+                                   gnrc_nettype_t type)
+{
+    /* padding in front of the frame so that the data behind the link layer
+     * header starts at a chunk boundary */
+    size_t pad = _align(hdr_len) - hdr_len;
+    gnrc_pktsnip_t *pkt;
+
+    assert(size > 0);
+    if ((size + pad) > CONFIG_GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)(size + pad), CONFIG_GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(NULL, NULL, size + pad, type);
+    if ((pkt != NULL) && (pad > 0)) {
+        /* freeing pkt->data releases the padding as well */
+        pkt->data = ((uint8_t *)pkt->data) + pad;
+        pkt->size = size;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
-    /* size required for chunk */
-    size_t required_new_size = _align(size);
     void *new_data_marked;
 
     mutex_lock(&gnrc_pktbuf_mutex);
@@ -139,9 +192,13 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         mutex_unlock(&gnrc_pktbuf_mutex);
         return NULL;
     }
-    /* marked data would not fit _unused_t marker => move data around to allow
-     * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
+    new_data_marked = pkt->data;
+    if (pkt->size == size) {
+        pkt->data = NULL;
+    }
+    else if (_in_slab(pkt->data)) {
+        /* size class chunks can't be split => move data around to allow for
+         * proper free */
         void *new_data_rest;
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
@@ -161,14 +218,32 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         memcpy(new_data_marked, pkt->data, size);
         memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
-        marked_snip->data = new_data_marked;
         pkt->data = new_data_rest;
     }
+    else if (_ptr_align_down((uint8_t *)pkt->data + size) !=
+             (uintptr_t)pkt->data + size) {
+        /* marked data would not end at a chunk boundary => only move the
+         * marked data and give its share of the chunk back, the remainder
+         * stays in place */
+        uintptr_t start = _ptr_align_down(pkt->data);
+        uintptr_t end = _ptr_align_down((uint8_t *)pkt->data + size);
+
+        new_data_marked = _pktbuf_alloc(size);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        if (end > start) {
+            gnrc_pktbuf_free_internal((void *)start, end - start);
+        }
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
     else {
-        new_data_marked = pkt->data;
-        /* if (pkt->size - size) != 0 take remainder of data, otherwise set NULL */
-        pkt->data = (pkt->size != size) ? (((uint8_t *)pkt->data) + size) :
-                                          NULL;
+        /* split chunk in place */
+        pkt->data = ((uint8_t *)pkt->data) + size;
     }
     pkt->size -= size;
     _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
@@ -179,8 +254,6 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
-    size_t aligned_size = _align(size);
-
     mutex_lock(&gnrc_pktbuf_mutex);
     assert(pkt != NULL);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
@@ -211,9 +284,13 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
-        gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + aligned_size,
-                     pkt->size - aligned_size);
+    else {
+        uintptr_t old_end = _ptr_align((uint8_t *)pkt->data + pkt->size);
+        uintptr_t new_end = _ptr_align((uint8_t *)pkt->data + size);
+
+        if (old_end > new_end) {
+            gnrc_pktbuf_free_internal((void *)new_end, old_end - new_end);
+        }
     }
     pkt->size = size;
     mutex_unlock(&gnrc_pktbuf_mutex);
@@ -281,6 +358,9 @@ static inline void _print_unused(_unused_t *ptr)
 
 void gnrc_pktbuf_stats(void)
 {
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    gnrc_pktbuf_slab_stats();
+#endif
 #ifdef MODULE_OD
     _unused_t *ptr = _first_unused;
     uint8_t *chunk = &_static_buf[0];
@@ -326,6 +406,11 @@ void gnrc_pktbuf_stats(void)
 #ifdef TEST_SUITES
 bool gnrc_pktbuf_is_empty(void)
 {
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    if (!gnrc_pktbuf_slab_is_empty()) {
+        return false;
+    }
+#endif
     return ((uintptr_t)_first_unused == (uintptr_t)_static_buf) &&
            (_first_unused->size == sizeof(_static_buf));
 }
@@ -334,6 +419,11 @@ bool gnrc_pktbuf_is_sane(void)
 {
     _unused_t *ptr = _first_unused;
 
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    if (!gnrc_pktbuf_slab_is_sane()) {
+        return false;
+    }
+#endif
     /* Invariants of this implementation:
      *  - the head of _unused_t list is _first_unused
      *  - if _unused_t list is empty the packet buffer is full and _first_unused is NULL
@@ -394,6 +484,12 @@ static void *_pktbuf_alloc(size_t size)
 {
     _unused_t *prev = NULL, *ptr = _first_unused;
 
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    void *chunk = gnrc_pktbuf_slab_alloc(size);
+    if (chunk != NULL) {
+        return chunk;
+    }
+#endif
     size = _align(size);
     while (ptr && (size > ptr->size)) {
         prev = ptr;
@@ -472,11 +568,21 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
 void gnrc_pktbuf_free_internal(void *data, size_t size)
 {
     size_t bytes_at_end;
-    _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
+    _unused_t *new, *prev = NULL, *ptr = _first_unused;
 
+    /* release the whole aligned range owned by data */
+    size = _ptr_align((uint8_t *)data + size) - _ptr_align_down(data);
+    data = (void *)_ptr_align_down(data);
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    if (gnrc_pktbuf_slab_free(data)) {
+        return;
+    }
+#endif
     if (!gnrc_pktbuf_contains(data)) {
         return;
     }
+    /* We cast to uintptr_t as intermediate step to silence -Wcast-align */
+    new = (_unused_t *)(uintptr_t)data;
 
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         memset(data, CANARY, _align(size));
@@ -516,7 +622,7 @@ bool gnrc_pktbuf_contains(void *ptr)
     const uintptr_t start = (uintptr_t)_static_buf;
     const uintptr_t end = start + sizeof(_static_buf);
     uintptr_t pos = (uintptr_t)ptr;
-    return ((pos >= start) && (pos < end));
+    return ((pos >= start) && (pos < end)) || _in_slab(ptr);
 }
 
 /** @} */
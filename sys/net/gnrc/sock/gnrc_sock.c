@@ -94,28 +94,12 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
     gnrc_netreg_register(type, &reg->entry);
 }
 
-ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
-                       uint32_t timeout, sock_ip_ep_t *remote,
-                       gnrc_sock_recv_aux_t *aux)
+/* waits up to @p timeout for a packet at @p reg */
+static int _recv_pkt(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt,
+                     uint32_t timeout)
 {
-    /* only used when some sock_aux_% module is used */
-    (void)aux;
-    gnrc_pktsnip_t *pkt, *netif;
     msg_t msg;
 
-    /* The fuzzing module is only enabled when building a fuzzing
-     * application from the fuzzing/ subdirectory. When using gnrc_sock
-     * the fuzzer assumes that gnrc_sock_recv is called in a loop. If it
-     * is called again and the previous return value was the special
-     * crafted fuzzing packet, the fuzzing application terminates.
-     *
-     * sock_async_event has its on fuzzing termination condition. */
-#if defined(MODULE_FUZZING) && !defined(MODULE_SOCK_ASYNC_EVENT)
-    if (gnrc_sock_prevpkt && gnrc_sock_prevpkt == gnrc_pktbuf_fuzzptr) {
-        exit(EXIT_SUCCESS);
-    }
-#endif
-
     if (mbox_size(&reg->mbox) != GNRC_SOCK_MBOX_SIZE) {
         return -EINVAL;
     }
@@ -164,8 +148,8 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
 #endif
     switch (msg.type) {
         case GNRC_NETAPI_MSG_TYPE_RCV:
-            pkt = msg.content.ptr;
-            break;
+            *pkt = msg.content.ptr;
+            return 0;
 #if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER_USEC)
         case _TIMEOUT_MSG_TYPE:
             if (msg.content.value == _TIMEOUT_MAGIC) {
@@ -176,6 +160,30 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         default:
             return -EINVAL;
     }
+}
+
+/* takes a packet already queued at @p reg */
+static bool _try_recv_pkt(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt)
+{
+    msg_t msg;
+
+    while (mbox_try_get(&reg->mbox, &msg)) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            *pkt = msg.content.ptr;
+            return true;
+        }
+        /* drop timeout messages left over by a previous call */
+    }
+    return false;
+}
+
+void gnrc_sock_recv_ep(gnrc_pktsnip_t *pkt, sock_ip_ep_t *remote,
+                       gnrc_sock_recv_aux_t *aux)
+{
+    /* only used when some sock_aux_% module is used */
+    (void)aux;
+    gnrc_pktsnip_t *netif;
+
     /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
      * was implemented */
     ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
@@ -210,6 +218,32 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         }
 #endif /* MODULE_SOCK_AUX_RSSI */
     }
+}
+
+ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
+                       uint32_t timeout, sock_ip_ep_t *remote,
+                       gnrc_sock_recv_aux_t *aux)
+{
+    gnrc_pktsnip_t *pkt;
+    int res;
+
+    /* The fuzzing module is only enabled when building a fuzzing
+     * application from the fuzzing/ subdirectory. When using gnrc_sock
+     * the fuzzer assumes that gnrc_sock_recv is called in a loop. If it
+     * is called again and the previous return value was the special
+     * crafted fuzzing packet, the fuzzing application terminates.
+     *
+     * sock_async_event has its on fuzzing termination condition. */
+#if defined(MODULE_FUZZING) && !defined(MODULE_SOCK_ASYNC_EVENT)
+    if (gnrc_sock_prevpkt && gnrc_sock_prevpkt == gnrc_pktbuf_fuzzptr) {
+        exit(EXIT_SUCCESS);
+    }
+#endif
+
+    if ((res = _recv_pkt(reg, &pkt, timeout)) < 0) {
+        return res;
+    }
+    gnrc_sock_recv_ep(pkt, remote, aux);
     *pkt_out = pkt; /* set out parameter */
 
 #if IS_ACTIVE(SOCK_HAS_ASYNC)
@@ -224,55 +258,65 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+int gnrc_sock_recv_batch(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkts,
+                         unsigned numof, uint32_t timeout)
 {
-    gnrc_pktsnip_t *pkt;
-    kernel_pid_t iface = KERNEL_PID_UNDEF;
-    gnrc_nettype_t type;
-    size_t payload_len = gnrc_pkt_len(payload);
-#ifdef MODULE_GNRC_NETERR
-    unsigned status_subs = 0;
-#endif
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    gnrc_tx_sync_t tx_sync;
+    unsigned i = 0;
+    int res;
+
+    assert(numof > 0);
+    if ((res = _recv_pkt(reg, &pkts[i++], timeout)) < 0) {
+        return res;
+    }
+    /* the rest of a burst is already queued */
+    while ((i < numof) && _try_recv_pkt(reg, &pkts[i])) {
+        i++;
+    }
+#if IS_ACTIVE(SOCK_HAS_ASYNC)
+    if (reg->async_cb.generic && mbox_avail(&reg->mbox)) {
+        reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
+    }
 #endif
+    return i;
+}
+
+int gnrc_sock_pkt_build(gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                        const sock_ip_ep_t *remote, uint8_t nh,
+                        gnrc_nettype_t *type)
+{
+    gnrc_pktsnip_t *payload = *pkt;
+    kernel_pid_t iface = KERNEL_PID_UNDEF;
 
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
         return -EAFNOSUPPORT;
     }
 
-#if IS_USED(MODULE_GNRC_TX_SYNC)
-    if (gnrc_tx_sync_append(payload, &tx_sync)) {
-        gnrc_pktbuf_release(payload);
-        return -ENOMEM;
-    }
-#endif
-
     switch (local->family) {
 #ifdef SOCK_HAS_IPV6
         case AF_INET6: {
             ipv6_hdr_t *hdr;
-            pkt = gnrc_ipv6_hdr_build(payload, (ipv6_addr_t *)&local->addr.ipv6,
-                                      (ipv6_addr_t *)&remote->addr.ipv6);
-            if (pkt == NULL) {
+            *pkt = gnrc_ipv6_hdr_build(payload,
+                                       (ipv6_addr_t *)&local->addr.ipv6,
+                                       (ipv6_addr_t *)&remote->addr.ipv6);
+            if (*pkt == NULL) {
                 return -ENOMEM;
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
                 payload->type = GNRC_NETTYPE_IPV6;
-                type = GNRC_NETTYPE_IPV6;
+                *type = GNRC_NETTYPE_IPV6;
             }
             else {
-                type = payload->type;
+                *type = payload->type;
             }
-            hdr = pkt->data;
+            hdr = (*pkt)->data;
             hdr->nh = nh;
             break;
         }
 #endif
         default:
             (void)nh;
+            (void)type;
             gnrc_pktbuf_release(payload);
             return -EAFNOSUPPORT;
     }
@@ -289,17 +333,39 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         gnrc_netif_hdr_t *netif_hdr;
 
         if (netif == NULL) {
-            gnrc_pktbuf_release(pkt);
+            gnrc_pktbuf_release(*pkt);
             return -ENOMEM;
         }
         netif_hdr = netif->data;
         netif_hdr->if_pid = iface;
-        pkt = gnrc_pkt_prepend(pkt, netif);
+        *pkt = gnrc_pkt_prepend(*pkt, netif);
+    }
+    return 0;
+}
+
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt = payload;
+    gnrc_nettype_t type;
+    size_t payload_len = gnrc_pkt_len(payload);
+    int res;
+#ifdef MODULE_GNRC_NETERR
+    unsigned status_subs = 0;
+#endif
+#if IS_USED(MODULE_GNRC_TX_SYNC)
+    gnrc_tx_sync_t tx_sync;
+
+    if (gnrc_tx_sync_append(payload, &tx_sync)) {
+        gnrc_pktbuf_release(payload);
+        return -ENOMEM;
+    }
+#endif
+
+    if ((res = gnrc_sock_pkt_build(&pkt, local, remote, nh, &type)) < 0) {
+        return res;
     }
 #ifdef MODULE_GNRC_NETERR
-    /* cppcheck-suppress uninitvar
-     * (reason: pkt is initialized in AF_INET6 case above, otherwise function
-     * will return early) */
     for (gnrc_pktsnip_t *ptr = pkt; ptr != NULL; ptr = ptr->next) {
         /* no error should occur since pkt was created here */
         gnrc_neterr_reg(ptr);
@@ -350,4 +416,20 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     return payload_len;
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH)
+int gnrc_sock_send_batch(gnrc_nettype_t type, gnrc_pktsnip_t *const *pkts,
+                         unsigned numof)
+{
+    if (!gnrc_netapi_dispatch_batch(type, GNRC_NETREG_DEMUX_CTX_ALL,
+                                    GNRC_NETAPI_MSG_TYPE_SND, pkts, numof)) {
+        /* this should not happen, but just in case */
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        return -EBADMSG;
+    }
+    return 0;
+}
+#endif
+
 /** @} */
@@ -150,12 +150,74 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux);
 
+/**
+ * @brief   Receive a burst of packets internally
+ *
+ * Waits up to @p timeout for the first packet, then takes the packets already
+ * queued at @p reg without waiting. Use @ref gnrc_sock_recv_ep() to get the
+ * end points of each packet.
+ *
+ * @return  number of packets in @p pkts, at most @p numof
+ * @return  the errors of @ref gnrc_sock_recv() for the first packet
+ * @internal
+ */
+int gnrc_sock_recv_batch(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkts,
+                         unsigned numof, uint32_t timeout);
+
+/**
+ * @brief   Get the remote end point and auxiliary data of a received packet
+ * @internal
+ */
+void gnrc_sock_recv_ep(gnrc_pktsnip_t *pkt, sock_ip_ep_t *remote,
+                       gnrc_sock_recv_aux_t *aux);
+
+/**
+ * @brief   Build the network layer headers of a packet to send internally
+ *
+ * @param[in,out] pkt   the payload, set to the packet to send on success.
+ *                      Released on error, unless the error is -ENOMEM from
+ *                      building the IP header.
+ * @param[in] local     local end point
+ * @param[in] remote    remote end point
+ * @param[in] nh        next header number for the IP header
+ * @param[out] type     the type to dispatch the packet to
+ *
+ * @return  0 on success
+ * @return  -EAFNOSUPPORT, if the address families are not supported
+ * @return  -ENOMEM, if there is no space in the packet buffer
+ * @internal
+ */
+int gnrc_sock_pkt_build(gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                        const sock_ip_ep_t *remote, uint8_t nh,
+                        gnrc_nettype_t *type);
+
 /**
  * @brief   Send a packet internally
  * @internal
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Send packets built by @ref gnrc_sock_pkt_build() in one message
+ *
+ * Other than @ref gnrc_sock_send(), this does not wait for the packets to be
+ * sent, so it does not report errors of lower layers.
+ *
+ * @pre `numof <= CONFIG_GNRC_NETAPI_BATCH_SIZE`
+ *
+ * @param[in] type  type of all @p pkts, see @ref gnrc_sock_pkt_build()
+ * @param[in] pkts  the packets
+ * @param[in] numof number of packets in @p pkts
+ *
+ * @return  0 on success
+ * @return  -EBADMSG, if there is no one to send the packets to
+ * @internal
+ */
+int gnrc_sock_send_batch(gnrc_nettype_t type, gnrc_pktsnip_t *const *pkts,
+                         unsigned numof);
+#endif
 /** @internal
  * @}
  */
@@ -20,6 +20,8 @@
 #include <string.h>
 
 #include "byteorder.h"
+#include "container.h"
+#include "macros/utils.h"
 #include "net/af.h"
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
@@ -237,13 +239,34 @@ static bool _accept_remote(const sock_udp_t *sock, const udp_hdr_t *hdr,
     return true;
 }
 
+/* checks the remote of a packet received at @p sock and releases it, if the
+ * sock does not accept it */
+static int _check_pkt(const sock_udp_t *sock, gnrc_pktsnip_t *pkt,
+                      const sock_ip_ep_t *tmp, sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    udp_hdr_t *hdr;
+
+    assert(udp);
+    hdr = udp->data;
+    if (remote != NULL) {
+        /* return remote to possibly block if wrong remote */
+        memcpy(remote, tmp, sizeof(*tmp));
+        remote->port = byteorder_ntohs(hdr->src_port);
+    }
+    if (!_accept_remote(sock, hdr, tmp)) {
+        gnrc_pktbuf_release(pkt);
+        return -EPROTO;
+    }
+    return 0;
+}
+
 ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
                               uint32_t timeout, sock_udp_ep_t *remote,
                               sock_udp_aux_rx_t *aux)
 {
     (void)aux;
-    gnrc_pktsnip_t *pkt, *udp;
-    udp_hdr_t *hdr;
+    gnrc_pktsnip_t *pkt;
     sock_ip_ep_t tmp;
     int res;
     gnrc_sock_recv_aux_t _aux = { 0 };
@@ -278,17 +301,8 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     if (res < 0) {
         return res;
     }
-    udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
-    assert(udp);
-    hdr = udp->data;
-    if (remote != NULL) {
-        /* return remote to possibly block if wrong remote */
-        memcpy(remote, &tmp, sizeof(tmp));
-        remote->port = byteorder_ntohs(hdr->src_port);
-    }
-    if (!_accept_remote(sock, hdr, &tmp)) {
-        gnrc_pktbuf_release(pkt);
-        return -EPROTO;
+    if ((res = _check_pkt(sock, pkt, &tmp, remote)) < 0) {
+        return res;
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     if ((aux != NULL) && (aux->flags & SOCK_AUX_GET_LOCAL)) {
@@ -312,17 +326,57 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
-                           const iolist_t *snips,
-                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned numof,
+                        uint32_t timeout)
+{
+    /* no more datagrams can be queued at the sock */
+    gnrc_pktsnip_t *pkts[GNRC_SOCK_MBOX_SIZE];
+    unsigned received = 0;
+    int res, err = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (numof > 0));
+    if (sock->local.family == AF_UNSPEC) {
+        return -EADDRNOTAVAIL;
+    }
+    res = gnrc_sock_recv_batch((gnrc_sock_reg_t *)sock, pkts,
+                               MIN(numof, ARRAY_SIZE(pkts)), timeout);
+    if (res < 0) {
+        return res;
+    }
+    for (int i = 0; i < res; i++) {
+        sock_udp_msg_t *msg = &msgs[received];
+        gnrc_sock_recv_aux_t aux = { 0 };
+        sock_ip_ep_t tmp;
+        int pkt_res;
+
+        gnrc_sock_recv_ep(pkts[i], &tmp, &aux);
+        if ((pkt_res = _check_pkt(sock, pkts[i], &tmp, msg->remote)) == 0) {
+            if (pkts[i]->size > msg->len) {
+                pkt_res = -ENOBUFS;
+            }
+            else {
+                memcpy(msg->data, pkts[i]->data, pkts[i]->size);
+                msg->len = pkts[i]->size;
+                received++;
+            }
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        if ((pkt_res < 0) && (err == 0)) {
+            err = pkt_res;
+        }
+    }
+    return (received > 0) ? (int)received : err;
+}
+
+/* builds the UDP packet of a datagram and the end points to send it with */
+static int _udp_pkt_build(sock_udp_t *sock, const iolist_t *snips,
+                          const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                          gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                          sock_ip_ep_t *rem)
 {
     (void)aux;
-    int res;
-    gnrc_pktsnip_t *pkt, *payload = NULL;
+    gnrc_pktsnip_t *payload = NULL;
     uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
 
     assert((sock != NULL) || (remote != NULL));
 
@@ -351,7 +405,7 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
+        memset(local, 0, sizeof(*local));
         if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
@@ -377,33 +431,32 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     }
     else {
         src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        memcpy(local, &sock->local, sizeof(*local));
     }
 #if IS_USED(MODULE_SOCK_AUX_LOCAL)
     /* user supplied local endpoint takes precedent */
     if ((aux != NULL) && (aux->flags & SOCK_AUX_SET_LOCAL)) {
-        local.family = aux->local.family;
-        local.netif = aux->local.netif;
-        memcpy(&local.addr, &aux->local.addr, sizeof(local.addr));
+        local->family = aux->local.family;
+        local->netif = aux->local.netif;
+        memcpy(&local->addr, &aux->local.addr, sizeof(local->addr));
 
         aux->flags &= ~SOCK_AUX_SET_LOCAL;
     }
 #endif
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
+        memcpy(rem, &sock->remote, sizeof(*rem));
         dst_port = sock->remote.port;
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
+        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(*rem));
         dst_port = remote->port;
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
 
@@ -416,12 +469,27 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     /* copy payload data into payload snip */
     iolist_to_buffer(snips, payload->data, payload->size);
 
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
-    if (pkt == NULL) {
+    *pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    if (*pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    return 0;
+}
+
+ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
+                           const iolist_t *snips,
+                           const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    int res;
+    gnrc_pktsnip_t *pkt;
+    sock_ip_ep_t local, rem;
+
+    if ((res = _udp_pkt_build(sock, snips, remote, aux, &pkt, &local,
+                              &rem)) < 0) {
+        return res;
+    }
+    res = gnrc_sock_send(pkt, &local, &rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
@@ -434,6 +502,82 @@ ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_NETERR) && \
+    !IS_USED(MODULE_GNRC_TX_SYNC)
+/* sends the datagrams built so far in one message */
+static int _flush(gnrc_nettype_t type, gnrc_pktsnip_t *const *pkts,
+                  unsigned *built, unsigned *sent)
+{
+    int res = gnrc_sock_send_batch(type, pkts, *built);
+
+    if (res == 0) {
+        *sent += *built;
+    }
+    *built = 0;
+    return res;
+}
+#endif
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned numof)
+{
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_NETERR) && \
+    !IS_USED(MODULE_GNRC_TX_SYNC)
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETAPI_BATCH_SIZE];
+    gnrc_nettype_t type = GNRC_NETTYPE_UNDEF;
+    unsigned built = 0;
+#endif
+    unsigned sent = 0;
+    int res = 0;
+
+    assert((msgs != NULL) && (numof > 0));
+    for (unsigned i = 0; (i < numof) && (res == 0); i++) {
+        iolist_t snip = { .iol_base = msgs[i].data, .iol_len = msgs[i].len };
+        sock_ip_ep_t local, rem;
+        gnrc_pktsnip_t *pkt;
+
+        if ((res = _udp_pkt_build(sock, &snip, msgs[i].remote, NULL, &pkt,
+                                  &local, &rem)) < 0) {
+            break;
+        }
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_NETERR) && \
+    !IS_USED(MODULE_GNRC_TX_SYNC)
+        if ((res = gnrc_sock_pkt_build(&pkt, &local, &rem, PROTNUM_UDP,
+                                       &type)) < 0) {
+            break;
+        }
+        pkts[built++] = pkt;
+        if (built == ARRAY_SIZE(pkts)) {
+            res = _flush(type, pkts, &built, &sent);
+        }
+#else
+        /* neterr and tx_sync wait for the status of each datagram */
+        if ((res = gnrc_sock_send(pkt, &local, &rem, PROTNUM_UDP)) >= 0) {
+            res = 0;
+            sent++;
+        }
+#endif
+    }
+#if IS_USED(MODULE_GNRC_NETAPI_BATCH) && !IS_USED(MODULE_GNRC_NETERR) && \
+    !IS_USED(MODULE_GNRC_TX_SYNC)
+    if (built > 0) {
+        /* also send the datagrams built before an error */
+        int flush_res = _flush(type, pkts, &built, &sent);
+
+        if (res == 0) {
+            res = flush_res;
+        }
+    }
+#endif
+#ifdef SOCK_HAS_ASYNC
+    if ((sent > 0) && (sock != NULL) && (sock->reg.async_cb.udp)) {
+        sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
+                               sock->reg.async_cb_arg);
+    }
+#endif  /* SOCK_HAS_ASYNC */
+    return (sent > 0) ? (int)sent : res;
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/congure.h
+ * @}
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "clist.h"
+#include "evtimer.h"
+#include "kernel_defines.h"
+#include "congure/reno.h"
+#if IS_USED(MODULE_CONGURE_ABE)
+#include "congure/abe.h"
+#endif
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+#include "include/gnrc_tcp_fsm.h"
+#include "include/gnrc_tcp_pkt.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief Number of duplicate ACKs that trigger fast retransmit (RFC 5681).
+ */
+#define FAST_RETRANSMIT_THRESHOLD (3U)
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _fr_cwnd_dec(congure_reno_snd_t *c);
+
+/**
+ * @brief Reno constants, bounds of the initial window from RFC 3390.
+ */
+#define RENO_CONSTS {                                   \
+        .fr = _fr,                                      \
+        .same_wnd_adv = _same_wnd_adv,                  \
+        .fr_cwnd_dec = _fr_cwnd_dec,                    \
+        .init_mss = CONFIG_GNRC_TCP_MSS,                \
+        .cwnd_upper = 2190,                             \
+        .cwnd_lower = 1095,                             \
+        .init_ssthresh = CONGURE_WND_SIZE_MAX,          \
+        .frthresh = FAST_RETRANSMIT_THRESHOLD,          \
+}
+
+#if IS_USED(MODULE_CONGURE_ABE)
+static const congure_abe_snd_consts_t _consts = {
+    .reno = RENO_CONSTS,
+    .abe_multiplier_numerator = CONFIG_CONGURE_ABE_MULTIPLIER_NUMERATOR_DEFAULT,
+    .abe_multiplier_denominator = CONFIG_CONGURE_ABE_MULTIPLIER_DENOMINATOR_DEFAULT,
+};
+#else
+static const congure_reno_snd_consts_t _consts = RENO_CONSTS;
+#endif
+
+/**
+ * @brief Checks if the connection is synchronized, i.e. congestion
+ *        control was initialized.
+ */
+static inline bool _synchronized(const gnrc_tcp_tcb_t *tcb)
+{
+    /* All states after FSM_STATE_SYN_RCVD follow FSM_STATE_ESTABLISHED */
+    return tcb->state > FSM_STATE_SYN_RCVD;
+}
+
+/**
+ * @brief Fast retransmit: Retransmit the first segment.
+ *
+ * Reno calls this on every duplicate ACK past the threshold, the segment
+ * is retransmitted on the first one only.
+ */
+static void _fr(congure_reno_snd_t *c)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    if (c->dup_acks == c->consts->frthresh) {
+        tcb->snd_recover = tcb->snd_nxt;
+        _gnrc_tcp_pkt_retransmit(tcb, false);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    return ack->wnd == tcb->snd_wnd;
+}
+
+/**
+ * @brief Enter fast recovery and inflate the window on further duplicate
+ *        ACKs, see RFC 5681, section 3.2.
+ */
+static void _fr_cwnd_dec(congure_reno_snd_t *c)
+{
+    if (c->dup_acks == c->consts->frthresh) {
+        c->ssthresh = ((c->in_flight_size / 2) > (c->mss * 2))
+                      ? (c->in_flight_size / 2) : (c->mss * 2);
+        c->super.cwnd = c->ssthresh + (3 * c->mss);
+    }
+    else if (c->super.cwnd <= (CONGURE_WND_SIZE_MAX - c->mss)) {
+        c->super.cwnd += c->mss;
+    }
+}
+
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    congure_reno_snd_t *c = &tcb->cong;
+    uint16_t mss = (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+
+#if IS_USED(MODULE_CONGURE_ABE)
+    congure_abe_snd_setup(c, &_consts);
+#else
+    congure_reno_snd_setup(c, &_consts);
+#endif
+    c->super.driver->init(&c->super, tcb);
+    if (mss > 0) {
+        congure_reno_set_mss(c, mss);
+    }
+    c->in_flight_size = 0;
+    c->last_ack = tcb->snd_una;
+    tcb->snd_recover = tcb->snd_una;
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    return _synchronized(tcb) ? tcb->cong.super.cwnd : CONGURE_WND_SIZE_MAX;
+}
+
+void _gnrc_tcp_congure_sent(gnrc_tcp_tcb_t *tcb, unsigned size)
+{
+    TCP_DEBUG_ENTER;
+    if (_synchronized(tcb)) {
+        tcb->cong.super.driver->report_msg_sent(&tcb->cong.super, size);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_acked(gnrc_tcp_tcb_t *tcb, uint32_t seg_ack,
+                             uint16_t seg_wnd, uint32_t pay_len, uint16_t ctl,
+                             uint32_t acked)
+{
+    TCP_DEBUG_ENTER;
+    congure_reno_snd_t *c = &tcb->cong;
+
+    if (!_synchronized(tcb)) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    bool recovery = (c->dup_acks >= c->consts->frthresh);
+    congure_wnd_size_t cwnd = c->super.cwnd;
+    congure_snd_msg_t msg = { 0 };
+    congure_snd_ack_t ack = {
+        .recv_time = evtimer_now_msec(),
+        .id = seg_ack,
+        .size = pay_len,
+        .wnd = seg_wnd,
+        .clean = !(ctl & (MSK_SYN | MSK_FIN)),
+    };
+
+    /* Segments that timed out are no longer accounted as in flight */
+    msg.size = (acked < c->in_flight_size) ? acked : c->in_flight_size;
+    c->super.driver->report_msg_acked(&c->super, &msg, &ack);
+
+    if (acked == 0) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+    if (recovery) {
+        /* Leave fast recovery: Deflate the window, see RFC 5681, section 3.2 */
+        c->super.cwnd = c->ssthresh;
+    }
+    else if (c->super.cwnd < cwnd) {
+        /* Reno grows the window without bound, saturate it */
+        c->super.cwnd = CONGURE_WND_SIZE_MAX;
+    }
+    /* Partial ACK: The next segment sent before the loss was lost as well */
+    if (LSS_32_BIT(tcb->snd_una, tcb->snd_recover)) {
+        _gnrc_tcp_pkt_retransmit(tcb, false);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_congure_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    congure_snd_msg_t msgs = { 0 };
+
+    if (!_synchronized(tcb) || tcb->rtx_len == 0) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    /* Report all segments in flight */
+    for (unsigned i = 0; i < tcb->rtx_len; ++i) {
+        gnrc_tcp_rtx_seg_t *seg = &tcb->rtx[(tcb->rtx_first + i) % ARRAY_SIZE(tcb->rtx)];
+
+        clist_rpush(&msgs.super, &seg->msg.super);
+    }
+    tcb->cong.super.driver->report_msgs_timeout(&tcb->cong.super, &msgs);
+    /* A timeout ends fast recovery, the window restarts with slow start */
+    tcb->cong.dup_acks = 0;
+    tcb->snd_recover = tcb->snd_nxt;
+    TCP_DEBUG_LEAVE;
+}
@@ -25,7 +25,9 @@
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
+#include "include/gnrc_tcp_ooo.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -92,11 +94,7 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-    }
+    _gnrc_tcp_pkt_clear_retransmit(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -151,6 +149,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Clear retransmit queue */
             _clear_retransmit(tcb);
 
+            /* Drop segments received out of order, SACK is negotiated again */
+            _gnrc_tcp_ooo_clear(tcb);
+            tcb->status &= ~(STATUS_SACK_PERMITTED);
+
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
             {
@@ -232,6 +234,9 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_ESTABLISHED:
+            /* Connection is synchronized, start congestion control */
+            _gnrc_tcp_congure_init(tcb);
+            /* fall-through */
         case FSM_STATE_CLOSE_WAIT:
             /* Stop timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
@@ -298,7 +303,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN, tcb->iss, 0,
                             NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
     TCP_DEBUG_LEAVE;
@@ -317,27 +322,43 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    size_t mss = (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+    uint32_t wnd = _gnrc_tcp_congure_get_wnd(tcb);
+
+    /* Usable window: the smaller one of send window and congestion window */
+    wnd = (wnd < tcb->snd_wnd) ? wnd : tcb->snd_wnd;
+
+    /* Send segments while the window is open and the retransmission queue has room */
+    while (sent < len && tcb->rtx_len < CONFIG_GNRC_TCP_RTX_QUEUE_SIZE) {
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+        if (flight >= wnd) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t payload = wnd - flight;
+        payload = (payload < mss) ? payload : mss;
+        payload = (payload < len - sent) ? payload : len - sent;
+
+        /* Don't send small segments while data is in flight (Sender SWS avoidance) */
+        if (payload == 0 || (flight > 0 && payload < mss && payload < len - sent)) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt, (uint8_t *)buf + sent,
+                                payload) < 0) {
+            break;
+        }
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -395,7 +416,7 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
                             tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
 
@@ -577,7 +598,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
                                 tcb->rcv_nxt, NULL, 0);
-            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
             _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
             _transition_to(tcb, FSM_STATE_SYN_RCVD);
         }
@@ -639,7 +660,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             else {
                 _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK,
                                     tcb->iss, tcb->rcv_nxt, NULL, 0);
-                _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+                _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
                 _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
                 _transition_to(tcb, FSM_STATE_SYN_RCVD);
             }
@@ -652,8 +673,9 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     }
     /* Handle other states */
     else {
-        uint32_t seg_len = _gnrc_tcp_pkt_get_seg_len(in_pkt);
         uint32_t pay_len = _gnrc_tcp_pkt_get_pay_len(in_pkt);
+        bool fin = (ctl & MSK_FIN);     /* FIN received, in this or a queued segment */
+        uint32_t fin_seq = seg_seq + pay_len;   /* Sequence number of the FIN */
         /* 1) Verify sequence number ... */
         if (_gnrc_tcp_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
             /* ... if invalid, and RST not set, reply with pure ACK, return */
@@ -712,8 +734,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _gnrc_tcp_congure_acked(tcb, seg_ack, seg_wnd, pay_len, ctl, acked);
+                }
+                /* Data in flight and ACK does not advance: Possibly a duplicate ACK */
+                else if (seg_ack == tcb->snd_una && tcb->rtx_len > 0) {
+                    _gnrc_tcp_congure_acked(tcb, seg_ack, seg_wnd, pay_len, ctl, 0);
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +766,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -775,36 +803,71 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Search for begin of payload */
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
+                /* Data continues at rcv_nxt: Skip data that was received before */
+                if (LEQ_32_BIT(seg_seq, tcb->rcv_nxt)) {
+                    uint32_t rcv_nxt = tcb->rcv_nxt;
+                    uint32_t skip = tcb->rcv_nxt - seg_seq;
+
                     /* Copy contents into receive buffer */
                     while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
+                        if (skip < snp->size) {
+                            uint32_t len = snp->size - skip;
+                            uint32_t n = ringbuffer_add(&(tcb->rcv_buf),
+                                                        (char *)snp->data + skip, len);
+                            tcb->rcv_nxt += n;
+                            skip = 0;
+                            /* Receive buffer is full */
+                            if (n < len) {
+                                break;
+                            }
+                        }
+                        else {
+                            skip -= snp->size;
+                        }
                         snp = snp->next;
                     }
+                    /* Continue with data that was received out of order */
+                    bool ooo_fin;
+                    _gnrc_tcp_ooo_merge(tcb, &ooo_fin);
+                    if (ooo_fin) {
+                        fin = true;
+                        fin_seq = tcb->rcv_nxt;
+                    }
+
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
-                    tcb->status |= STATUS_NOTIFY_USER;
+                    if (tcb->rcv_nxt != rcv_nxt) {
+                        tcb->status |= STATUS_NOTIFY_USER;
+                    }
+                }
+                /* Data ahead of rcv_nxt: Keep it until the gap is filled */
+                else {
+                    _gnrc_tcp_ooo_add(tcb, seg_seq, snp, pay_len, (ctl & MSK_FIN));
                 }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!fin) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
                 }
             }
         }
-        /* 7) Check FIN */
-        if (ctl & MSK_FIN) {
+        /* 7) Check FIN: Ignore it until all data before it was received */
+        if (fin && LSS_32_BIT(tcb->rcv_nxt, fin_seq)) {
+            _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                tcb->rcv_nxt, NULL, 0);
+            _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        }
+        else if (fin) {
             if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_LISTEN ||
                 tcb->state == FSM_STATE_SYN_SENT) {
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
             /* Advance rcv_nxt over FIN bit */
-            tcb->rcv_nxt = seg_seq + seg_len;
+            tcb->rcv_nxt = fin_seq + 1;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
                                 tcb->rcv_nxt, NULL, 0);
             _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -813,7 +876,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +920,9 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_len > 0) {
+        _gnrc_tcp_congure_timeout(tcb);
+        _gnrc_tcp_pkt_retransmit(tcb, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/ooo.h
+ * @}
+ */
+#include <errno.h>
+#include <string.h>
+#include "container.h"
+#include "ringbuffer.h"
+#include "net/gnrc/pktbuf.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_ooo.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint32_t _end(const gnrc_tcp_ooo_seg_t *seg)
+{
+    return seg->seq + seg->pkt->size;
+}
+
+/* Get the contiguous range of queued data starting at entry *idx */
+static void _next_range(const gnrc_tcp_tcb_t *tcb, unsigned *idx, uint32_t *range)
+{
+    range[0] = tcb->ooo[*idx].seq;
+    range[1] = _end(&tcb->ooo[*idx]);
+    for ((*idx)++; *idx < tcb->ooo_len && tcb->ooo[*idx].seq == range[1]; (*idx)++) {
+        range[1] = _end(&tcb->ooo[*idx]);
+    }
+}
+
+static void _remove_first(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_pktbuf_release(tcb->ooo[0].pkt);
+    tcb->ooo_len -= 1;
+    memmove(&tcb->ooo[0], &tcb->ooo[1], tcb->ooo_len * sizeof(tcb->ooo[0]));
+}
+
+int _gnrc_tcp_ooo_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, gnrc_pktsnip_t *payload,
+                      uint32_t pay_len, bool fin)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t end = seq + pay_len;
+
+    /* Keep only data ahead of rcv_nxt within the receive window */
+    if (!LSS_32_BIT(tcb->rcv_nxt, seq) || GRT_32_BIT(end, tcb->rcv_nxt + tcb->rcv_wnd)) {
+        TCP_DEBUG_INFO("Segment outside of receive window.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+
+    /* Find position and reject segments overlapping queued ones */
+    unsigned pos = 0;
+    while (pos < tcb->ooo_len && LSS_32_BIT(tcb->ooo[pos].seq, seq)) {
+        pos++;
+    }
+    if ((pos > 0 && GRT_32_BIT(_end(&tcb->ooo[pos - 1]), seq)) ||
+        (pos < tcb->ooo_len && GRT_32_BIT(end, tcb->ooo[pos].seq))) {
+        TCP_DEBUG_INFO("Segment overlaps queued data.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+    if (tcb->ooo_len >= ARRAY_SIZE(tcb->ooo)) {
+        TCP_DEBUG_INFO("Out-of-order queue is full.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+
+    /* Copy payload, the received packet is released by the caller */
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, pay_len, GNRC_NETTYPE_UNDEF);
+    if (pkt == NULL) {
+        TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for out-of-order segment.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+    size_t copied = 0;
+    for (gnrc_pktsnip_t *snp = payload; snp && snp->type == GNRC_NETTYPE_UNDEF &&
+         copied < pay_len; snp = snp->next) {
+        size_t len = (snp->size < pay_len - copied) ? snp->size : pay_len - copied;
+        memcpy((uint8_t *)pkt->data + copied, snp->data, len);
+        copied += len;
+    }
+
+    memmove(&tcb->ooo[pos + 1], &tcb->ooo[pos], (tcb->ooo_len - pos) * sizeof(tcb->ooo[0]));
+    tcb->ooo[pos].pkt = pkt;
+    tcb->ooo[pos].seq = seq;
+    tcb->ooo[pos].fin = fin;
+    tcb->ooo_len += 1;
+    tcb->ooo_last = seq;
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+uint32_t _gnrc_tcp_ooo_merge(gnrc_tcp_tcb_t *tcb, bool *fin)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t added = 0;
+
+    *fin = false;
+    while (tcb->ooo_len > 0 && LEQ_32_BIT(tcb->ooo[0].seq, tcb->rcv_nxt)) {
+        gnrc_tcp_ooo_seg_t *seg = &tcb->ooo[0];
+
+        /* Skip data that has been received in order meanwhile */
+        if (LSS_32_BIT(tcb->rcv_nxt, _end(seg))) {
+            uint32_t skip = tcb->rcv_nxt - seg->seq;
+            uint32_t len = seg->pkt->size - skip;
+            uint32_t n = ringbuffer_add(&(tcb->rcv_buf), (char *)seg->pkt->data + skip, len);
+
+            tcb->rcv_nxt += n;
+            added += n;
+            /* Receive buffer is full: keep the remainder queued */
+            if (n < len) {
+                break;
+            }
+        }
+        /* No data follows a FIN: stop after the segment carrying it */
+        if (seg->fin) {
+            *fin = true;
+            _remove_first(tcb);
+            break;
+        }
+        _remove_first(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return added;
+}
+
+void _gnrc_tcp_ooo_clear(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    while (tcb->ooo_len > 0) {
+        _remove_first(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+}
+
+unsigned _gnrc_tcp_ooo_get_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t (*blocks)[2],
+                                  unsigned max)
+{
+    TCP_DEBUG_ENTER;
+    unsigned num = 0;
+    unsigned idx = 0;
+    uint32_t range[2];
+
+    if (max == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* Report the range of the most recently added segment first */
+    while (idx < tcb->ooo_len) {
+        _next_range(tcb, &idx, range);
+        if (LEQ_32_BIT(range[0], tcb->ooo_last) && LSS_32_BIT(tcb->ooo_last, range[1])) {
+            blocks[num][0] = range[0];
+            blocks[num][1] = range[1];
+            num++;
+            break;
+        }
+    }
+
+    /* Report the other ranges in order of their sequence numbers */
+    idx = 0;
+    while (idx < tcb->ooo_len && num < max) {
+        _next_range(tcb, &idx, range);
+        if (num > 0 && range[0] == blocks[0][0]) {
+            continue;
+        }
+        blocks[num][0] = range[0];
+        blocks[num][1] = range[1];
+        num++;
+    }
+    TCP_DEBUG_LEAVE;
+    return num;
+}
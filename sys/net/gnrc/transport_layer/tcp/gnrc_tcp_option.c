@@ -16,7 +16,10 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
+#include "container.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_ooo.h"
 #include "include/gnrc_tcp_option.h"
 
 #define ENABLE_DEBUG 0
@@ -64,6 +67,20 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                /* SACK is only negotiated during connection establishment */
+                if (byteorder_ntohs(hdr->off_ctl) & MSK_SYN) {
+                    TCP_DEBUG_INFO("SACK permitted option found.");
+                    tcb->status |= STATUS_SACK_PERMITTED;
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -83,3 +100,31 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     TCP_DEBUG_LEAVE;
     return 0;
 }
+
+uint8_t _gnrc_tcp_option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t blocks[TCP_OPTION_SACK_BLOCKS_MAX][2];
+
+    /* Report SACK blocks only if the peer permitted it */
+    if (!(tcb->status & STATUS_SACK_PERMITTED) || tcb->ooo_len == 0) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    unsigned num = _gnrc_tcp_ooo_get_blocks(tcb, blocks, ARRAY_SIZE(blocks));
+
+    /* Two NOP options align the block edges to 32 bit */
+    opt[0] = TCP_OPTION_KIND_NOP;
+    opt[1] = TCP_OPTION_KIND_NOP;
+    opt[2] = TCP_OPTION_KIND_SACK;
+    opt[3] = TCP_OPTION_LENGTH_MIN + num * TCP_OPTION_LENGTH_SACK_BLOCK;
+    for (unsigned i = 0; i < num; i++) {
+        network_uint32_t left = byteorder_htonl(blocks[i][0]);
+        network_uint32_t right = byteorder_htonl(blocks[i][1]);
+
+        memcpy(&opt[4 + i * TCP_OPTION_LENGTH_SACK_BLOCK], &left, sizeof(left));
+        memcpy(&opt[8 + i * TCP_OPTION_LENGTH_SACK_BLOCK], &right, sizeof(right));
+    }
+    TCP_DEBUG_LEAVE;
+    return 4 + num * TCP_OPTION_LENGTH_SACK_BLOCK;
+}
@@ -25,6 +25,7 @@
 #include "net/inet_csum.h"
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -155,6 +156,9 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    uint8_t sack[TCP_OPTION_SACK_SIZE_MAX];
+    uint8_t sack_len = 0;
+    bool sack_perm = false;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -180,6 +184,16 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+        /* Offer SACK in SYN, accept it in SYN+ACK if the peer offered it */
+        sack_perm = !(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_PERMITTED);
+        if (sack_perm) {
+            offset += 1;
+        }
+    }
+    /* Add SACK option to pure ACKs while segments are missing */
+    else if (ctl == MSK_ACK && payload_len == 0) {
+        sack_len = _gnrc_tcp_option_build_sack(tcb, sack);
+        offset += sack_len / sizeof(network_uint32_t);
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -217,8 +231,20 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            /* Add SACK permitted option */
+            if (sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_perm());
+
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
+            }
+            /* Add SACK option */
+            if (sack_len > 0) {
+                memcpy(opt_ptr, sack, sack_len);
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -285,14 +311,9 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
-    }
-    else {
-        tcb->retries += 1;
     }
 
     /* Pass packet down the network stack */
@@ -375,11 +396,78 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit)
+/**
+ * @brief Gets a segment in the retransmission queue.
+ *
+ * @param[in] tcb   TCB holding the retransmission queue.
+ * @param[in] idx   Position of the segment, zero for the oldest one.
+ *
+ * @returns   Pointer to the segment.
+ */
+static inline gnrc_tcp_rtx_seg_t *_rtx_seg(gnrc_tcp_tcb_t *tcb, const unsigned idx)
+{
+    return &tcb->rtx[(tcb->rtx_first + idx) % ARRAY_SIZE(tcb->rtx)];
+}
+
+/**
+ * @brief Removes the oldest segment from the retransmission queue.
+ *
+ * @param[in,out] tcb   TCB holding the retransmission queue.
+ */
+static void _rtx_pop(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_rtx_seg_t *seg = _rtx_seg(tcb, 0);
+
+    gnrc_pktbuf_release(seg->pkt);
+    seg->pkt = NULL;
+    tcb->rtx_first = (tcb->rtx_first + 1) % ARRAY_SIZE(tcb->rtx);
+    tcb->rtx_len -= 1;
+}
+
+/**
+ * @brief Keeps the RTO within its bounds.
+ *
+ * @param[in,out] tcb   TCB holding the RTO.
+ */
+static void _bound_rto(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+}
+
+/**
+ * @brief Calculates the RTO from the round trip time estimation and
+ *        (re)starts the retransmission timer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _restart_retransmit_timer(gnrc_tcp_tcb_t *tcb)
+{
+    /* Without a measurement: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+    _bound_rto(tcb);
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
+int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
 {
     TCP_DEBUG_ENTER;
     gnrc_pktsnip_t *snp = NULL;
+    gnrc_tcp_rtx_seg_t *seg = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
 
@@ -390,13 +478,6 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
     ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
@@ -408,24 +489,55 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Check if retransmit queue is full, the last entry is reserved for segments without data */
+    if (tcb->rtx_len >= ARRAY_SIZE(tcb->rtx) ||
+        (len > 0 && tcb->rtx_len >= CONFIG_GNRC_TCP_RTX_QUEUE_SIZE)) {
+        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+
+    /* Append pkt and increase users: every send attempt consumes a user */
+    seg = _rtx_seg(tcb, tcb->rtx_len);
+    seg->pkt = pkt;
+    seg->seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+    seg->msg.size = _gnrc_tcp_pkt_get_seg_len(pkt);
+    seg->msg.send_time = evtimer_now_msec();
+    seg->msg.resends = 0;
     gnrc_pktbuf_hold(pkt, 1);
+    tcb->rtx_len += 1;
+    _gnrc_tcp_congure_sent(tcb, seg->msg.size);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+    /* Start the retransmission timer, if it is not running */
+    if (tcb->rtx_len == 1) {
+        _restart_retransmit_timer(tcb);
     }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool timeout)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_rtx_seg_t *seg = NULL;
+
+    /* Retransmission queue is empty. Nothing to retransmit */
+    if (tcb->rtx_len == 0) {
+        TCP_DEBUG_ERROR("-ENODATA: No packet to retransmit.");
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+
+    seg = _rtx_seg(tcb, 0);
+    if (seg->msg.resends < UINT8_MAX) {
+        seg->msg.resends += 1;
+    }
+
+    if (timeout) {
+        /* Double the rto (Timer Backoff) */
+        tcb->retries += 1;
         tcb->rto *= 2;
+        _bound_rto(tcb);
 
         /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
         /* New measurements must be taken the next time something is sent. */
@@ -433,73 +545,92 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+        _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                                  MSG_TYPE_RETRANSMISSION, tcb);
     }
 
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    /* Every send attempt consumes a user */
+    gnrc_pktbuf_hold(seg->pkt, 1);
+    _gnrc_tcp_congure_sent(tcb, seg->msg.size);
     TCP_DEBUG_LEAVE;
-    return 0;
+    return _gnrc_tcp_pkt_send(tcb, seg->pkt, 0, true);
 }
 
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    gnrc_tcp_rtx_seg_t *seg = NULL;
+    uint32_t send_time = 0;
+    bool retransmitted = false;
+    bool acked = false;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release all segments that are acknowledged entirely */
+    while (tcb->rtx_len > 0) {
+        seg = _rtx_seg(tcb, 0);
+        if (GRT_32_BIT(seg->seq + seg->msg.size, ack)) {
+            break;
+        }
+        retransmitted |= (seg->msg.resends > 0);
+        send_time = seg->msg.send_time;
+        acked = true;
+        _rtx_pop(tcb);
+    }
+    if (!acked) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    tcb->retries = 0;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    /* Measure round trip time */
+    int32_t rtt = evtimer_now_msec() - send_time;
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
+    /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
+    if (!retransmitted && rtt > 0) {
+        /* If this is the first sample taken */
+        if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->srtt = rtt;
+            tcb->rtt_var = (rtt >> 1);
+        }
+        /* If this is a subsequent sample */
+        else {
+            tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+            tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+            tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+            tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
         }
     }
+
+    /* Restart the retransmission timer for the remaining segments */
+    if (tcb->rtx_len > 0) {
+        _restart_retransmit_timer(tcb);
+    }
+    else {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->rtx_len > 0) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+        while (tcb->rtx_len > 0) {
+            _rtx_pop(tcb);
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Binding of the congestion control to CongURE.
+ *
+ * Uses @ref sys_congure_reno, or @ref sys_congure_abe if module
+ * `congure_abe` is used. All functions do nothing before the connection is
+ * synchronized.
+ */
+
+#ifndef GNRC_TCP_CONGURE_H
+#define GNRC_TCP_CONGURE_H
+
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialize congestion control of a connection.
+ *
+ * @note Called when the connection enters FSM_STATE_ESTABLISHED.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the congestion window of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Congestion window in bytes.
+ */
+uint32_t _gnrc_tcp_congure_get_wnd(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Report a segment that was sent or retransmitted.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     size   Sequence number consumption of the segment.
+ */
+void _gnrc_tcp_congure_sent(gnrc_tcp_tcb_t *tcb, unsigned size);
+
+/**
+ * @brief Report an acceptable ACK that acknowledges new data or may be a
+ *        duplicate ACK.
+ *
+ * @note Must be called after tcb->snd_una was advanced. Performs fast
+ *       retransmit and retransmits the first segment on partial ACKs.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seg_ack   Acknowledgment number of the incoming segment.
+ * @param[in]     seg_wnd   Window of the incoming segment.
+ * @param[in]     pay_len   Payload length of the incoming segment.
+ * @param[in]     ctl       Control bits of the incoming segment.
+ * @param[in]     acked     Number of newly acknowledged bytes, zero for a
+ *                          potential duplicate ACK.
+ */
+void _gnrc_tcp_congure_acked(gnrc_tcp_tcb_t *tcb, uint32_t seg_ack,
+                             uint16_t seg_wnd, uint32_t pay_len, uint16_t ctl,
+                             uint32_t acked);
+
+/**
+ * @brief Report an expired retransmission timer.
+ *
+ * @note Must be called before the first segment is retransmitted.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_congure_timeout(gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONGURE_H */
+/** @} */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Queue for segments received out of order.
+ *
+ * Segments that arrive ahead of the next expected sequence number are copied
+ * into the packet buffer and kept in @ref gnrc_tcp_tcb_t::ooo until the gap
+ * before them is filled. Then their payload is moved into the receive buffer
+ * and a FIN they carried is reported to the caller.
+ */
+
+#ifndef GNRC_TCP_OOO_H
+#define GNRC_TCP_OOO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Add a segment received ahead of tcb->rcv_nxt to the queue.
+ *
+ * The payload is only kept if it lies within the receive window, doesn't
+ * overlap a queued segment and the queue has room.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     seq       Sequence number of the segment.
+ * @param[in]     payload   First payload snip of the segment.
+ * @param[in]     pay_len   Payload length of the segment.
+ * @param[in]     fin       Segment carries a FIN after its payload.
+ *
+ * @returns   Zero if the payload was added.
+ *            -ENOMEM if the queue or the packet buffer is full.
+ *            -EINVAL if the payload doesn't fit the receive window or the
+ *            queued segments.
+ */
+int _gnrc_tcp_ooo_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, gnrc_pktsnip_t *payload,
+                      uint32_t pay_len, bool fin);
+
+/**
+ * @brief Move queued segments that continue at tcb->rcv_nxt into the
+ *        receive buffer.
+ *
+ * Advances tcb->rcv_nxt accordingly. Segments that are covered by data
+ * received in order are dropped.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[out]    fin   Set to true if a merged segment carried a FIN. The
+ *                      FIN is then located at tcb->rcv_nxt.
+ *
+ * @returns   Number of bytes added to the receive buffer.
+ */
+uint32_t _gnrc_tcp_ooo_merge(gnrc_tcp_tcb_t *tcb, bool *fin);
+
+/**
+ * @brief Drop all queued segments.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_ooo_clear(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the contiguous ranges of queued data, as reported in SACK options.
+ *
+ * The range containing the most recently added segment comes first, see
+ * RFC 2018, section 4.
+ *
+ * @param[in]  tcb      TCB holding the connection information.
+ * @param[out] blocks   Left and right edge of each range.
+ * @param[in]  max      Maximum number of ranges to report.
+ *
+ * @returns   Number of ranges written to @p blocks.
+ */
+unsigned _gnrc_tcp_ooo_get_blocks(const gnrc_tcp_tcb_t *tcb, uint32_t (*blocks)[2],
+                                  unsigned max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_OOO_H */
+/** @} */
@@ -42,6 +42,31 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Maximum number of blocks in a SACK option.
+ *
+ * Four blocks and two NOP options for alignment fill 36 of the 40 bytes
+ * available for options.
+ */
+#define TCP_OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Maximum size of a SACK option including alignment.
+ */
+#define TCP_OPTION_SACK_SIZE_MAX (4U + TCP_OPTION_SACK_BLOCKS_MAX * TCP_OPTION_LENGTH_SACK_BLOCK)
+
+/**
+ * @brief Helper function to build the SACK permitted option.
+ *
+ * @returns   SACK permitted option value, preceded by two NOP options.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -67,6 +92,17 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
  */
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
+/**
+ * @brief Builds a SACK option reporting the out-of-order queue of a TCB.
+ *
+ * @param[in]  tcb   TCB holding the connection information.
+ * @param[out] opt   Buffer of at least TCP_OPTION_SACK_SIZE_MAX bytes.
+ *
+ * @returns   Size of the option in bytes, a multiple of four.
+ *            Zero if SACK is not permitted or there is nothing to report.
+ */
+uint8_t _gnrc_tcp_option_build_sack(const gnrc_tcp_tcb_t *tcb, uint8_t *opt);
+
 #ifdef __cplusplus
 }
 #endif
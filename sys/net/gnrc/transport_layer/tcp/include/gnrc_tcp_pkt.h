@@ -111,19 +111,29 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
- * @param[in,out] tcb          TCB holding the connection information.
- * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pkt   Packet to add to the retransmission mechanism.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
  *            -EINVAL if pkt is null.
  */
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit);
+int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Retransmits the first unacknowledged packet.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     timeout   Flag used to indicate that the retransmission timer
+ *                          expired. Backs off the timer.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if there is nothing to retransmit.
+ */
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool timeout);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -133,6 +143,13 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Removes all packets from the retransmission mechanism.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
@@ -44,6 +44,13 @@ static kernel_pid_t _pid = KERNEL_PID_UNDEF;
  */
 static char _stack[GNRC_UDP_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 
+#ifdef MODULE_GNRC_NETAPI_BATCH
+/* packets collected for receivers resp. the network layer, sent when the
+ * message queue is drained */
+static gnrc_netapi_batch_t _rx_batch;
+static gnrc_netapi_batch_t _tx_batch;
+#endif
+
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
  *
@@ -152,7 +159,12 @@ static void _receive(gnrc_pktsnip_t *pkt)
     port = (uint32_t)byteorder_ntohs(hdr->dst_port);
 
     /* send payload to receivers */
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    if (!gnrc_netapi_batch_dispatch(&_rx_batch, GNRC_NETTYPE_UDP, port,
+                                    GNRC_NETAPI_MSG_TYPE_RCV, pkt)) {
+#else
     if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, port, pkt)) {
+#endif
         DEBUG("udp: unable to forward packet as no one is interested in it\n");
         /* TODO determine if IPv6 packet, when IPv4 is implemented */
         gnrc_icmpv6_error_dst_unr_send(ICMPV6_ERROR_DST_UNR_PORT, pkt);
@@ -209,8 +221,14 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 
     /* and forward packet to the network layer */
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    if (!gnrc_netapi_batch_dispatch(&_tx_batch, target_type,
+                                    GNRC_NETREG_DEMUX_CTX_ALL,
+                                    GNRC_NETAPI_MSG_TYPE_SND, pkt)) {
+#else
     if (!gnrc_netapi_dispatch_send(target_type, GNRC_NETREG_DEMUX_CTX_ALL,
                                    pkt)) {
+#endif
         DEBUG("udp: cannot send packet: network layer not found\n");
         gnrc_pktbuf_release(pkt);
     }
@@ -221,8 +239,13 @@ static void *_event_loop(void *arg)
     (void)arg;
     msg_t msg, reply;
     msg_t msg_queue[GNRC_UDP_MSG_QUEUE_SIZE];
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID_BATCH(GNRC_NETREG_DEMUX_CTX_ALL,
+                                                                  thread_getpid());
+#else
     gnrc_netreg_entry_t netreg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
+#endif
     /* preset reply message */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
     reply.content.value = (uint32_t)-ENOTSUP;
@@ -233,6 +256,13 @@ static void *_event_loop(void *arg)
 
     /* dispatch NETAPI messages */
     while (1) {
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        if (msg_avail() == 0) {
+            /* burst is over, pass on what was collected */
+            gnrc_netapi_batch_flush(&_rx_batch);
+            gnrc_netapi_batch_flush(&_tx_batch);
+        }
+#endif
         msg_receive(&msg);
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -243,6 +273,22 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
                 break;
+#ifdef MODULE_GNRC_NETAPI_BATCH
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV_BATCH\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                    _receive(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+            case GNRC_NETAPI_MSG_TYPE_SND_BATCH:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND_BATCH\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(msg.content.ptr); i++) {
+                    _send(gnrc_netapi_batch_get(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
             case GNRC_NETAPI_MSG_TYPE_GET:
                 msg_reply(&msg, &reply);
@@ -32,6 +32,8 @@
 #include "xtimer.h"
 #include "timex.h"
 #include "utlist.h"
+#include "bitarithm.h"
+#include "container.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -68,6 +70,379 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+/**
+ * @name kinds of LPM trie nodes
+ * @{
+ */
+#define FIB_TRIE_NODE_UNUSED    (0)   /**< node is not part of the trie */
+#define FIB_TRIE_NODE_ENTRY     (1)   /**< node represents a FIB entry */
+#define FIB_TRIE_NODE_GLUE      (2)   /**< node joins two sub-tries */
+/** @} */
+
+/*
+ * The LPM trie is keyed by the address size (one byte) followed by the
+ * address itself, so addresses of different sizes never match each other.
+ */
+
+/**
+ * @brief returns the byte at position @p idx of the trie key of an address
+ */
+static inline uint8_t _key_byte(const uint8_t *addr, size_t addr_size, unsigned idx)
+{
+    return (idx == 0) ? (uint8_t)addr_size : addr[idx - 1];
+}
+
+/**
+ * @brief returns the bit at position @p bit of the trie key of an address
+ */
+static inline unsigned _key_bit(const uint8_t *addr, size_t addr_size, unsigned bit)
+{
+    return (_key_byte(addr, addr_size, bit >> 3) >> (7 - (bit & 7))) & 0x01;
+}
+
+/**
+ * @brief returns the first bit in [@p from, @p limit) in which the trie keys
+ *        of @p a and @p b differ, or @p limit if they do not differ there
+ */
+static unsigned _key_diff(const uint8_t *a, size_t a_size,
+                          const uint8_t *b, size_t b_size,
+                          unsigned from, unsigned limit)
+{
+    for (unsigned idx = from >> 3; (idx << 3) < limit; ++idx) {
+        uint8_t diff = _key_byte(a, a_size, idx) ^ _key_byte(b, b_size, idx);
+
+        if (idx == (from >> 3)) {
+            diff &= 0xff >> (from & 7);
+        }
+        if (diff != 0) {
+            unsigned bit = (idx << 3) + (7 - bitarithm_msb(diff));
+            return (bit < limit) ? bit : limit;
+        }
+    }
+
+    return limit;
+}
+
+/**
+ * @brief returns the length in bits of the trie key of the given entry
+ */
+static unsigned _entry_key_bits(const fib_entry_t *entry)
+{
+    const universal_address_container_t *global = entry->global;
+    unsigned addr_bits = global->address_size << 3;
+    unsigned prefix_bits = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                           >> FIB_FLAG_NET_PREFIX_SHIFT;
+    bool is_all_zeros_addr = true;
+
+    for (size_t i = 0; i < global->address_size; ++i) {
+        if (global->address[i] != 0) {
+            is_all_zeros_addr = false;
+            break;
+        }
+    }
+
+    if (is_all_zeros_addr) {
+        /* default route, e.g. ::/0 for IPv6 */
+        return 8;
+    }
+
+    if ((prefix_bits == 0) || (prefix_bits > addr_bits)) {
+        prefix_bits = addr_bits;
+    }
+
+    return 8 + prefix_bits;
+}
+
+/**
+ * @brief returns the entry a trie node of type FIB_TRIE_NODE_ENTRY belongs to
+ */
+static inline fib_entry_t *_node_entry(fib_trie_node_t *node)
+{
+    return container_of(node, fib_entry_t, node);
+}
+
+/**
+ * @brief initializes an empty trie and its pool of branching nodes
+ */
+static void fib_trie_init(fib_table_t *table)
+{
+    table->trie = NULL;
+    table->trie_free = NULL;
+
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_trie_node_t *glue = &table->data.entries[i].glue;
+
+        glue->type = FIB_TRIE_NODE_UNUSED;
+        glue->child[0] = table->trie_free;
+        table->trie_free = glue;
+    }
+}
+
+static fib_trie_node_t *fib_trie_alloc_glue(fib_table_t *table, unsigned bits)
+{
+    fib_trie_node_t *glue = table->trie_free;
+
+    /* a trie of n entry nodes never needs more than n - 1 branching nodes */
+    assert(glue != NULL);
+
+    table->trie_free = glue->child[0];
+    glue->child[0] = NULL;
+    glue->child[1] = NULL;
+    glue->same = NULL;
+    glue->bits = bits;
+    glue->type = FIB_TRIE_NODE_GLUE;
+
+    return glue;
+}
+
+static void fib_trie_free_glue(fib_table_t *table, fib_trie_node_t *glue)
+{
+    glue->type = FIB_TRIE_NODE_UNUSED;
+    glue->child[0] = table->trie_free;
+    table->trie_free = glue;
+}
+
+/**
+ * @brief inserts the given entry into the trie of the table
+ */
+static void fib_trie_insert(fib_table_t *table, fib_entry_t *entry)
+{
+    const uint8_t *key = entry->global->address;
+    size_t key_size = entry->global->address_size;
+    unsigned bits = _entry_key_bits(entry);
+    fib_trie_node_t *node = &entry->node;
+
+    node->child[0] = NULL;
+    node->child[1] = NULL;
+    node->same = NULL;
+    node->bits = bits;
+    node->type = FIB_TRIE_NODE_ENTRY;
+
+    if (table->trie == NULL) {
+        table->trie = node;
+        return;
+    }
+
+    /* find the entry node sharing the longest prefix with the new one */
+    fib_trie_node_t *cur = table->trie;
+    while ((cur->bits < bits) && (cur->child[_key_bit(key, key_size, cur->bits)] != NULL)) {
+        cur = cur->child[_key_bit(key, key_size, cur->bits)];
+    }
+    while (cur->type != FIB_TRIE_NODE_ENTRY) {
+        /* branching nodes always have both children */
+        cur = cur->child[0];
+    }
+
+    const universal_address_container_t *rep = _node_entry(cur)->global;
+    unsigned diff = _key_diff(key, key_size, rep->address, rep->address_size,
+                              0, (bits < cur->bits) ? bits : cur->bits);
+
+    /* find the position of the new node */
+    fib_trie_node_t **link = &table->trie;
+    while ((*link != NULL) && ((*link)->bits < diff)) {
+        link = &(*link)->child[_key_bit(key, key_size, (*link)->bits)];
+    }
+    cur = *link;
+
+    if (cur == NULL) {
+        *link = node;
+    }
+    else if ((cur->bits == diff) && (diff < bits)) {
+        /* the new prefix extends the one of cur */
+        unsigned dir = _key_bit(key, key_size, diff);
+        assert(cur->child[dir] == NULL);
+        cur->child[dir] = node;
+    }
+    else if ((cur->bits == diff) && (cur->type == FIB_TRIE_NODE_ENTRY)) {
+        /* the very same prefix is already known */
+        node->same = cur->same;
+        cur->same = node;
+    }
+    else if (cur->bits == diff) {
+        /* the new prefix replaces a branching node */
+        node->child[0] = cur->child[0];
+        node->child[1] = cur->child[1];
+        *link = node;
+        fib_trie_free_glue(table, cur);
+    }
+    else if (diff == bits) {
+        /* the new prefix is a prefix of cur */
+        node->child[_key_bit(rep->address, rep->address_size, diff)] = cur;
+        *link = node;
+    }
+    else {
+        /* the new prefix and cur diverge at diff */
+        fib_trie_node_t *glue = fib_trie_alloc_glue(table, diff);
+        unsigned dir = _key_bit(key, key_size, diff);
+        glue->child[dir] = node;
+        glue->child[!dir] = cur;
+        *link = glue;
+    }
+}
+
+/**
+ * @brief removes the given entry from the trie of the table
+ */
+static void fib_trie_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    const uint8_t *key = entry->global->address;
+    size_t key_size = entry->global->address_size;
+    fib_trie_node_t *node = &entry->node;
+    fib_trie_node_t **parent = NULL;
+    fib_trie_node_t **link = &table->trie;
+
+    while ((*link)->bits < node->bits) {
+        parent = link;
+        link = &(*link)->child[_key_bit(key, key_size, (*link)->bits)];
+        assert(*link != NULL);
+    }
+
+    fib_trie_node_t *cur = *link;
+    assert((cur->bits == node->bits) && (cur->type == FIB_TRIE_NODE_ENTRY));
+
+    node->type = FIB_TRIE_NODE_UNUSED;
+
+    if (cur != node) {
+        /* the entry shares its prefix with cur */
+        while (cur->same != node) {
+            cur = cur->same;
+        }
+        cur->same = node->same;
+    }
+    else if (node->same != NULL) {
+        /* hand the position over to the next entry with the same prefix */
+        node->same->child[0] = node->child[0];
+        node->same->child[1] = node->child[1];
+        *link = node->same;
+    }
+    else if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        fib_trie_node_t *glue = fib_trie_alloc_glue(table, node->bits);
+        glue->child[0] = node->child[0];
+        glue->child[1] = node->child[1];
+        *link = glue;
+    }
+    else if ((node->child[0] != NULL) || (node->child[1] != NULL)) {
+        *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    }
+    else {
+        *link = NULL;
+
+        /* a branching node must not be left with a single child */
+        if ((parent != NULL) && ((*parent)->type == FIB_TRIE_NODE_GLUE)) {
+            fib_trie_node_t *glue = *parent;
+            *parent = (glue->child[0] != NULL) ? glue->child[0] : glue->child[1];
+            fib_trie_free_glue(table, glue);
+        }
+    }
+}
+
+/**
+ * @brief removes the given entry
+ *
+ * @param[in] table the FIB table the entry belongs to
+ * @param[in] entry the entry to be removed
+ *
+ * @return 0 on success
+ */
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    if (entry->node.type == FIB_TRIE_NODE_ENTRY) {
+        fib_trie_remove(table, entry);
+    }
+
+    if (entry->global != NULL) {
+        universal_address_rem(entry->global);
+    }
+
+    if (entry->next_hop) {
+        universal_address_rem(entry->next_hop);
+    }
+
+    entry->global = NULL;
+    entry->global_flags = 0;
+    entry->next_hop = NULL;
+    entry->next_hop_flags = 0;
+
+    entry->iface_id = KERNEL_PID_UNDEF;
+    entry->lifetime = 0;
+
+    return 0;
+}
+
+/**
+ * @brief callback of the expiry timer, the actual removal of expired entries
+ *        is deferred to the next access of the table
+ */
+static void fib_expiry_cb(void *arg)
+{
+    fib_table_t *table = arg;
+    table->expiry_pending = 1;
+}
+
+/**
+ * @brief (re-)arms the expiry timer of the table if @p lifetime expires before
+ *        all other entries
+ *
+ * @param[in] table     the FIB table
+ * @param[in] lifetime  an absolute lifetime as stored in the entries
+ */
+static void fib_schedule_expiry(fib_table_t *table, uint64_t lifetime)
+{
+    if (lifetime >= table->next_expiry) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+    table->next_expiry = lifetime;
+    xtimer_set64(&table->expiry_timer, (lifetime > now) ? (lifetime - now) : 0);
+}
+
+/**
+ * @brief removes all expired entries of the table and re-arms the expiry timer
+ *
+ * @param[in] table     the FIB table
+ */
+static void fib_expire_entries(fib_table_t *table)
+{
+    uint64_t now = xtimer_now_usec64();
+
+    table->expiry_pending = 0;
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+
+    for (size_t i = 0; i < table->size; ++i) {
+        fib_entry_t *entry = &table->data.entries[i];
+
+        if ((entry->lifetime == 0) || (entry->lifetime == FIB_LIFETIME_NO_EXPIRE)) {
+            continue;
+        }
+
+        if (entry->lifetime <= now) {
+            DEBUG("[fib_expire_entries] entry %p expired\n", (void *)entry);
+            fib_remove(table, entry);
+        }
+        else if (entry->lifetime < table->next_expiry) {
+            table->next_expiry = entry->lifetime;
+        }
+    }
+
+    if (table->next_expiry != FIB_LIFETIME_NO_EXPIRE) {
+        xtimer_set64(&table->expiry_timer, table->next_expiry - now);
+    }
+}
+
+/**
+ * @brief removes the expired entries of the table if the expiry timer fired
+ *        since the last access
+ *
+ * @param[in] table     the FIB table
+ */
+static inline void fib_check_expiry(fib_table_t *table)
+{
+    if (table->expiry_pending) {
+        fib_expire_entries(table);
+    }
+}
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -84,13 +459,10 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  */
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
-
     size_t count = 0;
-    size_t prefix_size = 0;
-    size_t match_size = dst_size << 3;
+    unsigned dst_bits = 8 + (dst_size << 3);
+    unsigned matched = 0;
     int ret = -EHOSTUNREACH;
-    bool is_all_zeros_addr = true;
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
         DEBUG("[fib_find_entry] dst =");
@@ -100,83 +472,43 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         DEBUG("\n");
     }
 
-    for (size_t i = 0; i < dst_size; ++i) {
-        if (dst[i] != 0) {
-            is_all_zeros_addr = false;
-            break;
-        }
-    }
+    fib_check_expiry(table);
 
-    for (size_t i = 0; i < table->size; ++i) {
+    /* walk down the trie along dst, every entry node on the way that matches
+     * dst is a longer prefix than the previous one */
+    fib_trie_node_t *node = table->trie;
+    while ((node != NULL) && (node->bits <= dst_bits)) {
+        if (node->type == FIB_TRIE_NODE_ENTRY) {
+            const universal_address_container_t *global = _node_entry(node)->global;
 
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
-
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
-
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
-
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
+            if (_key_diff(global->address, global->address_size, dst, dst_size,
+                          matched, node->bits) < node->bits) {
+                /* no entry further down can match either */
+                break;
+            }
+            matched = node->bits;
+
+            for (fib_trie_node_t *same = node; same != NULL; same = same->same) {
+                global = _node_entry(same)->global;
+                /* If we found an exact match */
+                if (memcmp(global->address, dst, dst_size) == 0) {
+                    entry_arr[0] = _node_entry(same);
+                    *entry_arr_size = 1;
+                    /* we will not find a better one so we return */
+                    return 1;
                 }
             }
+
+            /* we could find a better one so we move on */
+            entry_arr[0] = _node_entry(node);
+            ret = 0;
+            count = 1;
         }
 
-        if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
-
-            int ret_comp = universal_address_compare(table->data.entries[i].global, dst,
-                                                     &match_size);
-            /* If we found an exact match */
-            if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
-                || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
-                entry_arr[0] = &(table->data.entries[i]);
-                *entry_arr_size = 1;
-                /* we will not find a better one so we return */
-                return 1;
-            }
-            else {
-                /* we try to find the most fitting prefix */
-                if (ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) {
-                    if (table->data.entries[i].global_flags & FIB_FLAG_NET_PREFIX_MASK) {
-                        /* we shift the most upper flag byte back to get the number of prefix bits */
-                        uint32_t global_prefix_len = (table->data.entries[i].global_flags
-                                                   & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
-
-                        if ((match_size >= global_prefix_len) &&
-                            ((prefix_size == 0) || (match_size > prefix_size))) {
-                            entry_arr[0] = &(table->data.entries[i]);
-                            /* we could find a better one so we move on */
-                            ret = 0;
-
-                            prefix_size = match_size;
-                            count = 1;
-                        }
-                    }
-                 }
-                 else if (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) {
-                    /* we found the default gateway entry, e.g. ::/0 for IPv6
-                     * and we keep it only if there is no better one
-                     */
-                    if (prefix_size == 0) {
-                        entry_arr[0] = &(table->data.entries[i]);
-                        /* we could find a better one so we move on */
-                        ret = 0;
-                        count = 1;
-                    }
-                }
-                match_size = dst_size<<3;
-            }
+        if (node->bits == dst_bits) {
+            break;
         }
+        node = node->child[_key_bit(dst, dst_size, node->bits)];
     }
 
     if (IS_ACTIVE(ENABLE_DEBUG)) {
@@ -196,6 +528,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -205,7 +538,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry, uint8_t *next_hop,
                          size_t next_hop_size, uint32_t next_hop_flags,
                          uint32_t lifetime)
 {
@@ -221,6 +554,7 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
 
     if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
         fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+        fib_schedule_expiry(table, entry->lifetime);
     }
     else {
         entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
@@ -267,11 +601,13 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 
                 if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
                     fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
+                    fib_schedule_expiry(table, table->data.entries[i].lifetime);
                 }
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+                fib_trie_insert(table, &table->data.entries[i]);
                 return 0;
             }
         }
@@ -280,34 +616,6 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
     return -ENOMEM;
 }
 
-/**
- * @brief removes the given entry
- *
- * @param[in] entry the entry to be removed
- *
- * @return 0 on success
- */
-static int fib_remove(fib_entry_t *entry)
-{
-    if (entry->global != NULL) {
-        universal_address_rem(entry->global);
-    }
-
-    if (entry->next_hop) {
-        universal_address_rem(entry->next_hop);
-    }
-
-    entry->global = NULL;
-    entry->global_flags = 0;
-    entry->next_hop = NULL;
-    entry->next_hop_flags = 0;
-
-    entry->iface_id = KERNEL_PID_UNDEF;
-    entry->lifetime = 0;
-
-    return 0;
-}
-
 /**
  * @brief signals (sends a message to) all registered routing protocols
  *        registered with a matching prefix (usually this should be only one).
@@ -408,7 +716,7 @@ int fib_add_entry(fib_table_t *table,
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -438,7 +746,7 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
         DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -462,7 +770,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -482,7 +790,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -552,6 +860,8 @@ int fib_get_destination_set(fib_table_t *table, uint8_t *prefix,
     int ret = -EHOSTUNREACH;
     size_t found_entries = 0;
 
+    fib_check_expiry(table);
+
     for (size_t i = 0; i < table->size; ++i) {
         fib_entry_t *tmp = &table->data.entries[i];
         if ((tmp->global != NULL)
@@ -603,7 +913,14 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        fib_trie_init(table);
     }
+
+    table->expiry_timer.callback = fib_expiry_cb;
+    table->expiry_timer.arg = table;
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    table->expiry_pending = 0;
+
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
 }
@@ -628,7 +945,13 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        fib_trie_init(table);
     }
+
+    xtimer_remove(&table->expiry_timer);
+    table->next_expiry = FIB_LIFETIME_NO_EXPIRE;
+    table->expiry_pending = 0;
+
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
 }
@@ -1551,6 +1874,8 @@ void fib_print_routes(fib_table_t *table)
     uint64_t now = xtimer_now_usec64();
 
     if (table->table_type == FIB_TABLE_TYPE_SH) {
+        fib_check_expiry(table);
+
         printf("%-" FIB_ADDR_PRINT_LENS "s %-17s %-" FIB_ADDR_PRINT_LENS "s %-10s %-16s"
                 " Interface\n", "Destination", "Flags", "Next Hop", "Flags", "Expires");
 
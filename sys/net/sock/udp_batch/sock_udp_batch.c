@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Generic @ref sock_udp_recv_batch and @ref sock_udp_send_batch
+ *
+ * For network stacks that can't hand a burst of datagrams to or from a sock
+ * at once: the datagrams are passed one by one.
+ */
+
+#include <assert.h>
+
+#include "net/sock/udp.h"
+
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_msg_t *msgs, unsigned numof,
+                        uint32_t timeout)
+{
+    assert((sock != NULL) && (msgs != NULL) && (numof > 0));
+    for (unsigned i = 0; i < numof; i++) {
+        /* only wait for the first datagram, the rest of a burst is already
+         * queued at the sock */
+        ssize_t res = sock_udp_recv(sock, msgs[i].data, msgs[i].len,
+                                    (i == 0) ? timeout : 0, msgs[i].remote);
+
+        if (res < 0) {
+            return (i == 0) ? (int)res : (int)i;
+        }
+        msgs[i].len = res;
+    }
+    return numof;
+}
+
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_msg_t *msgs,
+                        unsigned numof)
+{
+    assert((msgs != NULL) && (numof > 0));
+    for (unsigned i = 0; i < numof; i++) {
+        ssize_t res = sock_udp_send(sock, msgs[i].data, msgs[i].len,
+                                    msgs[i].remote);
+
+        if (res < 0) {
+            return (i == 0) ? (int)res : (int)i;
+        }
+    }
+    return numof;
+}
+
+/** @} */
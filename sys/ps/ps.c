@@ -29,6 +29,10 @@
 #include "ztimer.h"
 #endif
 
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+#include "time_units.h"
+#endif
+
 #ifdef MODULE_TLSF_MALLOC
 #include "tlsf.h"
 #include "tlsf-malloc.h"
@@ -53,6 +57,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+           "| preempt  | lat avg us | lat max us "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -108,6 +115,14 @@ void ps(void)
             unsigned runtime_major = runtime_us / rt_sum;
             unsigned runtime_minor = ((runtime_us % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+            schedstat_t stat;
+            schedstat_get(i, &stat);
+            uint32_t lat_avg_us = (stat.wakeups)
+                ? schedstat_ticks_to_ns(stat.latency_sum / stat.wakeups) / NS_PER_US
+                : 0;
+            uint32_t lat_max_us = schedstat_ticks_to_ns(stat.latency_max) / NS_PER_US;
 #endif
             printf("\t%3" PRIkernel_pid
 #ifdef CONFIG_THREAD_NAMES
@@ -119,6 +134,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   "| %8"PRIu32" | %10"PRIu32" | %10"PRIu32" "
 #endif
                    "\n",
                    thread_getpid_of(p),
@@ -132,6 +150,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, ztimer_us
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   , stat.preemptions, lat_avg_us, lat_max_us
 #endif
                   );
         }
@@ -148,4 +169,29 @@ void ps(void)
     printf("\tTotal used size: %u\n", sizes.used);
 #   endif
 #endif
+
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+    puts("\n\twakeup latency histograms (upper bound in us: count)");
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        schedstat_t stat;
+
+        if (thread_get(i) == NULL) {
+            continue;
+        }
+        schedstat_get(i, &stat);
+        printf("\t%3" PRIkernel_pid " |", i);
+        for (unsigned b = 0; b < CONFIG_SCHEDSTATISTICS_HIST_BUCKETS; b++) {
+            if (!stat.latency_hist[b]) {
+                continue;
+            }
+            if (b == CONFIG_SCHEDSTATISTICS_HIST_BUCKETS - 1) {
+                printf(" >=%lu: %u", 1LU << b, stat.latency_hist[b]);
+            }
+            else {
+                printf(" <%lu: %u", 2LU << b, stat.latency_hist[b]);
+            }
+        }
+        puts("");
+    }
+#endif
 }
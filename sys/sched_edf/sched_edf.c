@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @ingroup     sched_edf
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduling implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "sched_edf.h"
+
+#ifdef MODULE_SCHEDSTATISTICS
+#include "schedstatistics.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* task descriptors of the threads in the EDF class, indexed by pid */
+static sched_edf_t *_tasks[MAXTHREADS];
+
+static void _account(sched_edf_t *edf, uint32_t now)
+{
+    edf->consumed += now - edf->started;
+    edf->started = now;
+    if ((edf->consumed > edf->budget) && !edf->overrun) {
+        DEBUG("sched_edf: budget overrun of %" PRIkernel_pid "\n",
+              edf->thread->pid);
+        edf->overrun = true;
+        edf->overruns++;
+    }
+}
+
+static void _release(sched_edf_t *edf, uint32_t now)
+{
+    edf->thread->deadline = edf->release + edf->deadline;
+    edf->started = now;
+    edf->consumed = 0;
+    edf->overrun = false;
+}
+
+static void _sched_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
+{
+#ifdef MODULE_SCHEDSTATISTICS
+    sched_statistics_cb(active_thread, next_thread);
+#endif
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    if (pid_is_valid(active_thread)) {
+        sched_edf_t *edf = _tasks[active_thread - KERNEL_PID_FIRST];
+        if (edf) {
+            _account(edf, now);
+        }
+    }
+    if (pid_is_valid(next_thread)) {
+        sched_edf_t *edf = _tasks[next_thread - KERNEL_PID_FIRST];
+        if (edf) {
+            edf->started = now;
+        }
+    }
+}
+
+static void _timer_cb(void *arg)
+{
+    sched_edf_t *edf = arg;
+
+    _release(edf, ztimer_now(ZTIMER_USEC));
+    thread_wakeup(edf->thread->pid);
+}
+
+void sched_edf_init(void)
+{
+    sched_register_cb(_sched_cb);
+}
+
+void sched_edf_join(sched_edf_t *edf, uint32_t period, uint32_t deadline,
+                    uint32_t budget)
+{
+    assert(deadline <= period);
+    thread_t *me = thread_get_active();
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    edf->timer.callback = _timer_cb;
+    edf->timer.arg = edf;
+    edf->thread = me;
+    edf->period = period;
+    edf->deadline = deadline;
+    edf->budget = budget;
+    edf->release = now;
+    edf->jobs = 0;
+    edf->misses = 0;
+    edf->overruns = 0;
+    edf->prio = me->priority;
+
+    unsigned state = irq_disable();
+    _release(edf, now);
+    _tasks[me->pid - KERNEL_PID_FIRST] = edf;
+    irq_restore(state);
+
+    sched_change_priority(me, CONFIG_SCHED_EDF_PRIO);
+}
+
+void sched_edf_wait_period(sched_edf_t *edf)
+{
+    assert(edf->thread == thread_get_active());
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    _account(edf, now);
+    edf->jobs++;
+    if (now - edf->release > edf->deadline) {
+        DEBUG("sched_edf: deadline miss of %" PRIkernel_pid "\n",
+              edf->thread->pid);
+        edf->misses++;
+    }
+    edf->release += edf->period;
+
+    if ((int32_t)(edf->release - now) <= 0) {
+        /* next job is already due: start it right away, yielding to
+         * threads whose deadline is now earlier */
+        _release(edf, now);
+    }
+    else {
+        ztimer_set(ZTIMER_USEC, &edf->timer, edf->release - now);
+        sched_set_status(edf->thread, STATUS_SLEEPING);
+    }
+    irq_restore(state);
+    thread_yield_higher();
+}
+
+void sched_edf_leave(sched_edf_t *edf)
+{
+    assert(edf->thread == thread_get_active());
+    unsigned state = irq_disable();
+
+    ztimer_remove(ZTIMER_USEC, &edf->timer);
+    _tasks[edf->thread->pid - KERNEL_PID_FIRST] = NULL;
+    irq_restore(state);
+
+    sched_change_priority(edf->thread, edf->prio);
+}
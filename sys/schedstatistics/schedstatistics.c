@@ -21,17 +21,91 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "cpu.h"
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
+#include "time_units.h"
 #include "ztimer.h"
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+#  include "periph_conf.h"
+#  if defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CLOCK_CORECLOCK)
+/* Cortex-M3 and above: reading the cycle counter is a single load */
+#    define TICKS_PER_US    (CLOCK_CORECLOCK / US_PER_SEC)
+
+static inline uint32_t _ticks(void)
+{
+    return DWT->CYCCNT;
+}
+
+static void _ticks_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+#  else
+#    define TICKS_PER_US    (1U)
+
+static inline uint32_t _ticks(void)
+{
+    return ztimer_now(ZTIMER_USEC);
+}
+
+static void _ticks_init(void)
+{
+}
+#  endif
+#endif
+
 /**
  * When core_idle_thread is not active, the KERNEL_PID_UNDEF is used to track
  * the idle time
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+/* threads are put on the run queue before the timer is set up, e.g. in
+ * kernel_init(): ignore their wakeups until init_schedstatistics() ran */
+static bool _ticks_ready;
+
+static void _record_latency(schedstat_t *stat)
+{
+    uint32_t latency = _ticks() - stat->wakeup;
+    uint32_t latency_us = latency / TICKS_PER_US;
+    unsigned bucket = (latency_us) ? bitarithm_msb(latency_us) : 0;
+
+    if (bucket >= CONFIG_SCHEDSTATISTICS_HIST_BUCKETS) {
+        bucket = CONFIG_SCHEDSTATISTICS_HIST_BUCKETS - 1;
+    }
+    if (stat->latency_hist[bucket] < UINT16_MAX) {
+        stat->latency_hist[bucket]++;
+    }
+    if (latency > stat->latency_max) {
+        stat->latency_max = latency;
+    }
+    stat->latency_sum += latency;
+    stat->wakeups++;
+    stat->waking = false;
+}
+
+void sched_statistics_wakeup(kernel_pid_t pid)
+{
+    schedstat_t *stat = &sched_pidlist[pid];
+
+    if (!_ticks_ready) {
+        return;
+    }
+    stat->wakeup = _ticks();
+    stat->waking = true;
+}
+#endif
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = ztimer_now(ZTIMER_USEC);
@@ -40,6 +114,14 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
         active_stat->runtime_us += now - active_stat->laststart;
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+        thread_t *active = thread_get(active_thread);
+
+        /* a thread that blocked is no longer pending */
+        if (active && (thread_get_status(active) == STATUS_PENDING)) {
+            active_stat->preemptions++;
+        }
+#endif
     }
 
     /* Update next_thread stats */
@@ -47,9 +129,42 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+        if (next_stat->waking) {
+            _record_latency(next_stat);
+        }
+#endif
     }
 }
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+void schedstat_get(kernel_pid_t pid, schedstat_t *stat)
+{
+    unsigned state = irq_disable();
+
+    *stat = sched_pidlist[pid];
+    irq_restore(state);
+}
+
+void schedstat_reset_latency(kernel_pid_t pid)
+{
+    unsigned state = irq_disable();
+    schedstat_t *stat = &sched_pidlist[pid];
+
+    stat->wakeups = 0;
+    stat->preemptions = 0;
+    stat->latency_max = 0;
+    stat->latency_sum = 0;
+    memset(stat->latency_hist, 0, sizeof(stat->latency_hist));
+    irq_restore(state);
+}
+
+uint64_t schedstat_ticks_to_ns(uint64_t ticks)
+{
+    return (ticks * NS_PER_US) / TICKS_PER_US;
+}
+#endif
+
 void init_schedstatistics(void)
 {
     /* Init laststart for the thread starting schedstatistics since the callback
@@ -57,5 +172,9 @@ void init_schedstatistics(void)
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
     active_stat->laststart = ztimer_now(ZTIMER_USEC);
     active_stat->schedules = 1;
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+    _ticks_init();
+    _ticks_ready = true;
+#endif
     sched_register_cb(sched_statistics_cb);
 }
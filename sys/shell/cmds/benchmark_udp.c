@@ -50,6 +50,21 @@ static int _benchmark_udp_handler(int argc, char **argv)
             bench_port = atoi(argv[3]);
         }
     }
+    if (strcmp(argv[1], "flood") == 0) {
+        if (argc < 3) {
+            goto usage;
+        }
+        return benchmark_udp_flood(bench_server, bench_port, atoi(argv[2]),
+                                   (argc > 3) ? atoi(argv[3]) : 32,
+                                   (argc > 4) ? atoi(argv[4]) : 1);
+    }
+    if (strcmp(argv[1], "sink") == 0) {
+        if (argc < 3) {
+            goto usage;
+        }
+        return benchmark_udp_sink(bench_port, atoi(argv[2]),
+                                  (argc > 3) ? atoi(argv[3]) : 1);
+    }
     if (strcmp(argv[1], "stop") == 0) {
         if (benchmark_udp_stop()) {
             puts("benchmark process stopped");
@@ -61,6 +76,8 @@ static int _benchmark_udp_handler(int argc, char **argv)
 
 usage:
     printf("usage: %s [start|stop|config] <server> <port>\n", argv[0]);
+    printf("       %s flood <count> [<size> [<batch>]]\n", argv[0]);
+    printf("       %s sink <seconds> [<batch>]\n", argv[0]);
     return -1;
 }
 
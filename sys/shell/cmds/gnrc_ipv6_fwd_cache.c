@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "net/gnrc/ipv6.h"
+#include "shell.h"
+
+static int _gnrc_ipv6_fwd_cache(int argc, char **argv)
+{
+    const gnrc_ipv6_fwd_cache_stats_t *stats = gnrc_ipv6_fwd_cache_stats();
+    uint32_t hits = stats->hits;
+    uint32_t misses = stats->misses;
+    uint64_t total = (uint64_t)hits + misses;
+
+    (void)argc;
+    (void)argv;
+    printf("hits: %lu\n", (long unsigned)hits);
+    printf("misses: %lu\n", (long unsigned)misses);
+    printf("hit rate: %u%%\n",
+           (total > 0) ? (unsigned)((hits * UINT64_C(100)) / total) : 0U);
+    return 0;
+}
+
+SHELL_COMMAND(ip6_fwd, "IPv6 forwarding cache statistics", _gnrc_ipv6_fwd_cache);
+
+/** @} */
@@ -15,6 +15,7 @@
  * @author      Benjamin Valentin <benjamin.valentin@ml-pa.com>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include "macros/utils.h"
@@ -142,14 +143,41 @@ static void *_send_thread(void *ctx)
     return NULL;
 }
 
-int benchmark_udp_start(const char *server, uint16_t port)
+static int _resolve(sock_udp_ep_t *remote, const char *server, uint16_t port)
 {
     netif_t *netif;
+
+    remote->family = AF_INET6;
+    remote->port = port;
+    if (netutils_get_ipv6((ipv6_addr_t *)&remote->addr.ipv6, &netif, server) < 0) {
+        puts("can't resolve remote address");
+        return 1;
+    }
+    if (netif) {
+        remote->netif = netif_get_id(netif);
+    } else {
+        remote->netif = SOCK_ADDR_ANY_NETIF;
+    }
+    return 0;
+}
+
+static void _print_rate(const char *what, unsigned numof, unsigned calls,
+                        uint32_t time_us)
+{
+    if (time_us == 0) {
+        time_us = 1;
+    }
+    printf("%s %u datagrams in %u calls, %" PRIu32 " us (%" PRIu32 " datagrams/s)\n",
+           what, numof, calls, time_us,
+           (uint32_t)(((uint64_t)numof * US_PER_SEC) / time_us));
+}
+
+int benchmark_udp_start(const char *server, uint16_t port)
+{
     sock_udp_ep_t local = { .family = AF_INET6,
                             .netif = SOCK_ADDR_ANY_NETIF,
                             .port = port };
-    sock_udp_ep_t remote = { .family = AF_INET6,
-                             .port = port };
+    sock_udp_ep_t remote;
 
     /* stop threads first */
     benchmark_udp_stop();
@@ -159,15 +187,9 @@ int benchmark_udp_start(const char *server, uint16_t port)
         return 1;
     }
 
-    if (netutils_get_ipv6((ipv6_addr_t *)&remote.addr.ipv6, &netif, server) < 0) {
-        puts("can't resolve remote address");
+    if (_resolve(&remote, server, port)) {
         return 1;
     }
-    if (netif) {
-        remote.netif = netif_get_id(netif);
-    } else {
-        remote.netif = SOCK_ADDR_ANY_NETIF;
-    }
 
     running = true;
     thread_create(listen_thread_stack, sizeof(listen_thread_stack),
@@ -205,6 +227,103 @@ bool benchmark_udp_stop(void)
     return true;
 }
 
+int benchmark_udp_flood(const char *server, uint16_t port, unsigned count,
+                        unsigned size, unsigned batch)
+{
+    sock_udp_msg_t msgs[BENCH_BATCH_MAX];
+    sock_udp_ep_t remote;
+    sock_udp_t flood_sock;
+    unsigned sent = 0, calls = 0;
+    uint32_t start;
+    int res = 0;
+
+    if ((batch == 0) || (batch > BENCH_BATCH_MAX) ||
+        (size > BENCH_PAYLOAD_SIZE_MAX)) {
+        printf("batch must be 1..%u and size at most %u\n",
+               BENCH_BATCH_MAX, BENCH_PAYLOAD_SIZE_MAX);
+        return 1;
+    }
+    if (_resolve(&remote, server, port)) {
+        return 1;
+    }
+    if (sock_udp_create(&flood_sock, NULL, &remote, 0) < 0) {
+        puts("Error creating UDP sock");
+        return 1;
+    }
+    for (unsigned i = 0; i < batch; i++) {
+        /* the payload is not looked at, so all datagrams share one buffer */
+        msgs[i].data = buf_tx;
+        msgs[i].len = size;
+        msgs[i].remote = NULL;
+    }
+
+    start = xtimer_now_usec();
+    while (sent < count) {
+        res = sock_udp_send_batch(&flood_sock, msgs, MIN(batch, count - sent));
+        if (res < 0) {
+            printf("Error sending message: %d\n", res);
+            break;
+        }
+        sent += res;
+        calls++;
+    }
+    _print_rate("sent", sent, calls, xtimer_now_usec() - start);
+    sock_udp_close(&flood_sock);
+
+    return (res < 0) ? 1 : 0;
+}
+
+int benchmark_udp_sink(uint16_t port, unsigned seconds, unsigned batch)
+{
+    /* the payload is not looked at, so all datagrams share one buffer */
+    static uint8_t buf_rx[BENCH_PAYLOAD_SIZE_MAX + sizeof(benchmark_msg_ping_t)];
+    sock_udp_msg_t msgs[BENCH_BATCH_MAX];
+    sock_udp_ep_t local = { .family = AF_INET6,
+                            .netif = SOCK_ADDR_ANY_NETIF,
+                            .port = port };
+    sock_udp_t sink_sock;
+    unsigned received = 0, calls = 0;
+    uint32_t start, now, first = 0;
+
+    if ((batch == 0) || (batch > BENCH_BATCH_MAX)) {
+        printf("batch must be 1..%u\n", BENCH_BATCH_MAX);
+        return 1;
+    }
+    if (sock_udp_create(&sink_sock, &local, NULL, 0) < 0) {
+        puts("Error creating UDP sock");
+        return 1;
+    }
+
+    start = xtimer_now_usec();
+    now = start;
+    while ((now - start) < (seconds * US_PER_SEC)) {
+        for (unsigned i = 0; i < batch; i++) {
+            msgs[i].data = buf_rx;
+            msgs[i].len = sizeof(buf_rx);
+            msgs[i].remote = NULL;
+        }
+        int res = sock_udp_recv_batch(&sink_sock, msgs, batch,
+                                      (seconds * US_PER_SEC) - (now - start));
+        now = xtimer_now_usec();
+        if (res < 0) {
+            if (res != -ETIMEDOUT) {
+                printf("Error receiving message: %d\n", res);
+            }
+            continue;
+        }
+        if (received == 0) {
+            /* only count the time datagrams were coming in */
+            first = now;
+        }
+        received += res;
+        calls++;
+    }
+    _print_rate("received", received, calls, (received) ? now - first : 0);
+    sock_udp_close(&sink_sock);
+
+    return 0;
+}
+
 void benchmark_udp_auto_init(void)
 {
     benchmark_udp_start(BENCH_SERVER_DEFAULT, BENCH_PORT_DEFAULT);
@@ -20,51 +20,189 @@
  * @}
  */
 
+#include <assert.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "atomic_utils.h"
 #include "irq.h"
+#include "stdio_base.h"
+#include "thread.h"
+#include "trace.h"
 #include "ztimer.h"
 
-#ifndef CONFIG_TRACE_BUFSIZE
-#define CONFIG_TRACE_BUFSIZE 512
+#ifdef MODULE_VFS
+#include <fcntl.h>
+#include "vfs.h"
 #endif
 
-typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+static_assert((CONFIG_TRACE_BUFSIZE & (CONFIG_TRACE_BUFSIZE - 1)) == 0,
+              "CONFIG_TRACE_BUFSIZE must be a power of two");
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+/* keep the compiler from moving record accesses across the sequence number
+ * updates that publish or invalidate the record */
+#define _barrier()  __asm__ volatile ("" : : : "memory")
+
+static trace_event_t tracebuf[CONFIG_TRACE_BUFSIZE];
+/* number of events recorded since boot */
+static uint32_t tracebuf_pos;
+/* number of events recorded before the last call to trace_reset() */
+static uint32_t tracebuf_start;
+
+#ifdef MODULE_TRACE_HOOKS
+uint32_t trace_hooks_mask;
+#endif
+
+void trace_event(trace_event_type_t type, uint32_t arg)
+{
+    uint32_t time = ztimer_now(ZTIMER_USEC);
+    uint32_t seq = atomic_fetch_add_u32(&tracebuf_pos, 1);
+    trace_event_t *e = &tracebuf[seq % CONFIG_TRACE_BUFSIZE];
+
+    /* invalidate the slot, so readers don't pick up a half written record */
+    atomic_store_u32(&e->seq, 0);
+    _barrier();
+    e->time = time;
+    e->arg = arg;
+    e->type = type;
+    e->flags = irq_is_in() ? TRACE_EVENT_FLAG_ISR : 0;
+    e->pid = thread_getpid();
+    _barrier();
+    atomic_store_u32(&e->seq, seq + 1);
+}
 
 void trace(uint32_t val)
 {
-    unsigned state = irq_disable();
+    trace_event(TRACE_EVENT_USER, val);
+}
 
-    tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = ztimer_now(ZTIMER_USEC), .val = val };
-    tracebuf_pos++;
-    irq_restore(state);
+static uint32_t _first(uint32_t end)
+{
+    uint32_t start = atomic_load_u32(&tracebuf_start);
+
+    return (end - start > CONFIG_TRACE_BUFSIZE) ? end - CONFIG_TRACE_BUFSIZE
+                                                : start;
+}
+
+static bool _read(uint32_t seq, trace_event_t *dst)
+{
+    const trace_event_t *e = &tracebuf[seq % CONFIG_TRACE_BUFSIZE];
+
+    if (atomic_load_u32(&e->seq) != seq + 1) {
+        return false;
+    }
+    _barrier();
+    *dst = *e;
+    _barrier();
+    /* the record may have been overwritten while copying it */
+    return atomic_load_u32(&e->seq) == seq + 1;
 }
 
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    uint32_t end = atomic_load_u32(&tracebuf_pos);
     uint32_t t_last = 0;
+    unsigned long n = 0;
+
+    for (uint32_t seq = _first(end); seq != end; seq++) {
+        trace_event_t e;
 
-    for (size_t i = 0; i < n; i++) {
-        printf("n=%4lu t=%s%8" PRIu32 " v=0x%08lx\n", (unsigned long)i,
-               i ? "+" : " ",
-               tracebuf[i].time - t_last, (unsigned long)tracebuf[i].val);
-        t_last = tracebuf[i].time;
+        if (!_read(seq, &e)) {
+            continue;
+        }
+        printf("n=%4lu t=%s%8" PRIu32 " v=0x%08lx", n, n ? "+" : " ",
+               e.time - t_last, (unsigned long)e.arg);
+        if (e.type != TRACE_EVENT_USER) {
+            printf(" e=%u pid=%d%s", e.type, e.pid,
+                   (e.flags & TRACE_EVENT_FLAG_ISR) ? " isr" : "");
+        }
+        puts("");
+        t_last = e.time;
+        n++;
     }
 }
 
 void trace_reset(void)
 {
-    unsigned state = irq_disable();
+    atomic_store_u32(&tracebuf_start, atomic_load_u32(&tracebuf_pos));
+}
+
+int trace_export(trace_export_cb_t cb, void *arg)
+{
+    uint32_t end = atomic_load_u32(&tracebuf_pos);
+    uint32_t first = _first(end);
+    trace_export_hdr_t hdr = {
+        .version = TRACE_EXPORT_VERSION,
+        .record_size = sizeof(trace_event_t),
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        .flags = TRACE_EXPORT_FLAG_BIG_ENDIAN,
+#endif
+        .numof = end - first,
+    };
+    int numof = 0;
+    int res;
+
+    memcpy(hdr.magic, TRACE_EXPORT_MAGIC, sizeof(hdr.magic));
+    if ((res = cb(arg, &hdr, sizeof(hdr))) < 0) {
+        return res;
+    }
+    for (uint32_t seq = first; seq != end; seq++) {
+        trace_event_t e;
+
+        if (_read(seq, &e)) {
+            numof++;
+        }
+        else {
+            memset(&e, 0, sizeof(e));
+        }
+        if ((res = cb(arg, &e, sizeof(e))) < 0) {
+            return res;
+        }
+    }
+    return numof;
+}
+
+static int _stdio_write(void *arg, const void *data, size_t len)
+{
+    (void)arg;
+    ssize_t res = stdio_write(data, len);
 
-    tracebuf_pos = 0;
-    irq_restore(state);
+    return (res < 0) ? res : 0;
 }
+
+int trace_export_stdio(void)
+{
+    return trace_export(_stdio_write, NULL);
+}
+
+#ifdef MODULE_VFS
+static int _vfs_write(void *arg, const void *data, size_t len)
+{
+    int fd = *(int *)arg;
+
+    while (len) {
+        ssize_t res = vfs_write(fd, data, len);
+
+        if (res < 0) {
+            return res;
+        }
+        data = (const uint8_t *)data + res;
+        len -= res;
+    }
+    return 0;
+}
+
+int trace_export_vfs(const char *path)
+{
+    int fd = vfs_open(path, O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    int res;
+
+    if (fd < 0) {
+        return fd;
+    }
+    res = trace_export(_vfs_write, &fd);
+    vfs_close(fd);
+    return res;
+}
+#endif
@@ -32,13 +32,18 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#include "ztimer/wheel.h"
 #include "log.h"
+#ifdef MODULE_TRACE_HOOKS
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static bool _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
@@ -50,6 +55,26 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 }
 #endif
 
+static inline ztimer_wheel_t *_wheel(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    return clock->wheel;
+#else
+    (void)clock;
+    return NULL;
+#endif
+}
+
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+static bool _is_empty(const ztimer_clock_t *clock)
+{
+    if (_wheel(clock)) {
+        return ztimer_wheel_is_empty(_wheel(clock));
+    }
+    return clock->list.next == NULL;
+}
+#endif
+
 #if MODULE_ZTIMER_ONDEMAND
 static bool _ztimer_acquire(ztimer_clock_t *clock)
 {
@@ -114,6 +139,11 @@ bool ztimer_release(ztimer_clock_t *clock)
 
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return t->base.pprev != NULL;
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -192,8 +222,10 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
-    if (clock->list.next == &timer->base) {
+    if (_add_entry_to_list(clock, &timer->base)) {
+        /* with a timing wheel, the clock might have to be armed for cascading
+         * timers earlier than the target of timer */
+        _next_offset(clock, &val);
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
             val = _min_u32(val, clock->max_value >> 1);
@@ -221,7 +253,7 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+static bool _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
     uint32_t delta_sum = 0;
 
@@ -229,12 +261,16 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
     /* First timer on the clock's linked list */
-    if (list->next == NULL &&
+    if (_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_block(clock->block_pm_mode);
     }
 #endif
 
+    if (_wheel(clock)) {
+        return ztimer_wheel_add(_wheel(clock), clock->list.offset, entry);
+    }
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -258,6 +294,7 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
 
+    return clock->list.next == entry;
 }
 
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
@@ -297,6 +334,12 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
 
+    if (_wheel(clock)) {
+        ztimer_wheel_advance(_wheel(clock), old_base, now);
+        clock->list.offset = now;
+        return now;
+    }
+
     ztimer_base_t *entry = clock->list.next;
 
     DEBUG(
@@ -343,32 +386,39 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
-        ztimer_base_t *list_entry = list->next;
-        if (list_entry == entry) {
-            if (entry == clock->last) {
-                /* if entry was the last timer, set the clocks last to the
-                 * previous entry, or NULL if that was the list ptr */
-                clock->last = (list == &clock->list) ? NULL : list;
-            }
+    if (_wheel(clock)) {
+        ztimer_wheel_del(_wheel(clock), entry);
+        was_removed = true;
+    }
+    else {
+        while (list->next) {
+            ztimer_base_t *list_entry = list->next;
+            if (list_entry == entry) {
+                if (entry == clock->last) {
+                    /* if entry was the last timer, set the clocks last to the
+                     * previous entry, or NULL if that was the list ptr */
+                    clock->last = (list == &clock->list) ? NULL : list;
+                }
 
-            list->next = entry->next;
-            if (list->next) {
-                list_entry = list->next;
-                list_entry->offset += entry->offset;
-            }
+                list->next = entry->next;
+                if (list->next) {
+                    list_entry = list->next;
+                    list_entry->offset += entry->offset;
+                }
 
-            was_removed = true;
-            /* reset the entry's next pointer so _is_set() considers it unset */
-            entry->next = NULL;
-            break;
+                was_removed = true;
+                /* reset the entry's next pointer so _is_set() considers it
+                 * unset */
+                entry->next = NULL;
+                break;
+            }
+            list = list->next;
         }
-        list = list->next;
     }
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
     /* The last timer just got removed from the clock's linked list */
-    if (clock->list.next == NULL &&
+    if (_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_unblock(clock->block_pm_mode);
     }
@@ -379,6 +429,17 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
 static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
+    if (_wheel(clock)) {
+        ztimer_base_t *entry = ztimer_wheel_pop_due(_wheel(clock));
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+        if (entry && _is_empty(clock) &&
+            clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            pm_unblock(clock->block_pm_mode);
+        }
+#endif
+        return (ztimer_t *)entry;
+    }
+
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
@@ -403,14 +464,27 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     }
 }
 
+static bool _next_offset(const ztimer_clock_t *clock, uint32_t *offset)
+{
+    if (_wheel(clock)) {
+        return ztimer_wheel_next(_wheel(clock), clock->list.offset, offset);
+    }
+    if (clock->list.next) {
+        *offset = clock->list.next->offset;
+        return true;
+    }
+    return false;
+}
+
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    uint32_t offset;
+    bool pending = _next_offset(clock, &offset);
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (pending) {
+            clock->ops->set(clock, _min_u32(offset, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -420,8 +494,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (pending) {
+            clock->ops->set(clock, offset);
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -446,7 +520,8 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 
 #if MODULE_ZTIMER_EXTEND || MODULE_ZTIMER_NOW64
-    if (IS_USED(MODULE_ZTIMER_NOW64) || clock->max_value < UINT32_MAX) {
+    if (!_wheel(clock) &&
+        (IS_USED(MODULE_ZTIMER_NOW64) || clock->max_value < UINT32_MAX)) {
         /* calling now triggers checkpointing */
         uint32_t now = ztimer_now(clock);
 
@@ -475,29 +550,37 @@ void ztimer_handler(ztimer_clock_t *clock)
     }
 #endif
 
-    if (clock->list.next) {
+    if (_wheel(clock)) {
+        /* the clock might as well have been armed for cascading timers into a
+         * lower level of the wheel, so only fire what actually expired */
+        _ztimer_update_head_offset(clock);
+    }
+    else if (clock->list.next) {
         clock->list.offset += clock->list.next->offset;
         clock->list.next->offset = 0;
+    }
 
-        ztimer_t *entry = _now_next(clock);
-        while (entry) {
-            DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
-                  (void *)entry, (void *)entry->base.next, clock->ops->now(
-                      clock));
-            entry->callback(entry->arg);
+    ztimer_t *entry = _now_next(clock);
+    while (entry) {
+        DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
+              (void *)entry, (void *)entry->base.next, clock->ops->now(
+                  clock));
+#ifdef MODULE_TRACE_HOOKS
+        trace_hook(TRACE_EVENT_ZTIMER_FIRE, (uintptr_t)entry->callback);
+#endif
+        entry->callback(entry->arg);
 #if MODULE_ZTIMER_ONDEMAND
-            no_clock_user_left = ztimer_release(clock);
-            if (no_clock_user_left) {
-                break;
-            }
+        no_clock_user_left = ztimer_release(clock);
+        if (no_clock_user_left) {
+            break;
+        }
 #endif
+        entry = _now_next(clock);
+        if (!entry) {
+            /* See if any more alarms expired during callback processing */
+            /* This reduces the number of implicit calls to clock->ops->now() */
+            _ztimer_update_head_offset(clock);
             entry = _now_next(clock);
-            if (!entry) {
-                /* See if any more alarms expired during callback processing */
-                /* This reduces the number of implicit calls to clock->ops->now() */
-                _ztimer_update_head_offset(clock);
-                entry = _now_next(clock);
-            }
         }
     }
 
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timing wheel implementation
+ *
+ * Timers are stored with their absolute target. A timer is put into the level
+ * of the highest group of @ref CONFIG_ZTIMER_WHEEL_BITS bits in which its
+ * target differs from the current position of the wheel, and into the slot
+ * given by that group of its target. Thus all timers of level `n` share the
+ * upper bits with the current position, and the slots of level `n` are
+ * reached in order. Once the position reaches a slot of a level > 0, the
+ * slot's timers are cascaded into lower levels. Timers of level 0 are expired
+ * once their slot is reached.
+ *
+ * Targets that wrap around 2^32 (i.e. are numerically lower than the position)
+ * are always put into the topmost level, whose slots are treated as a ring.
+ *
+ * Inside a slot, timers are kept in a singly linked list whose entries point
+ * back to the link pointing to them (`pprev`), so that they can be unlinked in
+ * constant time.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bitarithm.h"
+#include "irq.h"
+#include "ztimer.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define BITS        CONFIG_ZTIMER_WHEEL_BITS
+#define MASK        (ZTIMER_WHEEL_SLOTS - 1)
+#define TOP         (ZTIMER_WHEEL_LEVELS - 1)
+
+static_assert((BITS >= 1) && (BITS <= 4),
+              "CONFIG_ZTIMER_WHEEL_BITS must be between 1 and 4");
+
+static inline unsigned _shift(unsigned level)
+{
+    return level * BITS;
+}
+
+static inline unsigned _slot(uint32_t time, unsigned level)
+{
+    return (time >> _shift(level)) & MASK;
+}
+
+static void _link(ztimer_base_t **pprev, ztimer_base_t *entry)
+{
+    entry->next = *pprev;
+    if (entry->next) {
+        entry->next->pprev = &entry->next;
+    }
+    entry->pprev = pprev;
+    *pprev = entry;
+}
+
+static void _append_due(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    entry->next = NULL;
+    entry->pprev = wheel->due_tail;
+    *wheel->due_tail = entry;
+    wheel->due_tail = &entry->next;
+}
+
+static unsigned _level(uint32_t now, uint32_t target)
+{
+    if (target < now) {
+        /* target lies beyond the wrap around of the position */
+        return TOP;
+    }
+
+    uint32_t diff = (target ^ now) >> BITS;
+    unsigned level = 0;
+
+    while (diff) {
+        diff >>= BITS;
+        level++;
+    }
+
+    return level;
+}
+
+static void _insert(ztimer_wheel_t *wheel, uint32_t now, ztimer_base_t *entry)
+{
+    uint32_t target = entry->offset;
+
+    if (target == now) {
+        _append_due(wheel, entry);
+        return;
+    }
+
+    unsigned level = _level(now, target);
+    unsigned slot = _slot(target, level);
+
+    _link(&wheel->slots[level][slot], entry);
+    wheel->occupied[level] |= 1U << slot;
+}
+
+/* returns the level and slot of the next event, and the offset to it */
+static bool _next(const ztimer_wheel_t *wheel, uint32_t now, uint32_t *offset,
+                  unsigned *level_out, unsigned *slot_out)
+{
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned occupied = wheel->occupied[level];
+        if (!occupied) {
+            continue;
+        }
+
+        unsigned cur = _slot(now, level);
+        /* slots after the current one are reached first */
+        unsigned later = occupied & ~((2U << cur) - 1);
+
+        /* lower levels always have their events before higher levels, but
+         * only the topmost level wraps around */
+        assert(later || (level == TOP));
+        unsigned slot = bitarithm_lsb(later ? later : occupied);
+
+        /* start of the slot: clear all lower groups and set this one */
+        uint32_t start = now;
+        if (_shift(level + 1) < 32) {
+            start &= ~((UINT32_C(1) << _shift(level + 1)) - 1);
+        }
+        else {
+            start = 0;
+        }
+        start |= (uint32_t)slot << _shift(level);
+
+        *offset = start - now;
+        *level_out = level;
+        *slot_out = slot;
+        return true;
+    }
+
+    return false;
+}
+
+void ztimer_wheel_attach(ztimer_clock_t *clock, ztimer_wheel_t *wheel)
+{
+    unsigned state = irq_disable();
+
+    assert(!clock->list.next);
+
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        for (unsigned slot = 0; slot < ZTIMER_WHEEL_SLOTS; slot++) {
+            wheel->slots[level][slot] = NULL;
+        }
+        wheel->occupied[level] = 0;
+    }
+    wheel->due = NULL;
+    wheel->due_tail = &wheel->due;
+
+    clock->wheel = wheel;
+
+    irq_restore(state);
+}
+
+bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel)
+{
+    if (wheel->due) {
+        return false;
+    }
+    for (unsigned level = 0; level < ZTIMER_WHEEL_LEVELS; level++) {
+        if (wheel->occupied[level]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, uint32_t now,
+                      ztimer_base_t *entry)
+{
+    uint32_t before, after;
+    bool had_next = ztimer_wheel_next(wheel, now, &before);
+
+    /* from now on, offset holds the absolute target */
+    entry->offset += now;
+    _insert(wheel, now, entry);
+
+    /* the next event might also be cascading the slot entry went into */
+    ztimer_wheel_next(wheel, now, &after);
+    bool earliest = !had_next || (after < before);
+
+    DEBUG("ztimer_wheel_add(): %p target %" PRIu32 "%s\n", (void *)entry,
+          entry->offset, earliest ? " (earliest)" : "");
+
+    return earliest;
+}
+
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    ztimer_base_t **pprev = entry->pprev;
+
+    assert(pprev);
+
+    *pprev = entry->next;
+    if (entry->next) {
+        entry->next->pprev = pprev;
+    }
+    else if (wheel->due_tail == &entry->next) {
+        wheel->due_tail = pprev;
+    }
+
+    /* if entry was the first of a slot, pprev points into the slot array */
+    uintptr_t first = (uintptr_t)&wheel->slots[0][0];
+    uintptr_t link = (uintptr_t)pprev;
+    if ((link >= first) && (link < first + sizeof(wheel->slots)) && !*pprev) {
+        unsigned idx = (link - first) / sizeof(ztimer_base_t *);
+        wheel->occupied[idx / ZTIMER_WHEEL_SLOTS] &=
+            ~(1U << (idx % ZTIMER_WHEEL_SLOTS));
+    }
+
+    entry->next = NULL;
+    entry->pprev = NULL;
+}
+
+bool ztimer_wheel_next(const ztimer_wheel_t *wheel, uint32_t now,
+                       uint32_t *offset)
+{
+    unsigned level, slot;
+
+    if (wheel->due) {
+        *offset = 0;
+        return true;
+    }
+
+    return _next(wheel, now, offset, &level, &slot);
+}
+
+void ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t from, uint32_t to)
+{
+    uint32_t elapsed = to - from;
+    uint32_t next;
+    unsigned level, slot;
+
+    while (_next(wheel, from, &next, &level, &slot) && (next <= elapsed)) {
+        from += next;
+        elapsed -= next;
+
+        ztimer_base_t *entry = wheel->slots[level][slot];
+        wheel->slots[level][slot] = NULL;
+        wheel->occupied[level] &= ~(1U << slot);
+
+        DEBUG("ztimer_wheel_advance(): %s level %u slot %u at %" PRIu32 "\n",
+              level ? "cascading" : "expiring", level, slot, from);
+
+        while (entry) {
+            ztimer_base_t *tmp = entry->next;
+            /* level 0 slots only hold timers with target == from, which
+             * _insert() puts into the list of expired timers */
+            _insert(wheel, from, entry);
+            entry = tmp;
+        }
+    }
+}
+
+ztimer_base_t *ztimer_wheel_pop_due(ztimer_wheel_t *wheel)
+{
+    ztimer_base_t *entry = wheel->due;
+
+    if (entry) {
+        ztimer_wheel_del(wheel, entry);
+    }
+
+    return entry;
+}
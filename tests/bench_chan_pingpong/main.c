@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure slots passed through a bulk channel per second
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include "macros/units.h"
+#include "timex.h"
+#include "thread.h"
+#include "clk.h"
+
+#include "chan.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#define FLAG_CHAN           (1u << 0)
+#define SEQ_STOP            UINT32_MAX
+
+typedef struct {
+    uint32_t seq;
+    uint8_t payload[28];
+} slot_t;
+
+static const unsigned _batches[] = { 1, 8 };
+
+static slot_t _ping_slots[16];
+static slot_t _pong_slots[2];
+static chan_t _ping = CHAN_INIT(_ping_slots);
+static chan_t _pong = CHAN_INIT(_pong_slots);
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+
+static void _timer_callback(void *flag)
+{
+    atomic_flag_clear(flag);
+}
+
+static void *_second_thread(void *arg)
+{
+    unsigned batch = (uintptr_t)arg;
+
+    chan_attach_thread(&_ping, FLAG_CHAN, batch);
+
+    while (1) {
+        unsigned numof = batch;
+        slot_t *in = chan_read_wait(&_ping, &numof);
+        uint32_t seq = in[numof - 1].seq;
+
+        chan_read_commit(&_ping, numof);
+        if (seq == SEQ_STOP) {
+            break;
+        }
+        if (chan_avail(&_ping) > 0) {
+            /* rest of a batch that wrapped around the end of the ring */
+            continue;
+        }
+
+        numof = 1;
+        slot_t *out = chan_write_reserve(&_pong, &numof);
+        out->seq = seq;
+        chan_write_commit(&_pong, 1);
+    }
+
+    return NULL;
+}
+
+static void _send(uint32_t seq)
+{
+    unsigned numof = 1;
+    slot_t *slot = chan_write_reserve(&_ping, &numof);
+
+    slot->seq = seq;
+    chan_write_commit(&_ping, 1);
+}
+
+static void _run(unsigned batch)
+{
+    thread_create(_stack, sizeof(_stack), (THREAD_PRIORITY_MAIN - 1),
+                  THREAD_CREATE_STACKTEST | THREAD_CREATE_AFFINITY(2),
+                  _second_thread,
+                  (void *)(uintptr_t)batch, "second_thread");
+
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    uint32_t n = 0;
+
+    ztimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+
+    atomic_flag_test_and_set(&flag);
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        /* one slot at a time, the receiver is woken at the last one */
+        for (unsigned i = 0; i < batch; i++) {
+            _send(n++);
+        }
+
+        unsigned numof = 1;
+        chan_read_wait(&_pong, &numof);
+        chan_read_commit(&_pong, numof);
+    }
+
+    _send(SEQ_STOP);
+    chan_flush(&_ping);
+
+    printf("{ \"batch\" : %u", batch);
+    printf(", \"result\" : %"PRIu32, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    chan_attach_thread(&_pong, FLAG_CHAN, 1);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_batches); i++) {
+        _run(_batches[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       IPv6 forwarding benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "byteorder.h"
+#include "iolist.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#define FLOWS               (4U)
+#define PAYLOAD_LEN         (16U)
+#define PAYLOAD_BYTE        ('x')
+#define HOP_LIMIT           (64U)
+#define LOCAL_MAC           { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 }
+#define NBR_MAC             { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 }
+#define NBR_LINK_LOCAL      { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00 }
+#define SRC                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01, \
+                              0x02, 0xca, 0x4b, 0xef, 0xf4, 0xc2, 0xde, 0x01 }
+#define DST_PFX             { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd }
+#define DST_PFX_LEN         (64U)
+#define FRAME_LEN           (sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + \
+                             PAYLOAD_LEN)
+
+static gnrc_netif_t _netif;
+static netdev_test_t _mock_netdev;
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static const uint8_t _local_mac[] = LOCAL_MAC;
+static const uint8_t _nbr_mac[] = NBR_MAC;
+static const ipv6_addr_t _nbr_link_local = { .u8 = NBR_LINK_LOCAL };
+static const ipv6_addr_t _src = { .u8 = SRC };
+static const ipv6_addr_t _dst_pfx = { .u8 = DST_PFX };
+
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+static uint8_t _frame[FRAME_LEN];
+static size_t _frame_len;
+static unsigned _next_flow;
+static unsigned _mismatches;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_mac));
+    memcpy(value, _local_mac, sizeof(_local_mac));
+    return sizeof(_local_mac);
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t len = 0;
+
+    (void)dev;
+    for (const iolist_t *iol = iolist; iol != NULL; iol = iol->iol_next) {
+        if ((len + iol->iol_len) > sizeof(_frame)) {
+            /* ignore anything the stack sends on its own */
+            return iolist_size(iolist);
+        }
+        memcpy(&_frame[len], iol->iol_base, iol->iol_len);
+        len += iol->iol_len;
+    }
+    if ((len == FRAME_LEN) && (_frame[len - 1] == PAYLOAD_BYTE)) {
+        _frame_len = len;
+        mutex_unlock(&_sent);
+    }
+    return iolist_size(iolist);
+}
+
+static void _flow_dst(unsigned flow, ipv6_addr_t *dst)
+{
+    *dst = _dst_pfx;
+    dst->u8[15] = flow + 1;
+}
+
+static void _forward(void)
+{
+    gnrc_pktsnip_t *netif_hdr, *pkt;
+    ipv6_hdr_t *hdr;
+    uint8_t expected[FRAME_LEN];
+    ethernet_hdr_t *eth_hdr = (ethernet_hdr_t *)expected;
+
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    expect(netif_hdr != NULL);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pktbuf_add(netif_hdr, NULL, sizeof(ipv6_hdr_t) + PAYLOAD_LEN,
+                          GNRC_NETTYPE_IPV6);
+    expect(pkt != NULL);
+    hdr = pkt->data;
+    hdr->v_tc_fl = byteorder_htonl(0x60000000);
+    hdr->len = byteorder_htons(PAYLOAD_LEN);
+    hdr->nh = PROTNUM_IPV6_NONXT;
+    hdr->hl = HOP_LIMIT;
+    hdr->src = _src;
+    _flow_dst(_next_flow, &hdr->dst);
+    memset(hdr + 1, PAYLOAD_BYTE, PAYLOAD_LEN);
+    if (++_next_flow == FLOWS) {
+        _next_flow = 0;
+    }
+
+    /* the frame to the neighbor carries the packet with decremented hop
+     * limit */
+    memcpy(eth_hdr->dst, _nbr_mac, sizeof(eth_hdr->dst));
+    memcpy(eth_hdr->src, _local_mac, sizeof(eth_hdr->src));
+    eth_hdr->type = byteorder_htons(ETHERTYPE_IPV6);
+    memcpy(eth_hdr + 1, hdr, sizeof(ipv6_hdr_t) + PAYLOAD_LEN);
+    ((ipv6_hdr_t *)(eth_hdr + 1))->hl--;
+
+    expect(gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                        GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 1);
+    mutex_lock(&_sent);
+    if ((_frame_len != sizeof(expected)) ||
+        (memcmp(_frame, expected, sizeof(expected)) != 0)) {
+        _mismatches++;
+    }
+}
+
+int main(void)
+{
+    printf("IPv6 forwarding benchmark (forwarding cache %s)\n",
+           IS_USED(MODULE_GNRC_IPV6_FWD_CACHE) ? "on" : "off");
+
+    netdev_test_setup(&_mock_netdev, 0);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_DEVICE_TYPE,
+                           _get_device_type);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_mock_netdev, _netdev_send);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mockup_eth",
+                                      &_mock_netdev.netdev.netdev) == 0);
+
+    /* route the destination prefix via a neighbor */
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_link_local, _netif.pid, _nbr_mac,
+                                sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_dst_pfx, DST_PFX_LEN, &_nbr_link_local,
+                                _netif.pid, 0) == 0);
+
+    printf("Forwarding %u flows\n", FLOWS);
+    BENCHMARK_FUNC("forward", BENCH_RUNS, _forward());
+
+    if (_mismatches > 0) {
+        printf("%u frames differ from the expected frame\n", _mismatches);
+        puts("[FAILED]");
+        return 1;
+    }
+#if IS_USED(MODULE_GNRC_IPV6_FWD_CACHE)
+    const gnrc_ipv6_fwd_cache_stats_t *stats = gnrc_ipv6_fwd_cache_stats();
+
+    printf("cache hits: %lu, misses: %lu\n", (unsigned long)stats->hits,
+           (unsigned long)stats->misses);
+    if ((FLOWS <= CONFIG_GNRC_IPV6_FWD_CACHE_SIZE) && (stats->misses != FLOWS)) {
+        puts("expected one miss per flow");
+        puts("[FAILED]");
+        return 1;
+    }
+#endif
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB next hop lookup benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "container.h"
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#ifndef RUNS
+#define RUNS    (10000UL)
+#endif
+
+/* numbers of neighbors the benchmark is run with */
+static const unsigned _neighbors[] = { 16, 128, 512 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _mock_netdev;
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static unsigned _numof;
+static unsigned _next;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+/* neighbor i has the link-local address fe80::200:ff:fe00:<i> and the
+ * link-layer address 02:00:00:00:<i> */
+static void _neighbor(unsigned i, ipv6_addr_t *addr, uint8_t *l2addr)
+{
+    ipv6_addr_set_link_local_prefix(addr);
+    addr->u8[8] = 0x02;
+    addr->u8[9] = 0x00;
+    addr->u8[10] = 0x00;
+    addr->u8[11] = 0xff;
+    addr->u8[12] = 0xfe;
+    addr->u8[13] = 0x00;
+    addr->u8[14] = i >> 8;
+    addr->u8[15] = i & 0xff;
+
+    l2addr[0] = 0x02;
+    l2addr[1] = 0x00;
+    l2addr[2] = 0x00;
+    l2addr[3] = 0x00;
+    l2addr[4] = i >> 8;
+    l2addr[5] = i & 0xff;
+}
+
+static void _lookup(void)
+{
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+    gnrc_ipv6_nib_nc_t nce;
+
+    _neighbor(_next, &addr, l2addr);
+    if (++_next == _numof) {
+        _next = 0;
+    }
+    int res = gnrc_ipv6_nib_get_next_hop_l2addr(&addr, &_netif, NULL, &nce);
+    expect(res == 0);
+    expect(memcmp(nce.l2addr, l2addr, sizeof(l2addr)) == 0);
+}
+
+static void _run(unsigned numof)
+{
+    char name[24];
+    ipv6_addr_t addr;
+    uint8_t l2addr[ETHERNET_ADDR_LEN];
+
+    for (unsigned i = 0; i < numof; i++) {
+        _neighbor(i, &addr, l2addr);
+        expect(gnrc_ipv6_nib_nc_set(&addr, _netif.pid, l2addr,
+                                    sizeof(l2addr)) == 0);
+    }
+
+    _numof = numof;
+    _next = 0;
+    snprintf(name, sizeof(name), "%u neighbors", numof);
+    BENCHMARK_FUNC(name, RUNS, _lookup());
+
+    for (unsigned i = 0; i < numof; i++) {
+        _neighbor(i, &addr, l2addr);
+        gnrc_ipv6_nib_nc_del(&addr, _netif.pid);
+    }
+}
+
+int main(void)
+{
+    puts("NIB next hop lookup benchmark.");
+
+    netdev_test_setup(&_mock_netdev, 0);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_DEVICE_TYPE,
+                           _get_device_type);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mockup_eth",
+                                      &_mock_netdev.netdev.netdev) == 0);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_neighbors); i++) {
+        if (_neighbors[i] > CONFIG_GNRC_IPV6_NIB_NUMOF) {
+            break;
+        }
+        _run(_neighbors[i]);
+    }
+
+    puts("done.");
+    return 0;
+}
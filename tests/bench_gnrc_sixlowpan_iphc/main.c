@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN header compression benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "iolist.h"
+#include "mutex.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/udp.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#define PAYLOAD_LEN         (32U)
+#define PAYLOAD_BYTE        ('x')
+#define PORT                (61616U)
+#define MAX_FRAME_LEN       (127U)
+#define REMOTE_EUI64        { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+
+static gnrc_netif_t _netif;
+static netdev_test_t _mock_netdev;
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static const uint8_t _local_eui64[] = { 0x02, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01 };
+static const uint8_t _remote_eui64[] = REMOTE_EUI64;
+
+static mutex_t _sent = MUTEX_INIT_LOCKED;
+static uint8_t _frame[MAX_FRAME_LEN];
+static uint8_t _first_frame[MAX_FRAME_LEN];
+static size_t _frame_len;
+static size_t _first_frame_len;
+static unsigned _mismatches;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = MAX_FRAME_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_local_eui64);
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_eui64));
+    memcpy(value, _local_eui64, sizeof(_local_eui64));
+    return sizeof(_local_eui64);
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t len = 0;
+
+    (void)dev;
+    /* skip the MAC header, its sequence number changes with every frame */
+    for (const iolist_t *iol = iolist->iol_next; iol != NULL; iol = iol->iol_next) {
+        if ((len + iol->iol_len) > sizeof(_frame)) {
+            return -ENOBUFS;
+        }
+        memcpy(&_frame[len], iol->iol_base, iol->iol_len);
+        len += iol->iol_len;
+    }
+    /* ignore anything the stack sends on its own */
+    if ((len >= PAYLOAD_LEN) && (_frame[len - 1] == PAYLOAD_BYTE) &&
+        (_frame[len - PAYLOAD_LEN] == PAYLOAD_BYTE)) {
+        _frame_len = len;
+        mutex_unlock(&_sent);
+    }
+    return iolist_size(iolist);
+}
+
+static void _send(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                  const uint8_t *dst_l2addr, uint8_t dst_l2addr_len)
+{
+    gnrc_pktsnip_t *payload, *udp, *ipv6, *netif_hdr;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, PAYLOAD_LEN, GNRC_NETTYPE_UNDEF);
+    expect(payload != NULL);
+    memset(payload->data, PAYLOAD_BYTE, PAYLOAD_LEN);
+    udp = gnrc_udp_hdr_build(payload, PORT, PORT);
+    expect(udp != NULL);
+    ipv6 = gnrc_ipv6_hdr_build(udp, src, dst);
+    expect(ipv6 != NULL);
+    ((ipv6_hdr_t *)ipv6->data)->nh = PROTNUM_UDP;
+    ((ipv6_hdr_t *)ipv6->data)->hl = 64;
+    ((ipv6_hdr_t *)ipv6->data)->len = byteorder_htons(gnrc_pkt_len(udp));
+    expect(gnrc_udp_calc_csum(udp, ipv6) == 0);
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, dst_l2addr, dst_l2addr_len);
+    expect(netif_hdr != NULL);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    if (dst_l2addr_len == 0) {
+        ((gnrc_netif_hdr_t *)netif_hdr->data)->flags |= GNRC_NETIF_HDR_FLAGS_MULTICAST;
+    }
+    netif_hdr->next = ipv6;
+
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, netif_hdr) == 1);
+    mutex_lock(&_sent);
+    if (_first_frame_len == 0) {
+        memcpy(_first_frame, _frame, _frame_len);
+        _first_frame_len = _frame_len;
+    }
+    else if ((_frame_len != _first_frame_len) ||
+             (memcmp(_frame, _first_frame, _frame_len) != 0)) {
+        _mismatches++;
+    }
+}
+
+static void _flow_done(void)
+{
+    _first_frame_len = 0;
+}
+
+int main(void)
+{
+    static const ipv6_addr_t prefix = { { 0x20, 0x01, 0x0d, 0xb8 } };
+    ipv6_addr_t local_ll = IPV6_ADDR_UNSPECIFIED;
+    ipv6_addr_t local_global = prefix;
+    ipv6_addr_t remote_ll = IPV6_ADDR_UNSPECIFIED;
+    ipv6_addr_t remote_global = prefix;
+    ipv6_addr_t all_nodes;
+
+    printf("6LoWPAN IPHC benchmark (header cache %s)\n",
+           IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) ? "on" : "off");
+
+    netdev_test_setup(&_mock_netdev, 0);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_ADDRESS_LONG,
+                           _get_address_long);
+    netdev_test_set_send_cb(&_mock_netdev, _netdev_send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _mock_netif_stack,
+                                        sizeof(_mock_netif_stack),
+                                        GNRC_NETIF_PRIO, "mockup_wpan",
+                                        &_mock_netdev.netdev.netdev) == 0);
+
+    /* addresses derived from the link-layer addresses are elided completely */
+    ipv6_addr_set_link_local_prefix(&local_ll);
+    expect(gnrc_netif_ipv6_get_iid(&_netif, (eui64_t *)&local_ll.u64[1]) == 0);
+    local_global.u64[1] = local_ll.u64[1];
+    ipv6_addr_set_link_local_prefix(&remote_ll);
+    expect(gnrc_netif_ipv6_iid_from_addr(&_netif, _remote_eui64,
+                                         sizeof(_remote_eui64),
+                                         (eui64_t *)&remote_ll.u64[1]) == 0);
+    remote_global.u64[1] = remote_ll.u64[1];
+    ipv6_addr_set_all_nodes_multicast(&all_nodes, IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+    expect(gnrc_sixlowpan_ctx_update(0, &prefix, 64, UINT16_MAX, true) != NULL);
+
+    BENCHMARK_FUNC("link-local", BENCH_RUNS,
+                   _send(&local_ll, &remote_ll, _remote_eui64, sizeof(_remote_eui64)));
+    _flow_done();
+    BENCHMARK_FUNC("global", BENCH_RUNS,
+                   _send(&local_global, &remote_global, _remote_eui64,
+                         sizeof(_remote_eui64)));
+    _flow_done();
+    BENCHMARK_FUNC("multicast", BENCH_RUNS,
+                   _send(&local_ll, &all_nodes, NULL, 0));
+    _flow_done();
+
+    if (_mismatches > 0) {
+        printf("%u frames differ from the first frame of their flow\n",
+               _mismatches);
+        puts("[FAILED]");
+        return 1;
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"6LoWPAN IPHC benchmark \(header cache (on|off)\)\r\n")
+    for _ in range(3):
+        child.expect(r"\s+\w+: +\d+us +--- +\d+\.\d+us per call +--- +\d+ calls per sec\r\n")
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP bulk transfer throughput benchmark application
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define CHUNK_SIZE      (1024U)
+
+static gnrc_tcp_tcb_t _tcb;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t _chunk[CHUNK_SIZE];
+
+static void _print_rate(const char *cmd, const char *action, size_t bytes,
+                        uint32_t duration)
+{
+    printf("%s: %s %u bytes in %" PRIu32 " ms (%" PRIu32 " B/s)\n",
+           cmd, action, (unsigned)bytes, duration,
+           duration ? (uint32_t)((uint64_t)bytes * MS_PER_SEC / duration) : 0);
+}
+
+static int _bench_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("bench: invalid endpoint");
+        return 1;
+    }
+    size_t total = strtoul(argv[2], NULL, 10);
+
+    gnrc_tcp_tcb_init(&_tcb);
+    int res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("bench: open failed: %d\n", res);
+        return 1;
+    }
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    size_t sent = 0;
+    while (sent < total) {
+        size_t len = (total - sent < CHUNK_SIZE) ? total - sent : CHUNK_SIZE;
+        ssize_t n = gnrc_tcp_send(&_tcb, _chunk, len, 0);
+        if (n < 0) {
+            printf("bench: send failed: %d\n", (int)n);
+            gnrc_tcp_abort(&_tcb);
+            return 1;
+        }
+        sent += n;
+    }
+    /* returns once all data and the FIN were acknowledged */
+    gnrc_tcp_close(&_tcb);
+    uint32_t duration = ztimer_now(ZTIMER_MSEC) - start;
+
+    _print_rate(argv[0], "sent", sent, duration);
+    return 0;
+}
+
+static int _bench_recv_cmd(int argc, char **argv)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+
+    if (argc < 2) {
+        printf("usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, atoi(argv[1]), 0);
+
+    gnrc_tcp_tcb_init(&_tcb);
+    int res = gnrc_tcp_listen(&_queue, &_tcb, 1, &local);
+    if (res < 0) {
+        printf("bench_recv: listen failed: %d\n", res);
+        return 1;
+    }
+    puts("bench_recv: listening");
+    res = gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT);
+    if (res < 0) {
+        printf("bench_recv: accept failed: %d\n", res);
+        gnrc_tcp_stop_listen(&_queue);
+        return 1;
+    }
+
+    /* receive until the peer closes the connection */
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+    size_t received = 0;
+    ssize_t n;
+    while ((n = gnrc_tcp_recv(tcb, _chunk, sizeof(_chunk), GNRC_TCP_NO_TIMEOUT)) > 0) {
+        received += n;
+    }
+    uint32_t duration = ztimer_now(ZTIMER_MSEC) - start;
+    gnrc_tcp_close(tcb);
+    gnrc_tcp_stop_listen(&_queue);
+
+    if (n < 0) {
+        printf("bench_recv: recv failed: %d\n", (int)n);
+        return 1;
+    }
+    _print_rate(argv[0], "received", received, duration);
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "bench", "send bytes to a TCP server and report the throughput",
+      _bench_cmd },
+    { "bench_recv", "receive from a TCP client until it closes and report the goodput",
+      _bench_recv_cmd },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    printf("GNRC TCP throughput benchmark, %u segments in flight, "
+           "%u segments out of order\n",
+           CONFIG_GNRC_TCP_RTX_QUEUE_SIZE, CONFIG_GNRC_TCP_OOO_QUEUE_SIZE);
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+    return 0;
+}
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import subprocess
+import sys
+import threading
+
+from testrunner import run
+
+TOTAL_BYTES = 64 * 1024
+PORT = 61616
+
+
+def _host_interface():
+    # Use the bridge if the tap device is part of one
+    tap = os.environ["TAPDEV"]
+    bridge = re.search('master (.*) state',
+                       os.popen('bridge link show dev {}'.format(tap)).read())
+    return bridge.group(1).strip() if bridge else tap
+
+
+def _host_address():
+    result = os.popen('ip addr show dev {} scope link'.format(_host_interface())).read()
+    return re.search('inet6 (.*)/64', result).group(1).strip()
+
+
+def _riot_address(child):
+    child.sendline('ifconfig')
+    child.expect(r'inet6 addr: (fe80:[0-9a-f:]+)\s')
+    return child.match.group(1)
+
+
+def _receive(sock, result):
+    conn, _ = sock.accept()
+    received = 0
+    while True:
+        data = conn.recv(4096)
+        if not data:
+            break
+        received += len(data)
+    conn.close()
+    result.append(received)
+
+
+def _send_to_riot(address, result):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.connect((address, PORT, 0, socket.if_nametoindex(_host_interface())))
+    sock.sendall(bytes(TOTAL_BYTES))
+    sock.close()
+    result.append(TOTAL_BYTES)
+
+
+def test_send(child, segments):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(('::', PORT))
+    sock.listen(1)
+    result = []
+    receiver = threading.Thread(target=_receive, args=(sock, result))
+    receiver.start()
+
+    child.sendline('bench [{}]:{} {}'.format(_host_address(), PORT, TOTAL_BYTES))
+    child.expect(r'bench: sent (\d+) bytes in (\d+) ms \((\d+) B/s\)')
+    assert int(child.match.group(1)) == TOTAL_BYTES
+    rate = child.match.group(3)
+
+    receiver.join()
+    sock.close()
+    assert result == [TOTAL_BYTES]
+    print('\n{{ "segments in flight": {}, "throughput": {} }}'.format(segments, rate))
+
+
+def test_recv(child, segments):
+    loss = os.environ.get('LOSS', '0')
+    address = _riot_address(child)
+    child.sendline('bench_recv {}'.format(PORT))
+    child.expect_exact('bench_recv: listening')
+
+    # Drop segments the host sends to RIOT
+    tap = os.environ["TAPDEV"]
+    subprocess.check_call(['tc', 'qdisc', 'add', 'dev', tap, 'root', 'netem',
+                           'loss', '{}%'.format(loss)])
+    try:
+        result = []
+        sender = threading.Thread(target=_send_to_riot, args=(address, result))
+        sender.start()
+        child.expect(r'bench_recv: received (\d+) bytes in (\d+) ms \((\d+) B/s\)')
+        sender.join()
+    finally:
+        subprocess.call(['tc', 'qdisc', 'del', 'dev', tap, 'root'])
+    assert int(child.match.group(1)) == TOTAL_BYTES
+    assert result == [TOTAL_BYTES]
+    print('\n{{ "segments out of order": {}, "loss": {}, "goodput": {} }}'
+          .format(segments, loss, child.match.group(3)))
+
+
+def testfunc(child):
+    child.expect(r'GNRC TCP throughput benchmark, (\d+) segments in flight, '
+                 r'(\d+) segments out of order')
+    test_send(child, child.match.group(1))
+    test_recv(child, child.match.group(2))
+
+
+if __name__ == '__main__':
+    sys.exit(run(testfunc, timeout=120))
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       UDP burst receive benchmark application
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "iolist.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "schedstatistics.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (1000U)
+#endif
+
+#define PAYLOAD_LEN     (32U)
+#define PORT            (61616U)
+#define FRAME_LEN       (sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + \
+                         sizeof(udp_hdr_t) + PAYLOAD_LEN)
+#define MAIN_QUEUE_SIZE (32U)
+
+/* numbers of frames the device reports per interrupt */
+static const unsigned _bursts[] = { 1, 4, 8, 16 };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _mock_netdev;
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+
+static uint8_t _frame[FRAME_LEN];
+static unsigned _burst;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    /* drop whatever the stack sends on its own, e.g. router solicitations */
+    return iolist_size(iolist);
+}
+
+static int _netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf != NULL) {
+        if ((unsigned)len < sizeof(_frame)) {
+            return -ENOBUFS;
+        }
+        memcpy(buf, _frame, sizeof(_frame));
+    }
+    return sizeof(_frame);
+}
+
+static void _netdev_isr(netdev_t *dev)
+{
+    /* the device drained its receive FIFO in one go */
+    for (unsigned i = 0; i < _burst; i++) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+/* UDP datagram from fe80::2 to ff02::1 */
+static void _init_frame(void)
+{
+    ethernet_hdr_t *eth = (ethernet_hdr_t *)_frame;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(eth + 1);
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint8_t *payload = (uint8_t *)(udp + 1);
+    const uint16_t udp_len = sizeof(udp_hdr_t) + PAYLOAD_LEN;
+    uint16_t csum;
+
+    memcpy(eth->dst, (uint8_t []){ 0x33, 0x33, 0x00, 0x00, 0x00, 0x01 },
+           ETHERNET_ADDR_LEN);
+    memcpy(eth->src, (uint8_t []){ 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 },
+           ETHERNET_ADDR_LEN);
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    ipv6_addr_set_link_local_prefix(&ipv6->src);
+    ipv6->src.u8[15] = 2;
+    ipv6_addr_set_all_nodes_multicast(&ipv6->dst, IPV6_ADDR_MCAST_SCP_LINK_LOCAL);
+
+    udp->src_port = byteorder_htons(PORT);
+    udp->dst_port = byteorder_htons(PORT);
+    udp->length = byteorder_htons(udp_len);
+    udp->checksum = byteorder_htons(0);
+    memset(payload, 'x', PAYLOAD_LEN);
+
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, udp_len);
+    csum = ~inet_csum(csum, (uint8_t *)udp, udp_len);
+    udp->checksum = byteorder_htons((csum == 0) ? 0xffff : csum);
+}
+
+static unsigned _schedules(void)
+{
+    unsigned schedules = 0;
+
+    for (unsigned i = 0; i <= KERNEL_PID_LAST; i++) {
+        schedules += sched_pidlist[i].schedules;
+    }
+    return schedules;
+}
+
+static unsigned _receive(void)
+{
+    msg_t msg;
+
+    msg_receive(&msg);
+    switch (msg.type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            gnrc_pktbuf_release(msg.content.ptr);
+            return 1;
+#ifdef MODULE_GNRC_NETAPI_BATCH
+        case GNRC_NETAPI_MSG_TYPE_RCV_BATCH: {
+            unsigned numof = gnrc_netapi_batch_numof(msg.content.ptr);
+
+            for (unsigned i = 0; i < numof; i++) {
+                gnrc_pktbuf_release(gnrc_netapi_batch_get(msg.content.ptr, i));
+            }
+            gnrc_pktbuf_release(msg.content.ptr);
+            return numof;
+        }
+#endif
+        default:
+            return 0;
+    }
+}
+
+static void _run(unsigned burst)
+{
+    const unsigned packets = ROUNDS * burst;
+    uint32_t start, duration;
+    unsigned schedules;
+
+    _burst = burst;
+    schedules = _schedules();
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        unsigned received = 0;
+
+        netdev_trigger_event_isr(&_mock_netdev.netdev.netdev);
+        while (received < burst) {
+            received += _receive();
+        }
+    }
+    duration = ztimer_now(ZTIMER_USEC) - start;
+    schedules = _schedules() - schedules;
+
+    printf("  burst of %2u: %" PRIu32 " packets/s --- %u.%02u context switches "
+           "per packet\n", burst,
+           (uint32_t)(((uint64_t)packets * US_PER_SEC) / duration),
+           schedules / packets, ((schedules % packets) * 100) / packets);
+}
+
+int main(void)
+{
+#ifdef MODULE_GNRC_NETAPI_BATCH
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID_BATCH(PORT,
+                                                              thread_getpid());
+#else
+    gnrc_netreg_entry_t me = GNRC_NETREG_ENTRY_INIT_PID(PORT, thread_getpid());
+#endif
+
+    printf("UDP burst benchmark (batching %s).\n",
+           IS_USED(MODULE_GNRC_NETAPI_BATCH) ? "on" : "off");
+
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    _init_frame();
+    netdev_test_setup(&_mock_netdev, 0);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_DEVICE_TYPE,
+                           _get_device_type);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_mock_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_mock_netdev, _netdev_send);
+    netdev_test_set_recv_cb(&_mock_netdev, _netdev_recv);
+    netdev_test_set_isr_cb(&_mock_netdev, _netdev_isr);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      sizeof(_mock_netif_stack),
+                                      GNRC_NETIF_PRIO, "mockup_eth",
+                                      &_mock_netdev.netdev.netdev) == 0);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &me);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_bursts); i++) {
+        _run(_bursts[i]);
+    }
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare the Internet checksum to a byte-wise implementation
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "net/inet_csum.h"
+#include "random.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#ifndef FUZZ_RUNS
+#define FUZZ_RUNS           (10000UL)
+#endif
+
+#ifndef BUF_SIZE
+#define BUF_SIZE            (1280U)
+#endif
+
+/* offset of the IPv6 destination address in a packet */
+#define ADDR_OFFSET         (24U)
+#define ADDR_SIZE           (16U)
+
+static uint32_t _buf_words[(BUF_SIZE + 8) / sizeof(uint32_t)];
+static uint8_t *const _buf = (uint8_t *)_buf_words;
+static uint8_t _addrs[2][ADDR_SIZE];
+static unsigned _addr_idx;
+static volatile uint16_t _sink;
+
+/* inet_csum_slice() as it was before adding up words */
+static uint16_t _scalar(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+static int _fuzz(void)
+{
+    for (unsigned long i = 0; i < FUZZ_RUNS; i++) {
+        unsigned offset = random_uint32_range(0, 8);
+        uint16_t len = random_uint32_range(0, BUF_SIZE + 1);
+        uint16_t sum = random_uint32();
+        size_t accum_len = random_uint32();
+        uint8_t *buf = _buf + offset;
+
+        switch (i % 4) {
+        case 0:
+            /* sums up to the one's complement zero */
+            memset(buf, 0xff, len);
+            break;
+        case 1:
+            memset(buf, 0, len);
+            break;
+        default:
+            random_bytes(buf, len);
+            break;
+        }
+
+        uint16_t expected = _scalar(sum, buf, len, accum_len);
+        uint16_t result = inet_csum_slice(sum, buf, len, accum_len);
+
+        if (result != expected) {
+            printf("FAILED: offset %u, len %" PRIu16 ", sum 0x%04" PRIx16
+                   ", accum_len %lu: 0x%04" PRIx16 " != 0x%04" PRIx16 "\n",
+                   offset, len, sum, (unsigned long)accum_len, result, expected);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void _rewrite_recalculate(void)
+{
+    _addr_idx ^= 1;
+    memcpy(&_buf[ADDR_OFFSET], _addrs[_addr_idx], ADDR_SIZE);
+    _sink = ~inet_csum(0, _buf, BUF_SIZE);
+}
+
+static void _rewrite_update(void)
+{
+    _addr_idx ^= 1;
+    _sink = inet_csum_update(_sink, &_buf[ADDR_OFFSET], _addrs[_addr_idx], ADDR_SIZE,
+                             ADDR_OFFSET);
+    memcpy(&_buf[ADDR_OFFSET], _addrs[_addr_idx], ADDR_SIZE);
+}
+
+int main(void)
+{
+    puts("Internet checksum benchmark\n");
+
+    printf("Comparing to scalar implementation for %lu random buffers: ",
+           (unsigned long)FUZZ_RUNS);
+    if (_fuzz() < 0) {
+        puts("\n[FAILED]");
+        return 1;
+    }
+    puts("OK\n");
+
+    random_bytes(_buf, BUF_SIZE + 1);
+    random_bytes(_addrs, sizeof(_addrs));
+
+    printf("Checksumming %u bytes\n", BUF_SIZE);
+    BENCHMARK_FUNC("scalar", BENCH_RUNS, _sink = _scalar(0, _buf, BUF_SIZE, 0));
+    BENCHMARK_FUNC("inet_csum", BENCH_RUNS, _sink = inet_csum(0, _buf, BUF_SIZE));
+    BENCHMARK_FUNC("inet_csum unaligned", BENCH_RUNS,
+                   _sink = inet_csum(0, _buf + 1, BUF_SIZE));
+
+    puts("Checksumming 40 bytes");
+    BENCHMARK_FUNC("scalar", BENCH_RUNS * 10, _sink = _scalar(0, _buf, 40, 0));
+    BENCHMARK_FUNC("inet_csum", BENCH_RUNS * 10, _sink = inet_csum(0, _buf, 40));
+
+    printf("Rewriting an IPv6 address in %u bytes\n", BUF_SIZE);
+    BENCHMARK_FUNC("recalculate", BENCH_RUNS, _rewrite_recalculate());
+    BENCHMARK_FUNC("inet_csum_update", BENCH_RUNS * 10, _rewrite_update());
+    uint16_t expected = ~inet_csum(0, _buf, BUF_SIZE);
+    if (_sink != expected) {
+        puts("inet_csum_update() doesn't match the recalculated checksum");
+        puts("[FAILED]");
+        return 1;
+    }
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
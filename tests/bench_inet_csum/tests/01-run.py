@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 60
+BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
+
+
+def testfunc(child):
+    child.expect_exact('Internet checksum benchmark')
+    child.expect(r'Comparing to scalar implementation for \d+ random buffers: OK',
+                 timeout=TIMEOUT)
+    child.expect(r'Checksumming \d+ bytes')
+    for func in ["scalar", "inet_csum", "inet_csum unaligned"]:
+        child.expect(BENCHMARK_REGEXP.format(func=func), timeout=TIMEOUT)
+    child.expect_exact('Checksumming 40 bytes')
+    for func in ["scalar", "inet_csum"]:
+        child.expect(BENCHMARK_REGEXP.format(func=func), timeout=TIMEOUT)
+    child.expect(r'Rewriting an IPv6 address in \d+ bytes')
+    for func in ["recalculate", "inet_csum_update"]:
+        child.expect(BENCHMARK_REGEXP.format(func=func), timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure messages passed through a mailbox per second
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include "macros/units.h"
+#include "timex.h"
+#include "thread.h"
+#include "clk.h"
+
+#include "mbox.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+#define MBOX_SIZE           (8)
+#define TYPE_STOP           (0xffff)
+
+static msg_t _queue[MBOX_SIZE];
+static mbox_t _mbox = MBOX_INIT(_queue, MBOX_SIZE);
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+
+static void _timer_callback(void *flag)
+{
+    atomic_flag_clear(flag);
+}
+
+static void *_second_thread(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        msg_t msg;
+        mbox_get(&_mbox, &msg);
+        if (msg.type == TYPE_STOP) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static void _print(const char *mode, uint32_t n)
+{
+    printf("{ \"mode\" : \"%s\"", mode);
+    printf(", \"result\" : %"PRIu32, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
+static void _run(bool handoff)
+{
+    if (handoff) {
+        thread_create(_stack, sizeof(_stack), (THREAD_PRIORITY_MAIN - 1),
+                      THREAD_CREATE_STACKTEST | THREAD_CREATE_AFFINITY(2),
+                      _second_thread, NULL, "second_thread");
+    }
+
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    uint32_t n = 0;
+
+    ztimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+
+    atomic_flag_test_and_set(&flag);
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        msg_t msg = { .type = 0, .content.value = n };
+
+        mbox_put(&_mbox, &msg);
+        if (!handoff) {
+            mbox_get(&_mbox, &msg);
+        }
+        n++;
+    }
+
+    if (handoff) {
+        msg_t msg = { .type = TYPE_STOP };
+        mbox_put(&_mbox, &msg);
+    }
+
+    _print(handoff ? "handoff" : "queued", n);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    _run(false);
+    _run(true);
+
+    return 0;
+}
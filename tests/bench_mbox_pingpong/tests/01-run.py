@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for mode in ("queued", "handoff"):
+        child.expect(r"{ \"mode\" : \"%s\", \"result\" : \d+(, \"ticks\" : \d+)? }"
+                     % mode)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -58,7 +58,8 @@ int main(void)
     kernel_pid_t other = thread_create(_stack,
                                        sizeof(_stack),
                                        (THREAD_PRIORITY_MAIN - 1),
-                                       THREAD_CREATE_STACKTEST,
+                                       THREAD_CREATE_STACKTEST
+                                       | THREAD_CREATE_AFFINITY(2),
                                        _second_thread,
                                        NULL,
                                        "second_thread");
@@ -59,7 +59,8 @@ int main(void)
     thread_create(_stack,
                   sizeof(_stack),
                   THREAD_PRIORITY_MAIN - 1,
-                  THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST,
+                  THREAD_CREATE_WOUT_YIELD | THREAD_CREATE_STACKTEST
+                  | THREAD_CREATE_AFFINITY(2),
                   _second_thread,
                   NULL,
                   "second_thread");
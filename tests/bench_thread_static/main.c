@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure thread creation with and without static descriptors
+ *
+ * @}
+ */
+
+#include <stdalign.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "thread.h"
+#include "thread_static.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10UL * 1000UL)
+#endif
+
+#define THREADS_NUMOF       (4)
+#define THREADS_PRIO        (THREAD_PRIORITY_MAIN - 1)
+#define THREADS_STACKSIZE   (THREAD_STACKSIZE_SMALL)
+
+static void *_nop(void *arg)
+{
+    (void)arg;
+    return NULL;
+}
+
+/* created by the kernel at boot */
+THREAD_STATIC_MSG(boot_a, THREADS_STACKSIZE, THREADS_PRIO,
+                  THREAD_CREATE_SLEEPING, _nop, NULL, 4);
+THREAD_STATIC_MSG(boot_b, THREADS_STACKSIZE, THREADS_PRIO,
+                  THREAD_CREATE_SLEEPING, _nop, NULL, 4);
+
+static alignas(void *) char _dyn_stacks[THREADS_NUMOF][THREADS_STACKSIZE];
+
+static thread_t _static_tcbs[THREADS_NUMOF];
+static alignas(void *) char _static_stacks[THREADS_NUMOF][THREADS_STACKSIZE];
+
+#define DESC(i) { \
+        .thread = &_static_tcbs[i], \
+        .stack = _static_stacks[i], \
+        .stack_size = THREADS_STACKSIZE, \
+        .priority = THREADS_PRIO, \
+        .flags = THREAD_CREATE_WOUT_YIELD, \
+        .function = _nop, \
+        .name = "static", \
+}
+
+static const thread_static_t _descs[THREADS_NUMOF] = {
+    DESC(0), DESC(1), DESC(2), DESC(3),
+};
+
+static void _create_dynamic(void)
+{
+    for (unsigned i = 0; i < THREADS_NUMOF; i++) {
+        thread_create(_dyn_stacks[i], sizeof(_dyn_stacks[i]), THREADS_PRIO,
+                      THREAD_CREATE_WOUT_YIELD, _nop, NULL, "dynamic");
+    }
+    /* let them exit */
+    thread_yield_higher();
+}
+
+static void _create_static(void)
+{
+    thread_static_create(_descs, THREADS_NUMOF);
+    /* let them exit */
+    thread_yield_higher();
+}
+
+static int _check_boot(kernel_pid_t pid)
+{
+    thread_t *thread = thread_get(pid);
+
+    return thread && (thread_get_status(thread) == STATUS_SLEEPING)
+           && thread_has_msg_queue(thread);
+}
+
+int main(void)
+{
+    puts("Thread creation benchmark\n");
+
+    if (!_check_boot(THREAD_STATIC_PID(boot_a))
+        || !_check_boot(THREAD_STATIC_PID(boot_b))) {
+        puts("threads declared statically were not created at boot");
+        puts("[FAILED]");
+        return 1;
+    }
+
+    BENCHMARK_FUNC("thread_create() x4", BENCH_RUNS, _create_dynamic());
+    BENCHMARK_FUNC("thread_static_create() x4", BENCH_RUNS, _create_static());
+
+    puts("\n[SUCCESS]");
+    return 0;
+}
@@ -22,9 +22,14 @@
 
 #include "test_utils/expect.h"
 
+#include "container.h"
 #include "msg.h"
+#include "mutex.h"
 #include "thread.h"
 #include "ztimer.h"
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 
 #ifndef ZTIMER
 #define ZTIMER ZTIMER_MSEC
@@ -46,8 +51,27 @@
 #define SPREAD  (10LU)
 #endif
 
+/* ticks of ZTIMER until the timers of the fire() benchmarks expire */
+#ifndef FIRE_DELAY
+#define FIRE_DELAY  (100LU)
+#endif
+
 static ztimer_t _timers[NUMOF_TIMERS];
 
+#if MODULE_ZTIMER_WHEEL
+static ztimer_wheel_t _wheel;
+#endif
+
+/* numbers of concurrently set timers the scaling benchmarks are run with */
+static const unsigned _concurrent[] = { 10, 100, 1000 };
+
+/* state of the fire() benchmarks */
+static mutex_t _fired_lock = MUTEX_INIT_LOCKED;
+static unsigned _fired;
+static unsigned _fire_numof;
+static uint32_t _fire_first;
+static uint32_t _fire_last;
+
 /* This variable is set by any timer that actually triggers.  As the test is
  * only testing set/remove/now operations, timers are not supposed to trigger.
  * Thus, after every test there's an 'expect(!_triggers)'
@@ -67,6 +91,21 @@ static void _callback(void *arg) {
     *triggers += 1;
 }
 
+static void _fire_callback(void *arg)
+{
+    (void)arg;
+
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    if (_fired++ == 0) {
+        _fire_first = now;
+    }
+    _fire_last = now;
+    if (_fired == _fire_numof) {
+        mutex_unlock(&_fired_lock);
+    }
+}
+
 /* returns the interval for timer 'n' that has to be set in order to insert it
  * into position n */
 static uint32_t _timer_val(unsigned n)
@@ -91,10 +130,60 @@ static void _print_result(const char *desc, unsigned n, uint32_t total)
     printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
 }
 
+/* set, remove and fire numof concurrently set timers */
+static void _bench_concurrent(unsigned numof, uint32_t start)
+{
+    char desc[32];
+    uint32_t before, diff;
+
+    /* set with targets in random order to not favor the list */
+    before = ztimer_now(ZTIMER_USEC);
+    _base = BASE  - (before - start);
+    for (unsigned n = 0; n < numof; n++) {
+        _timer_set((n * 7919U) % numof);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    snprintf(desc, sizeof(desc), "set() %u concurrent", numof);
+    _print_result(desc, numof, diff);
+    expect(!_triggers);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < numof; n++) {
+        _timer_remove((n * 7919U) % numof);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    snprintf(desc, sizeof(desc), "remove() %u concurrent", numof);
+    _print_result(desc, numof, diff);
+    expect(!_triggers);
+
+    /* let all timers expire at the same tick, the time from the first to the
+     * last callback is what firing the timers costs */
+    _fired = 0;
+    _fire_numof = numof;
+    uint32_t target = ztimer_now(ZTIMER) + FIRE_DELAY;
+    for (unsigned n = 0; n < numof; n++) {
+        int32_t remaining = target - ztimer_now(ZTIMER);
+        _timers[n].callback = _fire_callback;
+        ztimer_set(ZTIMER, &_timers[n], remaining > 0 ? remaining : 0);
+    }
+    mutex_lock(&_fired_lock);
+    snprintf(desc, sizeof(desc), "fire() %u concurrent", numof);
+    _print_result(desc, numof, _fire_last - _fire_first);
+
+    for (unsigned n = 0; n < numof; n++) {
+        _timers[n].callback = _callback;
+    }
+}
+
 int main(void)
 {
     puts("ztimer benchmark application.\n");
 
+#if MODULE_ZTIMER_WHEEL
+    ztimer_wheel_attach(ZTIMER, &_wheel);
+    puts("using timing wheel");
+#endif
+
     unsigned n;
     uint32_t before, diff, start;
 
@@ -290,6 +379,16 @@ int main(void)
 
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
+    /*
+     * test set / remove / fire with increasing numbers of timers
+     *
+     */
+    for (unsigned i = 0; i < ARRAY_SIZE(_concurrent); i++) {
+        if (_concurrent[i] <= NUMOF_TIMERS) {
+            _bench_concurrent(_concurrent[i], start);
+        }
+    }
+
     puts("done.");
 
     return 0;
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Priority event queue and coalescing event test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "event/coalesce.h"
+#include "event/prio.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define STACKSIZE   THREAD_STACKSIZE_DEFAULT
+#define PRIO        (THREAD_PRIORITY_MAIN - 1)
+
+static char stack[STACKSIZE];
+
+static char order[8];
+static unsigned handled;
+
+static void prio_handler(event_t *event)
+{
+    event_prio_t *ev = container_of(event, event_prio_t, super);
+
+    order[handled++] = '0' + ev->level;
+}
+
+static event_prio_t ev_a = EVENT_PRIO_INIT(prio_handler, 3);
+static event_prio_t ev_b = EVENT_PRIO_INIT(prio_handler, 1);
+static event_prio_t ev_c = EVENT_PRIO_INIT(prio_handler, 0);
+static event_prio_t ev_d = EVENT_PRIO_INIT(prio_handler, 1);
+static event_prio_t ev_e = EVENT_PRIO_INIT(prio_handler, 3);
+
+static event_prio_queue_t prio_queue;
+
+static unsigned coalesced;
+static unsigned coalesce_calls;
+
+static void coalesce_handler(event_t *event)
+{
+    event_coalesce_t *ev = container_of(event, event_coalesce_t, super);
+
+    coalesced += event_coalesce_take(ev);
+    coalesce_calls++;
+}
+
+static event_coalesce_t ev_coalesce = EVENT_COALESCE_INIT(coalesce_handler);
+static event_queue_t queue;
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+
+    event_prio_queue_claim(&prio_queue);
+
+    while (handled < 3) {
+        event_prio_t *ev = event_prio_wait(&prio_queue);
+        ev->super.handler(&ev->super);
+    }
+    return NULL;
+}
+
+static void _test_order(void)
+{
+    event_prio_queue_init(&prio_queue);
+
+    event_prio_post(&prio_queue, &ev_a);
+    event_prio_post(&prio_queue, &ev_b);
+    event_prio_post(&prio_queue, &ev_c);
+    event_prio_post(&prio_queue, &ev_d);
+    event_prio_post(&prio_queue, &ev_e);
+    /* reposting a queued event has no effect */
+    event_prio_post(&prio_queue, &ev_b);
+
+    event_prio_t *ev;
+    while ((ev = event_prio_get(&prio_queue))) {
+        ev->super.handler(&ev->super);
+    }
+    order[handled] = '\0';
+    printf("order: %s\n", order);
+    expect(handled == 5);
+    /* levels drained highest first, FIFO within a level */
+    expect(order[0] == '0' && order[1] == '1' && order[2] == '1');
+}
+
+static void _test_cancel(void)
+{
+    handled = 0;
+    event_prio_post(&prio_queue, &ev_a);
+    event_prio_post(&prio_queue, &ev_b);
+    event_prio_post(&prio_queue, &ev_d);
+    event_prio_post(&prio_queue, &ev_e);
+
+    /* head, tail and only element of a level */
+    event_prio_cancel(&prio_queue, &ev_b);
+    event_prio_cancel(&prio_queue, &ev_e);
+    event_prio_cancel(&prio_queue, &ev_d);
+    /* not queued */
+    event_prio_cancel(&prio_queue, &ev_c);
+
+    expect(event_prio_get(&prio_queue) == &ev_a);
+    expect(event_prio_get(&prio_queue) == NULL);
+    expect(prio_queue.pending == 0);
+    puts("cancel: ok");
+}
+
+int main(void)
+{
+    puts("event_prio test");
+
+    _test_order();
+    _test_cancel();
+
+    /* blocking wait, by a thread of higher priority that preempts main on
+     * every post */
+    handled = 0;
+    event_prio_queue_init_detached(&prio_queue);
+    thread_create(stack, sizeof(stack), PRIO, THREAD_CREATE_STACKTEST,
+                  _thread, NULL, "event_prio");
+
+    event_prio_post(&prio_queue, &ev_e);
+    event_prio_post(&prio_queue, &ev_c);
+    event_prio_post(&prio_queue, &ev_b);
+    expect(handled == 3);
+    puts("wait: ok");
+
+    /* a burst posted before the event is handled takes a single call */
+    event_queue_init(&queue);
+    for (unsigned i = 0; i < 10; i++) {
+        event_coalesce_post(&queue, &ev_coalesce);
+    }
+    event_t *ev;
+    while ((ev = event_get(&queue))) {
+        ev->handler(ev);
+    }
+    event_coalesce_post(&queue, &ev_coalesce);
+    while ((ev = event_get(&queue))) {
+        ev->handler(ev);
+    }
+
+    printf("coalesce: %u posts in %u calls\n", coalesced, coalesce_calls);
+    expect((coalesced == 11) && (coalesce_calls == 2));
+
+    puts("[SUCCESS]");
+    return 0;
+}
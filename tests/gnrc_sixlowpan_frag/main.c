@@ -220,6 +220,12 @@ static void _test_entry(const gnrc_sixlowpan_frag_rb_t *entry,
                         unsigned exp_current_size,
                         unsigned exp_int_start, unsigned exp_int_end)
 {
+    const unsigned exp_first_unit = (exp_int_start +
+                                     GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE - 1) /
+                                    GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+    const unsigned exp_last_unit = exp_int_end /
+                                   GNRC_SIXLOWPAN_FRAG_RB_UNIT_SIZE;
+
     TEST_ASSERT_NOT_NULL(entry);
     TEST_ASSERT_NOT_NULL(entry->pkt);
     TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE, entry->pkt->size);
@@ -235,10 +241,13 @@ static void _test_entry(const gnrc_sixlowpan_frag_rb_t *entry,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
-    TEST_ASSERT_NOT_NULL(entry->super.ints);
-    TEST_ASSERT_NULL(entry->super.ints->next);
-    TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints->start);
-    TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints->end);
+    /* only one fragment spanning the expected interval was received */
+    TEST_ASSERT_EQUAL_INT(1, bf_popcnt(entry->super.starts,
+                                       GNRC_SIXLOWPAN_FRAG_RB_UNITS));
+    TEST_ASSERT(bf_isset(entry->super.starts, exp_first_unit));
+    TEST_ASSERT_EQUAL_INT(exp_last_unit - exp_first_unit + 1,
+                          bf_popcnt(entry->super.received,
+                                    GNRC_SIXLOWPAN_FRAG_RB_UNITS));
 }
 
 static void _check_pktbuf(const gnrc_sixlowpan_frag_rb_t *entry)
@@ -536,6 +545,92 @@ static void test_rbuf_add__overlap_rhs(void)
     _check_pktbuf(NULL);
 }
 
+static void test_rbuf_add__overlap_inner(void)
+{
+    static const size_t pkt3_offset = TEST_FRAGMENT2_OFFSET + 8U;
+    static const size_t pkt3_size = sizeof(_fragment3) - 16U;
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt3;
+    const gnrc_sixlowpan_frag_rb_t *rbuf;
+    unsigned rbuf_entries = 0;
+
+    /* fragment 3 lies completely within fragment 2 */
+    _set_fragment_offset(_fragment3, pkt3_offset);
+    pkt3 = gnrc_pktbuf_add(NULL, _fragment3, pkt3_size,
+                           GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt2, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        ));
+    TEST_ASSERT_NOT_NULL(pkt3);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt3, pkt3_offset, TEST_PAGE
+        ));
+    rbuf = gnrc_sixlowpan_frag_rb_array();
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        const gnrc_sixlowpan_frag_rb_t *entry = &rbuf[i];
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(entry)) {
+            const size_t frag_size = pkt3_size - sizeof(sixlowpan_frag_n_t);
+
+            rbuf_entries++;
+            /* it is not a duplicate, so only _fragment3 should now be in the
+             * reassembly buffer according to
+             * https://tools.ietf.org/html/rfc4944#section-5.3 */
+            _test_entry(entry, frag_size, (unsigned)pkt3_offset,
+                        (unsigned)(pkt3_offset + frag_size - 1));
+            /* releasing pkt to check if packet buffer is empty in the end */
+            gnrc_pktbuf_release(entry->pkt);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(1U, rbuf_entries);
+    _check_pktbuf(NULL);
+}
+
+static void test_rbuf_add__interleaved_datagrams(void)
+{
+    const gnrc_sixlowpan_frag_rb_t *entries[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+
+    /* receive the fragments of all datagrams in turns */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _set_fragment_tag(_fragment2, TEST_TAG + i);
+        pkt = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_NOT_NULL((entries[i] = gnrc_sixlowpan_frag_rb_add(
+                &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+            )));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(entries[i] != entries[j]);
+        }
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _set_fragment_tag(_fragment3, TEST_TAG + i);
+        pkt = gnrc_pktbuf_add(NULL, _fragment3, sizeof(_fragment3),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT(entries[i] == gnrc_sixlowpan_frag_rb_add(
+                &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT3_OFFSET, TEST_PAGE
+            ));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT(entries[i] == gnrc_sixlowpan_frag_rb_get_by_datagram(
+                &_test_netif_hdr.hdr, TEST_TAG + i
+            ));
+        TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT4_OFFSET - TEST_FRAGMENT2_OFFSET,
+                              entries[i]->super.current_size);
+        TEST_ASSERT_EQUAL_INT(2, bf_popcnt(entries[i]->super.starts,
+                                           GNRC_SIXLOWPAN_FRAG_RB_UNITS));
+        /* releasing pkt to check if packet buffer is empty in the end */
+        gnrc_pktbuf_release(entries[i]->pkt);
+    }
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_get_by_dg(void)
 {
     const gnrc_sixlowpan_frag_rb_t *entry;
@@ -650,6 +745,8 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__too_big_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
         new_TestFixture(test_rbuf_add__overlap_rhs),
+        new_TestFixture(test_rbuf_add__overlap_inner),
+        new_TestFixture(test_rbuf_add__interleaved_datagrams),
         new_TestFixture(test_rbuf_get_by_dg),
         new_TestFixture(test_rbuf_exists),
         new_TestFixture(test_rbuf_rm_by_dg),
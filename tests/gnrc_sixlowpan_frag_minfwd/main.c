@@ -813,8 +813,8 @@ static void test_sixlo_recv__1st_frag_uncomp(void)
     TEST_ASSERT_EQUAL_INT(TEST_1ST_FRAG_UNCOMP_SIZE,
                           vrbe->super.current_size);
     /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    TEST_ASSERT_EQUAL_INT(1, bf_popcnt(vrbe->super.starts,
+                                       GNRC_SIXLOWPAN_FRAG_RB_UNITS));
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     _check_1st_frag_uncomp(mhr_len, 1U);
 }
@@ -938,8 +938,8 @@ static void test_sixlo_recv__1st_frag_comp(void)
     TEST_ASSERT_EQUAL_INT(TEST_1ST_FRAG_COMP_FRAG_SIZE,
                           vrbe->super.current_size);
     /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    TEST_ASSERT_EQUAL_INT(1, bf_popcnt(vrbe->super.starts,
+                                       GNRC_SIXLOWPAN_FRAG_RB_UNITS));
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     TEST_ASSERT_MESSAGE(
             memcmp(&_test_1st_frag_comp[TEST_1ST_FRAG_COMP_PAYLOAD_POS],
@@ -989,8 +989,8 @@ static void test_sixlo_recv__1st_frag_comp__only_iphc(void)
     TEST_ASSERT_EQUAL_INT(TEST_1ST_FRAG_COMP_ONLY_IPHC_FRAG_SIZE,
                           vrbe->super.current_size);
     /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    TEST_ASSERT_EQUAL_INT(1, bf_popcnt(vrbe->super.starts,
+                                       GNRC_SIXLOWPAN_FRAG_RB_UNITS));
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     TEST_ASSERT_MESSAGE(
             memcmp(&_test_1st_frag_comp[TEST_1ST_FRAG_COMP_PAYLOAD_POS],
@@ -1033,8 +1033,8 @@ static void test_sixlo_recv__1st_frag_comp__only_iphc_no_nhc(void)
     _check_vrbe_values(vrbe, mhr_len, FIRST_FRAGMENT);
     TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAG1_SIZE, vrbe->super.current_size);
     /* only the received fragment is registered */
-    TEST_ASSERT_NOT_NULL(vrbe->super.ints);
-    TEST_ASSERT_NULL(vrbe->super.ints->next);
+    TEST_ASSERT_EQUAL_INT(1, bf_popcnt(vrbe->super.starts,
+                                       GNRC_SIXLOWPAN_FRAG_RB_UNITS));
     TEST_ASSERT(_target_buf[0] & IEEE802154_FCF_FRAME_PEND);
     TEST_ASSERT_MESSAGE(
             memcmp(&_test_send_frag1[TEST_SEND_FRAG1_PAYLOAD_POS],
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "container.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -512,6 +513,90 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_ep_t result[2];
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 8, .remote = &result[0] },
+        { .data = _test_buffer + 8, .len = 8, .remote = &result[1] },
+        { .data = _test_buffer + 16, .len = 8, .remote = NULL },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EF", sizeof("EF"),
+                          _TEST_NETIF));
+    expect(2 == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                    SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == msgs[0].len);
+    expect(0 == memcmp("ABCD", msgs[0].data, sizeof("ABCD")));
+    expect(sizeof("EF") == msgs[1].len);
+    expect(0 == memcmp("EF", msgs[1].data, sizeof("EF")));
+    for (unsigned i = 0; i < ARRAY_SIZE(result); i++) {
+        expect(AF_INET6 == result[i].family);
+        expect(memcmp(&result[i].addr, &src_addr, sizeof(result[i].addr)) == 0);
+        expect(_TEST_PORT_REMOTE == result[i].port);
+        expect(_TEST_NETIF == result[i].netif);
+    }
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_batch__drop(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t wrong_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = 8, .remote = NULL },
+        { .data = _test_buffer + 8, .len = 8, .remote = NULL },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    /* neither from the remote of the sock nor fitting into the buffer */
+    expect(_inject_packet(&wrong_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCDEFGHIJ", sizeof("ABCDEFGHIJ"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EF", sizeof("EF"),
+                          _TEST_NETIF));
+    expect(1 == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                    SOCK_NO_TIMEOUT));
+    expect(sizeof("EF") == msgs[0].len);
+    expect(0 == memcmp("EF", msgs[0].data, sizeof("EF")));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_batch__ETIMEDOUT(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_msg_t msgs[] = {
+        { .data = _test_buffer, .len = sizeof(_test_buffer), .remote = NULL },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-ETIMEDOUT == sock_udp_recv_batch(&_sock, msgs, ARRAY_SIZE(msgs),
+                                             _TEST_TIMEOUT));
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -679,6 +764,34 @@ static void test_sock_udp_sendv__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    const sock_udp_msg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD"), .remote = NULL },
+        { .data = "EF", .len = sizeof("EF"), .remote = NULL },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_batch(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EF", sizeof("EF"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -849,6 +962,9 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_batch__socketed());
+    CALL(test_sock_udp_recv_batch__drop());
+    CALL(test_sock_udp_recv_batch__ETIMEDOUT());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -860,6 +976,7 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_sendv__socketed());
+    CALL(test_sock_udp_send_batch__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
@@ -12,20 +12,24 @@
  *
  * @file
  * @brief       Test application for checking whether malloc is thread-safe
+ *              and benchmark of concurrent allocations
  *
  * @author      Marian Buschsieweke <marian.buschsieweke@ovgu.de>
  * @}
  */
 
 #include <errno.h>
+#include <inttypes.h>
 #include <stdint.h>
 /* keep stdatomic.h after stdint.h for buggy toolchains */
 #include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "architecture.h"
 #include "clist.h"
+#include "kernel_defines.h"
 #include "sched.h"
 #include "test_utils/expect.h"
 #include "thread.h"
@@ -35,23 +39,40 @@
 #include <malloc.h>
 #endif
 
+/* the per-thread caches are a frontend of the thread safe malloc wrappers */
+#define THREAD_CACHE    (IS_USED(MODULE_MALLOC_THREAD_CACHE) && \
+                         IS_USED(MODULE_MALLOC_THREAD_SAFE))
+
+#if THREAD_CACHE
+#include "malloc_thread_cache.h"
+#endif
+
+#define TEST_DURATION_MS    (2 * MS_PER_SEC)
+
 static char WORD_ALIGNED t1_stack[THREAD_STACKSIZE_SMALL];
 static char WORD_ALIGNED t2_stack[THREAD_STACKSIZE_SMALL];
 static atomic_uint_least8_t is_running = ATOMIC_VAR_INIT(1);
+/* rounds completed by t1 and t2 */
+static uint32_t rounds[2];
 
 void * t1_t2_malloc_func(void *arg)
 {
-    (void)arg;
+    uint32_t *round = arg;
+
     while (atomic_load(&is_running)) {
         int *chunk1 = malloc(sizeof(int) * 1);
         int *chunk2 = malloc(sizeof(int) * 2);
         int *chunk3 = malloc(sizeof(int) * 4);
         int *chunk4 = malloc(sizeof(int) * 8);
-        expect(chunk1 && chunk2 && chunk3 && chunk4);
+        /* the C library may allocate this without calling malloc() */
+        char *str = strdup("RIOT");
+        expect(chunk1 && chunk2 && chunk3 && chunk4 && str);
         free(chunk1);
         free(chunk2);
         free(chunk3);
         free(chunk4);
+        free(str);
+        (*round)++;
     }
 
     return NULL;
@@ -59,7 +80,8 @@ void * t1_t2_malloc_func(void *arg)
 
 void * t1_t2_realloc_func(void *arg)
 {
-    (void)arg;
+    uint32_t *round = arg;
+
     while (atomic_load(&is_running)) {
         int *chunk = realloc(NULL, sizeof(int) * 1);
         expect(chunk);
@@ -76,11 +98,27 @@ void * t1_t2_realloc_func(void *arg)
         chunk = realloc(chunk, sizeof(int) * 8);
         expect(chunk);
         free(chunk);
+        (*round)++;
     }
 
     return NULL;
 }
 
+static void _print_stats(const char *name, kernel_pid_t pid, uint32_t round)
+{
+    printf("  %s: %" PRIu32 " rounds", name, round);
+#if THREAD_CACHE
+    malloc_thread_cache_stats_t stats;
+
+    malloc_thread_cache_stats(pid, &stats);
+    printf(", cache hits: %" PRIu32 ", refills: %" PRIu32 ", drains: %"
+           PRIu32, stats.hits, stats.refills, stats.drains);
+#else
+    (void)pid;
+#endif
+    puts("");
+}
+
 int main(void)
 {
     kernel_pid_t t1, t2;
@@ -94,7 +132,10 @@ int main(void)
         "threads gets scheduled. Eventually, this should yield to memory\n"
         "corruption unless proper guards are in place preventing them. After\n"
         "ca. two seconds without crash, the test is considered as passing.\n"
+        "The number of rounds completed by each thread is reported as a\n"
+        "benchmark of contended allocations.\n"
     );
+    printf("Per-thread malloc caches: %s\n\n", THREAD_CACHE ? "on" : "off");
 
 #ifndef NO_MALLINFO
     /* in case the malloc implementation dynamically allocates management structures,
@@ -111,13 +152,15 @@ int main(void)
 
     for (size_t i = 0; i < ARRAY_SIZE(funcs); i++) {
         printf("Testing: %s\n", tests[i]);
+        atomic_store(&is_running, 1);
+        rounds[0] = rounds[1] = 0;
         t1 = thread_create(t1_stack, sizeof(t1_stack), THREAD_PRIORITY_MAIN + 1,
-                           THREAD_CREATE_STACKTEST, funcs[i], NULL, "t1");
+                           THREAD_CREATE_STACKTEST, funcs[i], &rounds[0], "t1");
         t2 = thread_create(t2_stack, sizeof(t2_stack), THREAD_PRIORITY_MAIN + 1,
-                           THREAD_CREATE_STACKTEST, funcs[i], NULL, "t2");
+                           THREAD_CREATE_STACKTEST, funcs[i], &rounds[1], "t2");
         expect((t1 != KERNEL_PID_UNDEF) && (t2 != KERNEL_PID_UNDEF));
 
-        for (uint16_t i = 0; i < 2 * MS_PER_SEC; i++) {
+        for (uint16_t i = 0; i < TEST_DURATION_MS; i++) {
             xtimer_usleep(US_PER_MS);
             /* shuffle t1 and t2 in their run queue. This should eventually hit
              * during a call to malloc() or free() and disclose any missing
@@ -130,6 +173,12 @@ int main(void)
         /* Give threads time to terminate */
         xtimer_usleep(10 * US_PER_MS);
 
+        _print_stats("t1", t1, rounds[0]);
+        _print_stats("t2", t2, rounds[1]);
+        printf("  total: %" PRIu32 " rounds/s\n",
+               (uint32_t)(((uint64_t)rounds[0] + rounds[1]) * MS_PER_SEC
+                          / TEST_DURATION_MS));
+
 #ifndef NO_MALLINFO
         struct mallinfo post = mallinfo();
 
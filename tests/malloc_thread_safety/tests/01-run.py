@@ -13,6 +13,11 @@ from testrunner import run
 
 
 def testfunc(child):
+    for _ in range(2):
+        child.expect(r"Testing: (\S+)\r\n")
+        test = child.match.group(1)
+        child.expect(r"total: (\d+) rounds/s\r\n")
+        print("{}: {} rounds/s".format(test, child.match.group(1)))
     child.expect("TEST PASSED")
 
 
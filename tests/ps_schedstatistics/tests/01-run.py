@@ -31,6 +31,15 @@ PS_EXPECTED = (
     (r'\t    | SUM                  |            |     | \d+  \(\d+\)')
 )
 
+PS_LATENCY_EXPECTED = (
+    r'\twakeup latency histograms \(upper bound in us: count\)',
+    r'\t  3 \|( [<>=]+\d+: \d+)+',
+    r'\t  4 \|( [<>=]+\d+: \d+)+',
+    r'\t  5 \|( [<>=]+\d+: \d+)+',
+    r'\t  6 \|( [<>=]+\d+: \d+)+',
+    r'\t  7 \|( [<>=]+\d+: \d+)+',
+)
+
 
 def _check_startup(child):
     for i in range(5):
@@ -53,6 +62,9 @@ def _check_ps(child):
     child.sendline('ps')
     for line in PS_EXPECTED:
         child.expect(line)
+    # every thread got woken up by a message at least once
+    for line in PS_LATENCY_EXPECTED:
+        child.expect(line)
     # Wait for all lines of the ps output to be displayed
     child.expect_exact('>')
 
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ * @file
+ * @brief       Test sys/sched_edf against fixed priority scheduling and
+ *              thread_yield() at the EDF level
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "msg.h"
+#include "sched_edf.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define US_PER_MS           (1000LU)
+#define TEST_DURATION       (700LU * US_PER_MS)
+#define CALIBRATION_TIME    (50LU * US_PER_MS)
+#define YIELD_PERIOD        (1000LU * US_PER_MS)
+
+typedef struct {
+    const char *name;
+    uint32_t period;
+    uint32_t wcet;
+    uint8_t prio;           /* rate monotonic priority */
+    bool edf;
+    unsigned jobs;
+    unsigned misses;
+    unsigned overruns;
+} task_t;
+
+static task_t _tasks[] = {
+    { .name = "A", .period = 50 * US_PER_MS, .wcet = 18 * US_PER_MS,
+      .prio = THREAD_PRIORITY_MAIN - 3 },
+    { .name = "B", .period = 70 * US_PER_MS, .wcet = 38 * US_PER_MS,
+      .prio = THREAD_PRIORITY_MAIN - 2 },
+};
+
+#define TASK_NUMOF          ARRAY_SIZE(_tasks)
+
+static char _stacks[TASK_NUMOF][THREAD_STACKSIZE_MAIN];
+static kernel_pid_t _main_pid;
+static uint32_t _start;
+static uint32_t _loops_per_ms;
+
+static char _order[8];
+static unsigned _order_len;
+static kernel_pid_t _later_pid;
+
+static void _ran(char c)
+{
+    if (_order_len < sizeof(_order) - 1) {
+        _order[_order_len++] = c;
+    }
+}
+
+static void *_yield_later(void *arg)
+{
+    (void)arg;
+    sched_edf_t edf;
+
+    sched_edf_join(&edf, YIELD_PERIOD, YIELD_PERIOD / 2, YIELD_PERIOD / 2);
+    thread_sleep();
+    _ran('L');
+    sched_edf_leave(&edf);
+    return NULL;
+}
+
+static void *_yield_earliest(void *arg)
+{
+    (void)arg;
+    sched_edf_t edf;
+
+    sched_edf_join(&edf, YIELD_PERIOD, YIELD_PERIOD / 100, YIELD_PERIOD / 100);
+    thread_wakeup(_later_pid);
+    _ran('E');
+    /* the deadline is still the earliest: keeps running */
+    thread_yield();
+    _ran('E');
+    sched_edf_leave(&edf);
+    return NULL;
+}
+
+/* main, a thread with a later and one with the earliest deadline share the
+ * EDF level. The latter yields, the order by deadline must be kept. */
+static bool _test_yield(void)
+{
+    sched_edf_t edf;
+
+    sched_edf_join(&edf, YIELD_PERIOD, YIELD_PERIOD, YIELD_PERIOD);
+    _later_pid = thread_create(_stacks[0], sizeof(_stacks[0]),
+                               CONFIG_SCHED_EDF_PRIO - 1, 0, _yield_later,
+                               NULL, "later");
+    thread_create(_stacks[1], sizeof(_stacks[1]), CONFIG_SCHED_EDF_PRIO - 1, 0,
+                  _yield_earliest, NULL, "earliest");
+    _ran('M');
+    sched_edf_leave(&edf);
+
+    printf("yield: %s\n", _order);
+    return strcmp(_order, "EELM") == 0;
+}
+
+static void _work(uint32_t loops)
+{
+    for (volatile uint32_t i = 0; i < loops; i++) {}
+}
+
+static void _calibrate(void)
+{
+    uint32_t loops = 0;
+    uint32_t begin = ztimer_now(ZTIMER_USEC);
+    uint32_t now;
+
+    do {
+        _work(1000);
+        loops += 1000;
+        now = ztimer_now(ZTIMER_USEC);
+    } while (now - begin < CALIBRATION_TIME);
+
+    _loops_per_ms = loops / ((now - begin) / US_PER_MS);
+}
+
+static void *_task(void *arg)
+{
+    task_t *task = arg;
+    uint32_t loops = (task->wcet / US_PER_MS) * _loops_per_ms;
+    unsigned numof = TEST_DURATION / task->period;
+    msg_t msg;
+
+    ztimer_sleep(ZTIMER_USEC, _start - ztimer_now(ZTIMER_USEC));
+
+    if (task->edf) {
+        sched_edf_t edf;
+
+        sched_edf_join(&edf, task->period, task->period,
+                       task->wcet + task->wcet / 4);
+        while (edf.jobs < numof) {
+            _work(loops);
+            sched_edf_wait_period(&edf);
+        }
+        sched_edf_leave(&edf);
+        task->jobs = edf.jobs;
+        task->misses = edf.misses;
+        task->overruns = edf.overruns;
+    }
+    else {
+        uint32_t release = _start;
+
+        while (task->jobs < numof) {
+            _work(loops);
+            if (ztimer_now(ZTIMER_USEC) - release > task->period) {
+                task->misses++;
+            }
+            task->jobs++;
+            ztimer_periodic_wakeup(ZTIMER_USEC, &release, task->period);
+        }
+    }
+
+    msg_send(&msg, _main_pid);
+    return NULL;
+}
+
+static unsigned _run(bool edf)
+{
+    unsigned misses = 0;
+    msg_t msg;
+
+    _start = ztimer_now(ZTIMER_USEC) + 10 * US_PER_MS;
+    for (unsigned i = 0; i < TASK_NUMOF; i++) {
+        _tasks[i].edf = edf;
+        _tasks[i].jobs = 0;
+        _tasks[i].misses = 0;
+        _tasks[i].overruns = 0;
+        thread_create(_stacks[i], sizeof(_stacks[i]), _tasks[i].prio, 0,
+                      _task, &_tasks[i], _tasks[i].name);
+    }
+    for (unsigned i = 0; i < TASK_NUMOF; i++) {
+        msg_receive(&msg);
+    }
+
+    printf("%s:", edf ? "EDF" : "fixed priority");
+    for (unsigned i = 0; i < TASK_NUMOF; i++) {
+        printf(" %s %u/%u missed,", _tasks[i].name, _tasks[i].misses,
+               _tasks[i].jobs);
+        misses += _tasks[i].misses;
+    }
+    if (edf) {
+        unsigned overruns = 0;
+        for (unsigned i = 0; i < TASK_NUMOF; i++) {
+            overruns += _tasks[i].overruns;
+        }
+        printf(" %u overruns\n", overruns);
+    }
+    else {
+        puts("");
+    }
+
+    return misses;
+}
+
+int main(void)
+{
+    _main_pid = thread_getpid();
+
+    if (!_test_yield()) {
+        puts("[FAILED]");
+        return 1;
+    }
+
+    puts("calibrating");
+    _calibrate();
+
+    unsigned fp_misses = _run(false);
+    unsigned edf_misses = _run(true);
+
+    if (edf_misses < fp_misses) {
+        puts("[SUCCESS]");
+    }
+    else {
+        puts("[FAILED]");
+    }
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("yield: EELM")
+    child.expect_exact("calibrating")
+    child.expect(r"fixed priority: A (\d+)/(\d+) missed, B (\d+)/(\d+) missed,")
+    fp_misses = int(child.match.group(1)) + int(child.match.group(3))
+    child.expect(r"EDF: A (\d+)/(\d+) missed, B (\d+)/(\d+) missed, (\d+) overruns")
+    edf_misses = int(child.match.group(1)) + int(child.match.group(3))
+    assert edf_misses < fp_misses
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
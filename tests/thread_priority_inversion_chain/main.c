@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for chained priority inheritance
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "rmutex.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define PRIO_HIGH       (THREAD_PRIORITY_MAIN - 4)
+#define PRIO_HOG        (THREAD_PRIORITY_MAIN - 3)
+#define PRIO_MID        (THREAD_PRIORITY_MAIN - 2)
+#define PRIO_LOW        (THREAD_PRIORITY_MAIN - 1)
+
+#define WORK_US         (2LU * US_PER_MS)
+#define HOG_US          (20LU * US_PER_MS)
+#define CANCEL_US       (WORK_US / 2)
+#define ROUNDS          (5U)
+
+typedef struct {
+    const char *name;
+    void (*lock)(void *lock);
+    void (*unlock)(void *lock);
+    void *a;            /* held by low, wanted by mid */
+    void *b;            /* held by mid, wanted by high */
+    unsigned depth;     /* number of times a lock is taken by its owner */
+    bool cancel;        /* high gives up waiting for b */
+} variant_t;
+
+static mutex_t _mutex_a = MUTEX_INIT;
+static mutex_t _mutex_b = MUTEX_INIT;
+static rmutex_t _rmutex_a = RMUTEX_INIT;
+static rmutex_t _rmutex_b = RMUTEX_INIT;
+
+static void _mutex_lock(void *lock)
+{
+    mutex_lock(lock);
+}
+
+static void _mutex_unlock(void *lock)
+{
+    mutex_unlock(lock);
+}
+
+static void _rmutex_lock(void *lock)
+{
+    rmutex_lock(lock);
+}
+
+static void _rmutex_unlock(void *lock)
+{
+    rmutex_unlock(lock);
+}
+
+static const variant_t _variants[] = {
+    { "mutex", _mutex_lock, _mutex_unlock, &_mutex_a, &_mutex_b, 1, false },
+    { "rmutex", _rmutex_lock, _rmutex_unlock, &_rmutex_a, &_rmutex_b, 2, false },
+    { "mutex cancel", _mutex_lock, _mutex_unlock, &_mutex_a, &_mutex_b, 1, true },
+};
+
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_hog[THREAD_STACKSIZE_DEFAULT];
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+
+static const variant_t *_variant;
+static kernel_pid_t _pid_low, _pid_mid, _pid_hog, _pid_high;
+static bool _high_done;
+static uint32_t _latency;
+static unsigned _failures;
+
+static void _check(bool cond, const char *what)
+{
+    if (!cond) {
+        printf("%s: %s\n", _variant->name, what);
+        _failures++;
+    }
+}
+
+static void _lock(void *lock)
+{
+    for (unsigned i = 0; i < _variant->depth; i++) {
+        _variant->lock(lock);
+    }
+}
+
+static void _unlock(void *lock)
+{
+    for (unsigned i = 0; i < _variant->depth; i++) {
+        _variant->unlock(lock);
+    }
+}
+
+static void _busy(uint32_t duration)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while (ztimer_now(ZTIMER_USEC) - start < duration) {}
+}
+
+static uint8_t _prio(kernel_pid_t pid)
+{
+    return thread_get(pid)->priority;
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+    _lock(_variant->a);
+    thread_wakeup(_pid_mid);
+    thread_wakeup(_pid_high);
+    if (!_variant->cancel) {
+        _check(_prio(_pid_low) == PRIO_HIGH, "low did not inherit from high");
+    }
+    thread_wakeup(_pid_hog);
+    _busy(WORK_US);
+    _unlock(_variant->a);
+    _check(_prio(_pid_low) == PRIO_LOW, "priority of low not restored");
+    return NULL;
+}
+
+static void *_mid(void *arg)
+{
+    (void)arg;
+    _lock(_variant->b);
+    _lock(_variant->a);
+    _unlock(_variant->a);
+    _unlock(_variant->b);
+    _check(_prio(_pid_mid) == PRIO_MID, "priority of mid not restored");
+    return NULL;
+}
+
+static void *_hog(void *arg)
+{
+    (void)arg;
+    _check(_high_done, "hog ran before high got its lock");
+    _busy(HOG_US);
+    return NULL;
+}
+
+static void *_high(void *arg)
+{
+    (void)arg;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    if (_variant->cancel) {
+        int res = ztimer_mutex_lock_timeout(ZTIMER_USEC, _variant->b, CANCEL_US);
+        _check(res == -ECANCELED, "lock did not time out");
+        /* mid still blocks low, but no longer passes on high's priority */
+        _check(_prio(_pid_mid) == PRIO_MID, "mid kept priority of high");
+        _check(_prio(_pid_low) == PRIO_MID, "low did not fall back to mid");
+        _high_done = true;
+        return NULL;
+    }
+
+    _lock(_variant->b);
+    _latency = ztimer_now(ZTIMER_USEC) - start;
+    _high_done = true;
+    _unlock(_variant->b);
+    return NULL;
+}
+
+static void _run(const variant_t *variant)
+{
+    uint32_t worst = 0;
+
+    _variant = variant;
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        _high_done = false;
+        _latency = 0;
+        _pid_low = thread_create(_stack_low, sizeof(_stack_low), PRIO_LOW,
+                                 THREAD_CREATE_SLEEPING, _low, NULL, "low");
+        _pid_mid = thread_create(_stack_mid, sizeof(_stack_mid), PRIO_MID,
+                                 THREAD_CREATE_SLEEPING, _mid, NULL, "mid");
+        _pid_hog = thread_create(_stack_hog, sizeof(_stack_hog), PRIO_HOG,
+                                 THREAD_CREATE_SLEEPING, _hog, NULL, "hog");
+        _pid_high = thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH,
+                                  THREAD_CREATE_SLEEPING, _high, NULL, "high");
+        /* main has the lowest priority and only continues once all the
+         * threads are done */
+        thread_wakeup(_pid_low);
+        if (_latency > worst) {
+            worst = _latency;
+        }
+    }
+
+    if (!variant->cancel) {
+        _check(worst < HOG_US, "high waited for hog");
+        printf("%s: worst case latency %" PRIu32 " us\n", variant->name, worst);
+    }
+    else {
+        printf("%s: done\n", variant->name);
+    }
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_variants); i++) {
+        _run(&_variants[i]);
+    }
+
+    if (_failures) {
+        puts("TEST FAILED");
+    }
+    else {
+        puts("TEST PASSED");
+    }
+
+    return 0;
+}
@@ -23,9 +23,14 @@
 #include <stdio.h>
 
 #include "irq.h"
+#include "kernel_defines.h"
 #include "sched.h"
 #include "thread.h"
 
+/* number of _spin() calls to wait for the IRQ check thread to run on another
+ * core */
+#define SMP_WAIT_SPINS  (100000U)
+
 char iqr_check_stack[THREAD_STACKSIZE_DEFAULT];
 
 static volatile uint8_t irq_occurred;
@@ -63,6 +68,17 @@ static void _spin(void)
     for (i = 0; i < 255; i++) ;
 }
 
+/* With core_smp, the IRQ check thread may run on another core in parallel to
+ * main, so it has not necessarily run yet when main continues */
+static void _smp_wait(void)
+{
+    if (IS_USED(MODULE_CORE_SMP)) {
+        for (unsigned i = 0; (i < SMP_WAIT_SPINS) && !irq_occurred; i++) {
+            _spin();
+        }
+    }
+}
+
 int main(void)
 {
     puts("Context swap race condition test application");
@@ -83,6 +99,7 @@ int main(void)
 
     /* Delay so we are not testing for race conditions also */
     _spin();
+    _smp_wait();
 
     if (irq_occurred == 1) {
         puts("[Success]");
@@ -100,6 +117,7 @@ int main(void)
 
     /* Delay so we are not testing for race conditions also */
     _spin();
+    _smp_wait();
 
     if (irq_occurred == 1) {
         puts("[Success]");
@@ -117,6 +135,7 @@ int main(void)
     _thread_wake_wo_yield(pid);
 
     thread_yield_higher();
+    _smp_wait();
 
     /* Race instruction */
     race_test = irq_occurred;
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the binary export of `sys/trace`
+ *
+ * Records scheduler, msg, mutex and ztimer events and dumps the binary
+ * export as hex, so the test script can feed it to the host-side decoder.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "trace.h"
+#include "ztimer.h"
+
+#define MSG_TYPE_TEST   (0x4242)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _lock = MUTEX_INIT;
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        /* blocks until main releases the lock */
+        mutex_lock(&_lock);
+        mutex_unlock(&_lock);
+    }
+    return NULL;
+}
+
+static int _print_hex(void *arg, const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+    (void)arg;
+    for (size_t i = 0; i < len; i++) {
+        printf("%02x", bytes[i]);
+    }
+    puts("");
+    return 0;
+}
+
+int main(void)
+{
+    msg_t msg = { .type = MSG_TYPE_TEST };
+    kernel_pid_t worker = thread_create(_stack, sizeof(_stack),
+                                        THREAD_PRIORITY_MAIN - 1,
+                                        THREAD_CREATE_STACKTEST,
+                                        _worker, NULL, "worker");
+
+    printf("main: %d worker: %d\n", thread_getpid(), worker);
+
+    trace_reset();
+    trace_hooks_enable(TRACE_EVENT_MASK(TRACE_EVENT_SCHED_SWITCH) |
+                       TRACE_EVENT_MASK(TRACE_EVENT_MSG_SEND) |
+                       TRACE_EVENT_MASK(TRACE_EVENT_MSG_RECV) |
+                       TRACE_EVENT_MASK(TRACE_EVENT_MUTEX_LOCK) |
+                       TRACE_EVENT_MASK(TRACE_EVENT_MUTEX_BLOCK) |
+                       TRACE_EVENT_MASK(TRACE_EVENT_MUTEX_UNLOCK) |
+                       TRACE_EVENT_MASK(TRACE_EVENT_ZTIMER_FIRE));
+    mutex_lock(&_lock);
+    trace(1);
+    msg_send(&msg, worker);
+    ztimer_sleep(ZTIMER_USEC, 100);
+    mutex_unlock(&_lock);
+    trace(2);
+    trace_hooks_enable(0);
+
+    puts("-- trace start --");
+    int numof = trace_export(_print_hex, NULL);
+    puts("-- trace end --");
+    printf("exported %d events\n", numof);
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import binascii
+import json
+import subprocess
+import sys
+import tempfile
+from testrunner import run
+
+DECODER = "../../dist/tools/trace/trace2json.py"
+
+
+def _events(trace, name, tid=None):
+    return [e for e in trace["traceEvents"]
+            if e["name"] == name and (tid is None or e.get("tid") == tid)]
+
+
+def testfunc(child):
+    child.expect(r"main: (\d+) worker: (\d+)\r\n")
+    main = int(child.match.group(1))
+    worker = int(child.match.group(2))
+    child.expect_exact("-- trace start --\r\n")
+    child.expect(r"([0-9a-f\r\n]*)-- trace end --\r\n")
+    data = binascii.unhexlify("".join(child.match.group(1).split()))
+    child.expect(r"exported (\d+) events\r\n")
+    assert int(child.match.group(1)) > 0
+
+    with tempfile.NamedTemporaryFile(suffix=".bin") as export:
+        export.write(data)
+        export.flush()
+        out = subprocess.check_output([
+            DECODER, export.name,
+            "-n", "{}=main".format(main), "-n", "{}=worker".format(worker),
+        ])
+    trace = json.loads(out)
+
+    names = {e["tid"]: e["args"]["name"]
+             for e in _events(trace, "thread_name")}
+    assert names[main] == "main"
+    assert names[worker] == "worker"
+
+    users = [e["args"]["value"] for e in _events(trace, "user", main)]
+    assert users == ["0x00000001", "0x00000002"]
+
+    assert _events(trace, "running", worker)
+    assert _events(trace, "running", main)
+
+    sends = _events(trace, "msg_send", main)
+    assert {"target": worker, "msg_type": "0x4242"} in \
+        [e["args"] for e in sends]
+    recvs = _events(trace, "msg_recv", worker)
+    assert {"sender": main, "msg_type": "0x4242"} in \
+        [e["args"] for e in recvs]
+
+    # worker blocks on the mutex held by main until main releases it
+    block = _events(trace, "mutex_block", worker)
+    assert block
+    mutex = block[0]["args"]["mutex"]
+    unlock = [e for e in _events(trace, "mutex_unlock", main)
+              if e["args"]["mutex"] == mutex]
+    lock = [e for e in _events(trace, "mutex_lock", worker)
+            if e["args"]["mutex"] == mutex]
+    assert unlock and lock
+    assert block[0]["ts"] <= unlock[-1]["ts"] <= lock[-1]["ts"]
+
+    # the timer of ztimer_sleep() expires in interrupt context
+    assert _events(trace, "ztimer_fire", -1)
+
+    print("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -7,6 +7,7 @@
  */
 
 #include <limits.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -59,10 +60,54 @@ static void test_mbox_put_get(void)
     TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&mbox, &msg));
 }
 
+static void test_mbox_init_dirty_queue(void)
+{
+    mbox_t mbox;
+    msg_t queue[QUEUE_SIZE];
+    msg_t msg = { .type = 42, .content.value = gen_val(42) };
+
+    /* Leftovers of a previous use of the queue must not show up as
+     * messages. */
+    memset(queue, 0xff, sizeof(queue));
+    mbox_init(&mbox, queue, ARRAY_SIZE(queue));
+    TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&mbox, &msg));
+
+    TEST_ASSERT_EQUAL_INT(1, mbox_try_put(&mbox, &msg));
+    msg.type = 0;
+    TEST_ASSERT_EQUAL_INT(1, mbox_try_get(&mbox, &msg));
+    TEST_ASSERT_EQUAL_INT(42, msg.type);
+    TEST_ASSERT_EQUAL_INT(gen_val(42), msg.content.value);
+    TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&mbox, &msg));
+}
+
+static void test_mbox_static_init_dirty_queue(void)
+{
+    msg_t queue[QUEUE_SIZE];
+    mbox_t mbox = MBOX_INIT(queue, ARRAY_SIZE(queue));
+    msg_t msg = { .type = 42, .content.value = gen_val(42) };
+
+    /* like a queue on the stack, which MBOX_INIT() can't clear */
+    memset(queue, 0xff, sizeof(queue));
+    TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&mbox, &msg));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(queue); i++) {
+        msg.type = i;
+        TEST_ASSERT_EQUAL_INT(1, mbox_try_put(&mbox, &msg));
+    }
+    TEST_ASSERT_EQUAL_INT(0, mbox_try_put(&mbox, &msg));
+    for (unsigned i = 0; i < ARRAY_SIZE(queue); i++) {
+        TEST_ASSERT_EQUAL_INT(1, mbox_try_get(&mbox, &msg));
+        TEST_ASSERT_EQUAL_INT(i, msg.type);
+    }
+    TEST_ASSERT_EQUAL_INT(0, mbox_try_get(&mbox, &msg));
+}
+
 Test *tests_core_mbox_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_mbox_put_get),
+        new_TestFixture(test_mbox_init_dirty_queue),
+        new_TestFixture(test_mbox_static_init_dirty_queue),
     };
 
     EMB_UNIT_TESTCALLER(core_mbox_tests, NULL, NULL, fixtures);
@@ -975,6 +975,162 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing that the longest matching prefix wins, regardless of the
+*        order the entries were added in
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    size_t add_buf_size = 16;
+    uint8_t addr_dst[add_buf_size];
+    uint8_t addr_nxt[add_buf_size];
+    uint8_t addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    /* prefix lengths in the order they are added, 0 is the default route */
+    static const uint8_t prefixes[] = { 32, 0, 48, 16, 128, 40 };
+
+    /* all prefixes are taken from 20 01 0d b8 01 01 00 ... 00 01, the next hop
+     * of each entry holds its prefix length in the first byte */
+    memset(addr_lookup, 0, add_buf_size);
+    addr_lookup[0] = 0x20;
+    addr_lookup[1] = 0x01;
+    addr_lookup[2] = 0x0d;
+    addr_lookup[3] = 0xb8;
+    addr_lookup[4] = 0x01;
+    addr_lookup[5] = 0x01;
+    addr_lookup[15] = 0x01;
+
+    for (size_t i = 0; i < ARRAY_SIZE(prefixes); ++i) {
+        memset(addr_dst, 0, add_buf_size);
+        memcpy(addr_dst, addr_lookup, prefixes[i] / 8);
+        memset(addr_nxt, 0, add_buf_size);
+        addr_nxt[0] = prefixes[i];
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst, add_buf_size,
+                                               ((uint32_t)prefixes[i] << FIB_FLAG_NET_PREFIX_SHIFT),
+                                               addr_nxt, add_buf_size, 0, 100000));
+    }
+
+    /* the host entry matches */
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt, &add_buf_size, &next_hop_flags,
+                                              addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(128, addr_nxt[0]);
+
+    /* 20 01 0d b8 01 01 00 ... 00 02 falls back to the /48 prefix */
+    addr_lookup[15] = 0x02;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt, &add_buf_size, &next_hop_flags,
+                                              addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(48, addr_nxt[0]);
+
+    /* 20 01 0d b8 01 02 ... falls back to the /40 prefix */
+    addr_lookup[5] = 0x02;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt, &add_buf_size, &next_hop_flags,
+                                              addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(40, addr_nxt[0]);
+
+    /* 20 01 0d b9 ... only matches the /16 prefix */
+    addr_lookup[3] = 0xb9;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt, &add_buf_size, &next_hop_flags,
+                                              addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(16, addr_nxt[0]);
+
+    /* after removing the /16 prefix, only the default route is left */
+    memset(addr_dst, 0, add_buf_size);
+    memcpy(addr_dst, addr_lookup, 2);
+    fib_remove_entry(&test_fib_table, addr_dst, add_buf_size);
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt, &add_buf_size, &next_hop_flags,
+                                              addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(0, addr_nxt[0]);
+
+    /* the remaining prefixes are still found */
+    addr_lookup[3] = 0xb8;
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              addr_nxt, &add_buf_size, &next_hop_flags,
+                                              addr_lookup, add_buf_size, 0));
+    TEST_ASSERT_EQUAL_INT(40, addr_nxt[0]);
+
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(prefixes) - 1, fib_get_num_used_entries(&test_fib_table));
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_routes(&test_fib_table);
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief testing that entries are removed once their lifetime expired, for the
+*        next hop lookup, the destination set and when printing the routes
+*/
+static void test_fib_22_lifetime_expiry(void)
+{
+    size_t add_buf_size = 16;
+    char addr_dst[] = "Test address221";
+    char addr_nxt[] = "Test address222";
+    char addr_long[] = "Test address223";
+    char prefix[] = "Test address22";
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                                           (uint8_t *)addr_dst, add_buf_size - 1, 0,
+                                           (uint8_t *)addr_nxt, add_buf_size - 1, 0,
+                                           10));
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                                           (uint8_t *)addr_long, add_buf_size - 1, 0,
+                                           (uint8_t *)addr_nxt, add_buf_size - 1, 0,
+                                           100000));
+    TEST_ASSERT_EQUAL_INT(2, fib_get_num_used_entries(&test_fib_table));
+
+    xtimer_usleep(20 * US_PER_MS);
+
+    fib_destination_set_entry_t arr_dst[2];
+    size_t arr_size = ARRAY_SIZE(arr_dst);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_destination_set(&test_fib_table,
+                                                     (uint8_t *)prefix, add_buf_size - 1,
+                                                     arr_dst, &arr_size));
+    TEST_ASSERT_EQUAL_INT(1, arr_size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(arr_dst[0].dest, addr_long, add_buf_size - 1));
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH,
+                          fib_get_next_hop(&test_fib_table, &iface_id,
+                                           (uint8_t *)addr_nxt, &add_buf_size,
+                                           &next_hop_flags, (uint8_t *)addr_dst,
+                                           add_buf_size - 1, 0));
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              (uint8_t *)addr_nxt, &add_buf_size,
+                                              &next_hop_flags, (uint8_t *)addr_long,
+                                              add_buf_size - 1, 0));
+
+    add_buf_size = 16;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                                           (uint8_t *)addr_dst, add_buf_size - 1, 0,
+                                           (uint8_t *)addr_nxt, add_buf_size - 1, 0,
+                                           10));
+    TEST_ASSERT_EQUAL_INT(2, fib_get_num_used_entries(&test_fib_table));
+
+    xtimer_usleep(20 * US_PER_MS);
+
+    fib_print_routes(&test_fib_table);
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -999,6 +1155,8 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
+                        new_TestFixture(test_fib_22_lifetime_expiry),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
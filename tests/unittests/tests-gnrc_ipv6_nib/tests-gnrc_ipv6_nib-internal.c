@@ -585,6 +585,54 @@ static void test_nib_nc_remove__cleared(void)
     TEST_ASSERT_NULL(_nib_onl_iter(NULL));
 }
 
+/*
+ * Adds a neighbor cache entry twice, sets it reachable and removes it.
+ * Expected result: the NIB's version changes with every step but adding the
+ * entry a second time
+ */
+static void test_nib_version__nc(void)
+{
+    _nib_onl_entry_t *node;
+    static const ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                               { .u64 = TEST_UINT64 } } };
+    uint32_t version = gnrc_ipv6_nib_version();
+
+    TEST_ASSERT_NOT_NULL((node = _nib_nc_add(&addr, IFACE,
+                                             GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)));
+    TEST_ASSERT(version != gnrc_ipv6_nib_version());
+    version = gnrc_ipv6_nib_version();
+    TEST_ASSERT(node == _nib_nc_add(&addr, IFACE,
+                                    GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_ipv6_nib_version());
+    _nib_nc_set_reachable(node);
+    TEST_ASSERT(version != gnrc_ipv6_nib_version());
+    version = gnrc_ipv6_nib_version();
+    _nib_nc_remove(node);
+    TEST_ASSERT(version != gnrc_ipv6_nib_version());
+}
+
+/*
+ * Adds a prefix list entry twice and removes it.
+ * Expected result: the NIB's version changes with every step but adding the
+ * entry a second time
+ */
+static void test_nib_version__pl(void)
+{
+    _nib_offl_entry_t *dst;
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    uint32_t version = gnrc_ipv6_nib_version();
+
+    TEST_ASSERT_NOT_NULL((dst = _nib_pl_add(IFACE, &pfx, GLOBAL_PREFIX_LEN,
+                                            UINT32_MAX, UINT32_MAX)));
+    TEST_ASSERT(version != gnrc_ipv6_nib_version());
+    version = gnrc_ipv6_nib_version();
+    TEST_ASSERT(dst == _nib_pl_add(IFACE, &pfx, GLOBAL_PREFIX_LEN,
+                                   UINT32_MAX, UINT32_MAX));
+    TEST_ASSERT_EQUAL_INT(version, gnrc_ipv6_nib_version());
+    _nib_pl_remove(dst);
+    TEST_ASSERT(version != gnrc_ipv6_nib_version());
+}
+
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF default router list entries with
  * different IP addresses and then tries to add another.
@@ -2029,6 +2077,8 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_nc_add__cache_out_crash),
         new_TestFixture(test_nib_nc_remove__uncleared),
         new_TestFixture(test_nib_nc_remove__cleared),
+        new_TestFixture(test_nib_version__nc),
+        new_TestFixture(test_nib_version__pl),
         new_TestFixture(test_nib_nc_set_reachable__success),
         new_TestFixture(test_nib_drl_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_drl_add__no_space_left_diff_iface),
@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,74 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    /* source: https://tools.ietf.org/html/rfc1071#section-3 */
+    static const uint8_t data[] = {
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+    };
+    uint64_t buf[(sizeof(data) + 8) / sizeof(uint64_t) + 1];
+
+    /* the result must not depend on the alignment of the buffer */
+    for (unsigned offset = 0; offset < 8; offset++) {
+        uint8_t *start = (uint8_t *)buf + offset;
+
+        memcpy(start, data, sizeof(data));
+        TEST_ASSERT_EQUAL_INT(0xddf2, inet_csum(0, start, 8));
+        TEST_ASSERT_EQUAL_INT(0xbbe5, inet_csum(0, start, 16));
+        TEST_ASSERT_EQUAL_INT(0x55be, inet_csum(0, start, sizeof(data)));
+        /* odd length and odd slices */
+        TEST_ASSERT_EQUAL_INT(0x54c7, inet_csum(0, start, sizeof(data) - 1));
+        TEST_ASSERT_EQUAL_INT(0x55be,
+                              inet_csum_slice(inet_csum_slice(0, start, 21, 0),
+                                              start + 21, sizeof(data) - 21, 21));
+    }
+}
+
+static void test_inet_csum__update16(void)
+{
+    /* source: https://tools.ietf.org/html/rfc1624#section-4 */
+    TEST_ASSERT_EQUAL_INT(0x0000, inet_csum_update16(0xdd2f, 0x5555, 0x3285));
+}
+
+static void test_inet_csum__update(void)
+{
+    /* source: http://en.wikipedia.org/w/index.php?title=IPv4_header_checksum&oldid=645516564
+     * but left checksum 0 */
+    uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0x00, 0x00, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+    static const uint8_t new_dst[] = { 0x0a, 0x00, 0x2a, 0x01 };
+    uint8_t old_dst[sizeof(new_dst)];
+    uint16_t csum = 0xb861;
+
+    /* rewrite destination address */
+    memcpy(old_dst, &data[16], sizeof(old_dst));
+    memcpy(&data[16], new_dst, sizeof(new_dst));
+    csum = inet_csum_update(csum, old_dst, new_dst, sizeof(new_dst), 16);
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+
+    /* rewrite odd part of source address back and forth */
+    memcpy(old_dst, &data[13], 3);
+    memcpy(&data[13], new_dst, 3);
+    csum = inet_csum_update(csum, old_dst, new_dst, 3, 13);
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+    csum = inet_csum_update(csum, new_dst, old_dst, 3, 13);
+    memcpy(&data[13], old_dst, 3);
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+
+    /* decrement TTL */
+    csum = inet_csum_update16(csum, 0x4011, 0x3f11);
+    data[8] = 0x3f;
+    TEST_ASSERT_EQUAL_INT((uint16_t)~inet_csum(0, data, sizeof(data)), csum);
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +245,9 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
+        new_TestFixture(test_inet_csum__update16),
+        new_TestFixture(test_inet_csum__update),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -185,6 +185,48 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_lookup__demux_ctx(void)
+{
+    /* the first two probably share a hash bucket */
+    gnrc_netreg_entry_t others[] = {
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16 + (2 * GNRC_NETREG_HASH_BUCKETS),
+                                   TEST_UINT8 + 2),
+        GNRC_NETREG_ENTRY_INIT_PID(TEST_UINT16 + 1, TEST_UINT8 + 3),
+        GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL, TEST_UINT8 + 4),
+    };
+    gnrc_netreg_entry_t *res = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &others[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &others[1]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &others[2]));
+
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)));
+    TEST_ASSERT_EQUAL_INT(TEST_UINT8, res->target.pid);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                   GNRC_NETREG_DEMUX_CTX_ALL)));
+    TEST_ASSERT_EQUAL_INT(TEST_UINT8 + 4, res->target.pid);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                             TEST_UINT16 + (2 * GNRC_NETREG_HASH_BUCKETS)));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 1));
+    gnrc_netreg_release_shared();
+
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &others[0]);
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &others[1]);
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &others[2]);
+
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                             TEST_UINT16 + (2 * GNRC_NETREG_HASH_BUCKETS)));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST,
+                                             GNRC_NETREG_DEMUX_CTX_ALL));
+    gnrc_netreg_release_shared();
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -195,6 +237,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_unregister__success3),
         new_TestFixture(test_netreg_lookup__wrong_type_undef),
         new_TestFixture(test_netreg_lookup__wrong_type_numof),
+        new_TestFixture(test_netreg_lookup__demux_ctx),
         new_TestFixture(test_netreg_num__empty),
         new_TestFixture(test_netreg_num__wrong_type_undef),
         new_TestFixture(test_netreg_num__wrong_type_numof),
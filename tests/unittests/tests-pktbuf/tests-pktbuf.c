@@ -247,7 +247,9 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
+/* alignment-handling left to malloc resp. small chunks taken from size classes,
+ * so no certainty here */
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -498,6 +500,73 @@ static void test_pktbuf_mark__success_equally_sized(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* gnrc_pktbuf_malloc always copies */
+static void test_pktbuf_add_rx__mark_in_place(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add_rx(sizeof(TEST_STRING64), 14,
+                                             GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr1, *hdr2;
+    uint8_t *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64), pkt->size);
+    memcpy(pkt->data, TEST_STRING64, sizeof(TEST_STRING64));
+    data = pkt->data;
+    /* e.g. Ethernet header */
+    TEST_ASSERT_NOT_NULL((hdr1 = gnrc_pktbuf_mark(pkt, 14, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(hdr1->data == data);
+    TEST_ASSERT(pkt->data == data + 14);
+    /* next header is aligned again */
+    TEST_ASSERT_NOT_NULL((hdr2 = gnrc_pktbuf_mark(pkt, 16, GNRC_NETTYPE_TEST)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(hdr2->data == data + 14);
+    TEST_ASSERT(pkt->data == data + 30);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64) - 30, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 30, pkt->data, pkt->size));
+    /* drop link layer header and padding behind the payload */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr1);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 3));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(pkt->data == data + 30);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 14, hdr2->data, 16));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
+/* size class chunks are copied as a whole */
+static void test_pktbuf_mark__unaligned_rest_in_place(void)
+{
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING64, sizeof(TEST_STRING64),
+                                           GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt2;
+    uint8_t *data;
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    data = pkt1->data;
+    TEST_ASSERT_NOT_NULL((pkt2 = gnrc_pktbuf_mark(pkt1, 9, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* only the marked section is moved */
+    TEST_ASSERT(pkt1->data == data + 9);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, pkt2->data, 9));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 9, pkt1->data, pkt1->size));
+
+    /* check if packets of the released space would override data */
+    gnrc_pktbuf_remove_snip(pkt1, pkt2);
+    pkt2 = gnrc_pktbuf_add(NULL, TEST_STRING12, 12, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 9, pkt1->data, pkt1->size));
+
+    /* check if everything can be cleaned up */
+    gnrc_pktbuf_release(pkt1);
+    gnrc_pktbuf_release(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 static void test_pktbuf_realloc_data__size_0(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(TEST_STRING8), GNRC_NETTYPE_TEST);
@@ -816,7 +885,8 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+/* with gnrc_pktbuf_slab, snips are still available from their size class */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -838,7 +908,7 @@ static void test_pktbuf_reverse_snips__too_full(void)
     gnrc_pktbuf_release(pkt_next);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif /* !MODULE_GNRC_PKTBUF_MALLOC && !MODULE_GNRC_PKTBUF_SLAB */
 
 static void test_pktbuf_reverse_snips__success(void)
 {
@@ -871,7 +941,7 @@ Test *tests_pktbuf_tests(void)
 #endif
         new_TestFixture(test_pktbuf_add__success),
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -884,6 +954,12 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_mark__success_aligned),
         new_TestFixture(test_pktbuf_mark__success_small),
         new_TestFixture(test_pktbuf_mark__success_equally_sized),
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+        new_TestFixture(test_pktbuf_add_rx__mark_in_place),
+#endif
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
+        new_TestFixture(test_pktbuf_mark__unaligned_rest_in_place),
+#endif
         new_TestFixture(test_pktbuf_realloc_data__size_0),
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_realloc_data__memfull),
@@ -909,9 +985,9 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif /* !MODULE_GNRC_PKTBUF_MALLOC && !MODULE_GNRC_PKTBUF_SLAB */
         new_TestFixture(test_pktbuf_reverse_snips__success),
     };
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+#include "pktbuf_internal.h"
+#include "pktbuf_slab.h"
+
+#include "unittests-constants.h"
+#include "tests-pktbuf_slab.h"
+
+/* fits the 64 byte class on all platforms */
+#define HDR_LEN     (40U)
+/* too large for any class */
+#define DATA_LEN    (100U)
+#define CLASS_64    (3U)
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+}
+
+static void test_pktbuf_slab_snip(void)
+{
+    gnrc_pktbuf_slab_stats_t stats;
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, 0, GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(gnrc_pktbuf_slab_contains(pkt));
+    gnrc_pktbuf_slab_get_stats(0, &stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.used);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_slab_get_stats(0, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.used);
+    TEST_ASSERT_EQUAL_INT(1, stats.max_used);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_header_and_payload(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, DATA_LEN,
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr = gnrc_pktbuf_add(pkt, TEST_STRING64, HDR_LEN,
+                                          GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(gnrc_pktbuf_contains(pkt->data));
+    TEST_ASSERT(!gnrc_pktbuf_slab_contains(pkt->data));
+    TEST_ASSERT(gnrc_pktbuf_slab_contains(hdr->data));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, hdr->data, HDR_LEN));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_exhausted(void)
+{
+    gnrc_pktbuf_slab_stats_t stats;
+    gnrc_pktsnip_t *pkt = NULL;
+
+    for (unsigned i = 0; i <= CONFIG_GNRC_PKTBUF_SLAB_64_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, TEST_STRING64, HDR_LEN, GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    /* last one was allocated from the arena */
+    TEST_ASSERT(!gnrc_pktbuf_slab_contains(pkt->data));
+    TEST_ASSERT(gnrc_pktbuf_slab_contains(pkt->next->data));
+    gnrc_pktbuf_slab_get_stats(CLASS_64, &stats);
+    TEST_ASSERT_EQUAL_INT(64, stats.size);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_64_NUMOF, stats.used);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_64_NUMOF, stats.max_used);
+    TEST_ASSERT_EQUAL_INT(1, stats.fails);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_slab_get_stats(CLASS_64, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.used);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_mark(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING64, HDR_LEN,
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT_EQUAL_INT(8, hdr->size);
+    TEST_ASSERT_EQUAL_INT(HDR_LEN - 8, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64, hdr->data, 8));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 8, pkt->data, HDR_LEN - 8));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* release the marked header first, the rest must stay intact */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 8, pkt->data, HDR_LEN - 8));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_realloc_data__shrink(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING64, HDR_LEN,
+                                          GNRC_NETTYPE_TEST);
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 4));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+Test *tests_pktbuf_slab_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_slab_snip),
+        new_TestFixture(test_pktbuf_slab_header_and_payload),
+        new_TestFixture(test_pktbuf_slab_exhausted),
+        new_TestFixture(test_pktbuf_slab_mark),
+        new_TestFixture(test_pktbuf_slab_realloc_data__shrink),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_pktbuf_slab_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_pktbuf_slab_tests;
+}
+
+void tests_pktbuf_slab(void)
+{
+    TESTS_RUN(tests_pktbuf_slab_tests());
+}
+/** @} */
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``gnrc_pktbuf_slab`` module
+ */
+#ifndef TESTS_PKTBUF_SLAB_H
+#define TESTS_PKTBUF_SLAB_H
+
+#include "embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The entry point of this test suite.
+ */
+void tests_pktbuf_slab(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_PKTBUF_SLAB_H */
+/** @} */
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for ztimer clocks backed by a timing wheel
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define NUMOF_ALARMS    (64U)
+
+static ztimer_mock_t zmock;
+static ztimer_wheel_t wheel;
+static ztimer_clock_t *z = &zmock.super;
+
+static uint32_t fired[NUMOF_ALARMS];
+static unsigned numof_fired;
+
+static void cb_incr(void *arg)
+{
+    uint32_t *ptr = arg;
+    *ptr += 1;
+}
+
+static void cb_record(void *arg)
+{
+    fired[numof_fired++] = (uintptr_t)arg;
+}
+
+static void setup(void)
+{
+    ztimer_mock_init(&zmock, 32);
+    ztimer_wheel_attach(z, &wheel);
+    numof_fired = 0;
+}
+
+/**
+ * @brief   Same sequence as the list based mock test
+ */
+static void test_ztimer_wheel_set32(void)
+{
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+
+    ztimer_set(z, &alarm, 1000);
+
+    ztimer_mock_advance(&zmock,    1);    /* now =    1*/
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock,  998);    /* now =  999 */
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock,    1);    /* now = 1000*/
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock, 1001);    /* now = 2001*/
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_set(z, &alarm, 3);
+    ztimer_mock_advance(&zmock,  999);    /* now = 3000*/
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_set(z, &alarm, 4000001000ul);
+    ztimer_mock_advance(&zmock, 1000);    /* now = 4000*/
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 3999999999ul);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    ztimer_mock_advance(&zmock, 1);       /* now = 4000004000*/
+    TEST_ASSERT_EQUAL_INT(4000004000ul, ztimer_now(z));
+    TEST_ASSERT_EQUAL_INT(3, count);
+    /* wraps around 2^32 */
+    ztimer_set(z, &alarm, 300000000ul);
+    ztimer_mock_advance(&zmock, 299999999ul);
+    TEST_ASSERT_EQUAL_INT(3, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(4, count);
+    ztimer_set(z, &alarm, 15);
+    ztimer_mock_advance(&zmock,  14);
+    TEST_ASSERT(ztimer_remove(z, &alarm));
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(4, count);
+    TEST_ASSERT(!ztimer_remove(z, &alarm));
+}
+
+/**
+ * @brief   Timers set in arbitrary order fire ordered by their target
+ */
+static void test_ztimer_wheel_order(void)
+{
+    ztimer_t alarms[NUMOF_ALARMS];
+
+    for (unsigned i = 0; i < NUMOF_ALARMS; i++) {
+        /* 37 is coprime to NUMOF_ALARMS, so this shuffles the targets */
+        uintptr_t target = ((i * 37) % NUMOF_ALARMS) * 1000 + 1;
+        alarms[i] = (ztimer_t){ .callback = cb_record, .arg = (void *)target };
+        ztimer_set(z, &alarms[i], target);
+    }
+
+    /* remove every fourth timer */
+    for (unsigned i = 0; i < NUMOF_ALARMS; i += 4) {
+        TEST_ASSERT(ztimer_remove(z, &alarms[i]));
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+    }
+
+    for (unsigned i = 0; i < NUMOF_ALARMS; i++) {
+        ztimer_mock_advance(&zmock, 500);
+        ztimer_mock_advance(&zmock, 500);
+    }
+
+    TEST_ASSERT_EQUAL_INT(NUMOF_ALARMS - NUMOF_ALARMS / 4, numof_fired);
+    for (unsigned i = 1; i < numof_fired; i++) {
+        TEST_ASSERT(fired[i - 1] < fired[i]);
+    }
+    for (unsigned i = 0; i < NUMOF_ALARMS; i++) {
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+    }
+}
+
+/**
+ * @brief   Testing ztimer_is_set() and setting a timer to 0
+ */
+static void test_ztimer_wheel_is_set(void)
+{
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm2 = { .callback = cb_incr, .arg = &count, };
+
+    ztimer_set(z, &alarm, 1000);
+    ztimer_set(z, &alarm2, 0x12345);
+
+    TEST_ASSERT(ztimer_is_set(z, &alarm));
+    TEST_ASSERT(ztimer_is_set(z, &alarm2));
+
+    ztimer_mock_advance(&zmock, 1000);
+
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(!ztimer_is_set(z, &alarm));
+    TEST_ASSERT(ztimer_is_set(z, &alarm2));
+
+    /* re-setting moves the timer */
+    ztimer_set(z, &alarm2, 10);
+    ztimer_mock_advance(&zmock, 10);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT(!ztimer_is_set(z, &alarm2));
+
+    ztimer_set(z, &alarm, 0);
+    TEST_ASSERT(ztimer_is_set(z, &alarm));
+    ztimer_mock_fire(&zmock);
+    TEST_ASSERT_EQUAL_INT(3, count);
+    TEST_ASSERT(!ztimer_is_set(z, &alarm));
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_set32),
+        new_TestFixture(test_ztimer_wheel_order),
+        new_TestFixture(test_ztimer_wheel_is_set),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, setup, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */